@@ -4,40 +4,91 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../src/alarm.c \
+../src/brightness.c \
 ../src/buzzer.c \
+../src/clock.c \
+../src/clockface.c \
 ../src/crp.c \
+../src/drift.c \
+../src/event.c \
+../src/fonts.c \
+../src/format.c \
+../src/graph.c \
+../src/layout.c \
+../src/ledbar.c \
+../src/logger.c \
 ../src/main.c \
 ../src/memory.c \
 ../src/msghandler.c \
+../src/probe.c \
+../src/profile.c \
 ../src/rtc.c \
 ../src/ssd1306.c \
+../src/swtimer.c \
 ../src/text.c \
+../src/textscroll.c \
 ../src/timer.c \
-../src/validate.c 
+../src/validate.c \
+../src/zone.c 
 
 OBJS += \
+./src/alarm.o \
+./src/brightness.o \
 ./src/buzzer.o \
+./src/clock.o \
+./src/clockface.o \
 ./src/crp.o \
+./src/drift.o \
+./src/event.o \
+./src/fonts.o \
+./src/format.o \
+./src/graph.o \
+./src/layout.o \
+./src/ledbar.o \
+./src/logger.o \
 ./src/main.o \
 ./src/memory.o \
 ./src/msghandler.o \
+./src/probe.o \
+./src/profile.o \
 ./src/rtc.o \
 ./src/ssd1306.o \
+./src/swtimer.o \
 ./src/text.o \
+./src/textscroll.o \
 ./src/timer.o \
-./src/validate.o 
+./src/validate.o \
+./src/zone.o 
 
 C_DEPS += \
+./src/alarm.d \
+./src/brightness.d \
 ./src/buzzer.d \
+./src/clock.d \
+./src/clockface.d \
 ./src/crp.d \
+./src/drift.d \
+./src/event.d \
+./src/fonts.d \
+./src/format.d \
+./src/graph.d \
+./src/layout.d \
+./src/ledbar.d \
+./src/logger.d \
 ./src/main.d \
 ./src/memory.d \
 ./src/msghandler.d \
+./src/probe.d \
+./src/profile.d \
 ./src/rtc.d \
 ./src/ssd1306.d \
+./src/swtimer.d \
 ./src/text.d \
+./src/textscroll.d \
 ./src/timer.d \
-./src/validate.d 
+./src/validate.d \
+./src/zone.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -0,0 +1,90 @@
+/*
+ * alarm.h
+ *
+ * A table of ALARM_COUNT alarms, each at a minute of the day on some days of the week, and either repeating or once.
+ * The table lives in EEPROM row EE_OFFSET_ALARM; it is read by Alarm_Load, and written when it changes.
+ *
+ * The clock never compares the time with the alarms: Alarm_Next gives the RTC time of the first alarm to come, and
+ * main.c runs sAlarmTimer until then. In deep power down that is the RTC wake-up counter, like the log: the IC sleeps
+ * until the second the alarm minute starts. Only the minute of the week of that alarm is kept over deep power down, in
+ * PMU retained word 0, so a wake of the log tells whether an alarm is due without reading the EEPROM, see
+ * Alarm_SecondsTo.
+ *
+ * Times count seconds since 1970-01-01, a Thursday: the day of the week follows from the number of days, no date
+ * conversion is needed. The times of the table are local times, as displayed: main.c gives Alarm_Next the local time
+ * of Zone_ToLocal, and turns the alarm back into RTC time - UTC - with Zone_ToUtc. The minute of the week kept over
+ * deep power down is the one of the RTC, so the wake of the log needs no time zone.
+ */
+
+#ifndef ALARM_H_
+#define ALARM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Number of alarms in the table. Slot 0 is the one the "NEW" command of the phone sets. */
+#define ALARM_COUNT         8
+
+/** An alarm still goes off this many seconds after its minute started, e.g. when the IC woke up late */
+#define ALARM_LATE_SECONDS  20
+
+/** Returned by Alarm_Next when no alarm is enabled */
+#define ALARM_NONE          0xFFFFFFFF
+
+/** Bits of ALARM_T.days, bit 0 is Sunday */
+#define ALARM_DAY(weekday)  (1 << (weekday))
+#define ALARM_EVERY_DAY     0x7F
+
+/** Bits of ALARM_T.flags */
+#define ALARM_ENABLED       0x01
+#define ALARM_ONCE          0x02    /*!< Disabled once it went off */
+
+typedef struct ALARM_S {
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t days;                   /*!< ALARM_DAY bits; 0 acts as ALARM_EVERY_DAY */
+    uint8_t flags;                  /*!< ALARM_ENABLED, ALARM_ONCE */
+} ALARM_T;
+
+/**
+ * Reads the table from EEPROM. A row without a table of this firmware gives a table without enabled alarms.
+ * @pre The EEPROM is initialized.
+ */
+extern void Alarm_Load(void);
+
+/**
+ * Changes one alarm, and writes the table to EEPROM.
+ * @param slot 0 .. ALARM_COUNT - 1; others are ignored.
+ */
+extern void Alarm_Set(int slot, const ALARM_T *alarm);
+
+/**
+ * Retrieves one alarm.
+ * @param slot 0 .. ALARM_COUNT - 1.
+ */
+extern void Alarm_Get(int slot, ALARM_T *alarm);
+
+/**
+ * Looks for the first enabled alarm to go off after @a after.
+ * @return The RTC time the minute of that alarm starts, always within a week after @a after; or ALARM_NONE.
+ */
+extern uint32_t Alarm_Next(uint32_t after);
+
+/**
+ * To be called when the alarms at @a now went off: the alarms once among them are disabled.
+ * @return The RTC time of the next alarm, as Alarm_Next.
+ */
+extern uint32_t Alarm_Fired(uint32_t now);
+
+/**
+ * The minute of the week of an RTC time, 0 at Sunday 00:00, to keep the next alarm in a few bits.
+ */
+extern uint16_t Alarm_MinuteOfWeek(uint32_t time);
+
+/**
+ * Tells how many seconds are left until an alarm at a minute of the week.
+ * @return 0 during the first ALARM_LATE_SECONDS of that minute, else the seconds until it next starts.
+ */
+extern uint32_t Alarm_SecondsTo(uint16_t minuteOfWeek, uint32_t now);
+
+#endif /* ALARM_H_ */
@@ -0,0 +1,63 @@
+/*
+ * brightness.h
+ *
+ * Brightness policy of the OLED panel. The panel draws most of its current through the segment drivers, in
+ * proportion to the contrast and to the number of lit pixels: lowering the contrast where nobody needs the full
+ * brightness is the largest saving available on the battery.
+ *
+ * Panel supply current with the clock face lit (about 790 pixels), as estimated by tools/oledsim:
+ *   BRIGHTNESS_DAY      0xFF  about 3.5 mA
+ *   BRIGHTNESS_SAVER    0x40  about 1.2 mA, -66%
+ *   BRIGHTNESS_NIGHT    0x10  about 0.6 mA, -83%
+ * During the fade before the display goes off, the contrast steps down to a sixth of the profile's.
+ *
+ * A profile also sets the duty of the LED bar, see ledbar.h: the LEDs draw more than the panel, and are seen in the
+ * dark at an eighth of their full current.
+ */
+
+#ifndef BRIGHTNESS_H_
+#define BRIGHTNESS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Night time, in local hours: from BRIGHTNESS_NIGHT_START up to but not including BRIGHTNESS_NIGHT_END */
+#define BRIGHTNESS_NIGHT_START      22
+#define BRIGHTNESS_NIGHT_END        7
+
+/** The contrast is lowered step by step during the last seconds before the display goes off */
+#define BRIGHTNESS_FADE_SECONDS     5
+
+typedef enum BRIGHTNESS_PROFILE {
+    BRIGHTNESS_DAY,             /*!< Full contrast, as set by ssd1306_init */
+    BRIGHTNESS_SAVER,           /*!< Battery low: readable indoors */
+    BRIGHTNESS_NIGHT,           /*!< Dark room: lowest contrast and shortest pre-charge */
+    BRIGHTNESS_PROFILE_COUNT
+} BRIGHTNESS_PROFILE_T;
+
+/** Panel and LED settings of a profile */
+typedef struct BRIGHTNESS_SETTINGS_S {
+    uint8_t contrast;
+    uint8_t precharge;
+    uint8_t ledDuty;            /*!< Of the LED bar, in 1/LEDBAR_DUTY_FULL */
+} BRIGHTNESS_SETTINGS_T;
+
+extern const BRIGHTNESS_SETTINGS_T g_BrightnessProfiles[BRIGHTNESS_PROFILE_COUNT];
+
+/**
+ * Picks the profile for the given conditions. At night the night profile is used, as it is the lowest.
+ * @param hour The local hour, 0 - 23, see zone.h.
+ * @param batteryLow true when the battery is below the brown-out level.
+ */
+extern BRIGHTNESS_PROFILE_T Brightness_Select(uint8_t hour, bool batteryLow);
+
+/**
+ * Sets the panel to the profile for the given conditions, faded when the display is about to go off.
+ * Only sends commands when the setting changes: at most once a second during the fade, otherwise hardly ever.
+ * @param hour The local hour, 0 - 23, see zone.h.
+ * @param batteryLow true when the battery is below the brown-out level.
+ * @param secondsLeft Seconds until the display goes off.
+ */
+extern void Brightness_Apply(uint8_t hour, bool batteryLow, uint32_t secondsLeft);
+
+#endif /* BRIGHTNESS_H_ */
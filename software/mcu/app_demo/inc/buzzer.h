@@ -8,7 +8,10 @@
 #ifndef BUZZER_H_
 #define BUZZER_H_
 
+#include <stdint.h>
+
 extern void buzzer_start(void);
 extern void buzzer_stop(void);
+extern void buzzer_set_clock(uint32_t frequency);
 
 #endif /* BUZZER_H_ */
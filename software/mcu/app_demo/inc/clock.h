@@ -0,0 +1,83 @@
+/*
+ * clock.h
+ *
+ * Governor of the system clock. Work that is bound by the core - building the NDEF message, unpacking the log,
+ * rendering the OLED frame - requests a faster clock and releases it when done, so it finishes sooner and the core
+ * sleeps longer. With nothing requested, the clock runs at CLOCK_LEVEL_IDLE: the core sleeps most of the time, but
+ * the clock tree and the peripherals keep running at that speed.
+ *
+ * Requests are counted per level; the clock runs at the highest level requested. On each switch the governor sets the
+ * flash wait states for the new clock, and keeps the I2C bit rate set by Clock_SetI2CRate, the tick of the 32-bit timer
+ * (TIMER_TICK_HZ) and the tone of the buzzer on the 16-bit timer as they were. The SPI0 and watchdog clocks have their
+ * own dividers of the SFRO and are not affected.
+ *
+ * Estimated charge of the work of a task per million cycles, above the core sleeping at CLOCK_IDLE_HZ. The currents are
+ * those assumed in tools/profile/profile.py, 250 uA running and 120 uA sleeping at 2 MHz, taken as 100 uA fixed plus
+ * 10 uA/MHz sleeping, and 30 uA fixed plus 50 uA/MHz more while the core runs. A flash wait state is taken as 25% more
+ * cycles:
+ *   1 MHz                  80 uAs
+ *   2 MHz                  70 uAs
+ *   4 MHz                  65 uAs, CLOCK_FAST_HZ: the fastest clock without a wait state
+ *   8 MHz, 1 wait state    78 uAs
+ * 8 MHz only pays when less than about 40% of the current above the sleep at CLOCK_IDLE_HZ grows with the clock. The
+ * larger saving is CLOCK_IDLE_HZ: the core sleeps nearly all of a wake, 10 uA below the sleep at 2 MHz.
+ *
+ * CLOCK_LEVEL_FAST is only granted while the battery powers the IC: running from the NFC field alone, a faster clock
+ * dropped the supply below 1.2V with some phones, see ResetISR. It is then held at CLOCK_LEVEL_NORMAL instead.
+ *
+ * All functions are to be called from the main loop, never under interrupt.
+ */
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum CLOCK_LEVEL {
+    CLOCK_LEVEL_IDLE,       /*!< CLOCK_IDLE_HZ: sleeping, waiting for a peripheral */
+    CLOCK_LEVEL_NORMAL,     /*!< CLOCK_NORMAL_HZ: the clock set by ResetISR, for everything not tuned */
+    CLOCK_LEVEL_FAST,       /*!< CLOCK_FAST_HZ: bursts of computation */
+    CLOCK_LEVEL_COUNT
+} CLOCK_LEVEL_T;
+
+/* Set to 0 to keep the clock at CLOCK_LEVEL_NORMAL: the fixed clock of before, to compare the charge per task */
+#ifndef CLOCK_GOVERNOR
+#define CLOCK_GOVERNOR      1
+#endif
+
+/** The slowest clock keeping the 32-bit timer at 1 tick per microsecond, see TIMER_TICK_HZ */
+#define CLOCK_IDLE_HZ       (1 * 1000 * 1000)
+#define CLOCK_NORMAL_HZ     (2 * 1000 * 1000)
+#define CLOCK_FAST_HZ       (4 * 1000 * 1000)
+
+/**
+ * Takes over the clock set by ResetISR as CLOCK_LEVEL_NORMAL, without changing it. Nothing is requested yet: the
+ * first release lowers the clock to CLOCK_LEVEL_IDLE.
+ */
+extern void Clock_Init(void);
+
+/**
+ * Raises the clock to at least @a level, until the matching #Clock_Release.
+ */
+extern void Clock_Request(CLOCK_LEVEL_T level);
+
+/**
+ * Ends a #Clock_Request of the same level; the clock drops to the highest level still requested.
+ */
+extern void Clock_Release(CLOCK_LEVEL_T level);
+
+/**
+ * @return The level the clock runs at now.
+ */
+extern CLOCK_LEVEL_T Clock_GetLevel(void);
+
+/**
+ * Sets the bit rate of I2C0, and keeps it on each clock switch. Each half of the SCL period takes at least 4 system
+ * clocks: at CLOCK_IDLE_HZ, a rate above CLOCK_IDLE_HZ / 8 - 125 kHz - is lowered to it, until the clock is raised.
+ * @param rate In Hz. 0 when I2C0 is no longer in use.
+ * @pre I2C0 is initialized when @a rate is not 0.
+ */
+extern void Clock_SetI2CRate(uint32_t rate);
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,65 @@
+/*
+ * clockface.h
+ *
+ * Clock face of the OLED panel. It remembers what each cell last showed, so an update only renders - and only
+ * sends - the cells whose content changed. On a normal second that is the colon alone.
+ */
+
+#ifndef CLOCKFACE_H_
+#define CLOCKFACE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/** Content of the clock face */
+typedef struct CLOCKFACE_S {
+    uint8_t     hours;
+    uint8_t     minutes;
+    bool        colon;          /*!< Blinks with the seconds */
+    uint32_t    year;
+    uint8_t     month;
+    uint8_t     day;
+    bool        showDate;       /*!< false leaves the date line to others, e.g. the text message */
+    int         temperature;    /*!< In tenths of a degree */
+    bool        fahrenheit;
+    uint8_t     battery;        /*!< Level as given to OLED_ShowBat */
+    bool        alarm;
+} CLOCKFACE_T;
+
+/** Cells of the clock face, as bits in the return value of ClockFace_Update */
+typedef enum CLOCKFACE_CELL {
+    CLOCKFACE_CELL_HOUR_TENS,
+    CLOCKFACE_CELL_HOUR_ONES,
+    CLOCKFACE_CELL_COLON,
+    CLOCKFACE_CELL_MINUTE_TENS,
+    CLOCKFACE_CELL_MINUTE_ONES,
+    CLOCKFACE_CELL_DATE,
+    CLOCKFACE_CELL_TEMPERATURE,
+    CLOCKFACE_CELL_BATTERY,
+    CLOCKFACE_CELL_ALARM,
+    CLOCKFACE_CELL_COUNT
+} CLOCKFACE_CELL_T;
+
+/**
+ * Forgets what the cells show, so the next ClockFace_Update renders all of them.
+ * Call this whenever something else has drawn over the clock face, e.g. after ssd1306_init.
+ */
+extern void ClockFace_Invalidate(void);
+
+/**
+ * Renders the cells whose content differs from what they last showed, and starts sending them with OLED_Flush.
+ * @param face The content to show.
+ * @return A bit (1 << CLOCKFACE_CELL_T) for each cell rendered.
+ */
+extern uint16_t ClockFace_Update(const CLOCKFACE_T *face);
+
+#if SSD1306_BUS_STATS
+/**
+ * Retrieves the panel traffic of the previous ClockFace_Update, from its first span until the start of this one.
+ * @param stats Filled in with the transactions and bytes sent.
+ */
+extern void ClockFace_GetTickStats(OLED_BUS_STATS_T *stats);
+#endif
+
+#endif /* CLOCKFACE_H_ */
@@ -0,0 +1,102 @@
+/*
+ * drift.h
+ *
+ * Keeps the RTC right between two taps of the phone. The RTC counts ticks of RTCCAL pulses of the TFRO, which runs
+ * some ppm off, and more so away from room temperature: left alone the clock walks by minutes over a few months.
+ *
+ * Learning: every time the phone sets the RTC, Drift_Sync compares the RTC with the time of the phone. The error since
+ * the previous sync, the model of the rate in effect over that interval and the mean temperature of the log over it
+ * give the rate of the raw TFRO for that interval. DRIFT_HISTORY intervals are fitted, weighted by their length, to a
+ * rate in ppb at DRIFT_REFERENCE_DECIDEGREES and a temperature coefficient; the coefficient only when the intervals lie
+ * DRIFT_MIN_SPREAD_DECIDEGREES apart, DRIFT_DEFAULT_PPB_PER_DEGREE until then. A new interval takes the place of the
+ * one nearest in temperature, not of the oldest: the weeks between taps hardly differ in temperature, the seasons
+ * do, and the history keeps them. Intervals shorter than DRIFT_MIN_SECONDS are not fitted but added to the next one;
+ * an error above DRIFT_MAX_SYNC_SECONDS is taken for a time set on purpose - another time zone - and starts a new
+ * interval.
+ *
+ * Correcting: RTCCAL is an integer, 30 ppm per pulse. Drift_Apply sets it for the coming seconds at the temperature of
+ * the moment, dithered between the two nearest integers so the mean is exact: the error of the dithering is carried
+ * over in PMU retained word 3 to the next call, see RETAINED_STATUS_DRIFT_SHIFT. It is called when the IC enters deep
+ * power down with the EEPROM open - DeInit, and the sample wakes of the logger that write the log - for the time until
+ * the next such moment. The error of a call is at most half a pulse over that time, not cumulative: 41 ms for the
+ * 45 minutes of a batch of the logger.
+ *
+ * The fit and its history are kept in EEPROM row EE_OFFSET_DRIFT, written at each sync only.
+ */
+
+#ifndef DRIFT_H_
+#define DRIFT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Set to 0 to leave RTCCAL at its factory value */
+#ifndef DRIFT
+#define DRIFT                           1
+#endif
+
+/** Temperature at which the rate of the fit holds, in deci-Celsius */
+#define DRIFT_REFERENCE_DECIDEGREES     250
+
+/** Temperature coefficient until the history allows a fit, in ppb per degree Celsius */
+#ifndef DRIFT_DEFAULT_PPB_PER_DEGREE
+#define DRIFT_DEFAULT_PPB_PER_DEGREE    0
+#endif
+
+/** Number of intervals between syncs that are fitted */
+#define DRIFT_HISTORY                   3
+
+/** Shortest interval that is fitted: an error of one second in a day is already 11.6 ppm */
+#define DRIFT_MIN_SECONDS               (2 * 24 * 60 * 60)
+
+/** Largest error of the RTC that is taken for drift */
+#define DRIFT_MAX_SYNC_SECONDS          (10 * 60)
+
+/** Spread of the mean temperatures of the history needed to fit the temperature coefficient */
+#define DRIFT_MIN_SPREAD_DECIDEGREES    50
+
+/** Longest time Drift_Apply accounts for in one call */
+#define DRIFT_MAX_APPLY_SECONDS         4000
+
+/** Marks a record written by this firmware */
+#define DRIFT_HEADER                    0x44524601
+
+/** One interval between two syncs */
+typedef struct DRIFT_INTERVAL_S {
+    uint32_t seconds;                   /*!< Length, in RTC seconds */
+    int32_t rate;                       /*!< Rate of the raw TFRO over it, in ppb: positive is fast */
+    int16_t temperature;                /*!< Mean temperature over it, in deci-Celsius */
+    int16_t reserved;
+} DRIFT_INTERVAL_T;
+
+/** The record, as stored in EEPROM */
+typedef struct DRIFT_RECORD_S {
+    uint32_t header;                    /*!< DRIFT_HEADER */
+    uint32_t sync;                      /*!< RTC time just set by the last sync, the start of the running interval */
+    int32_t pending;                    /*!< Seconds the RTC was set forward by syncs within the running interval */
+    uint16_t cal;                       /*!< RTCCAL before the first Drift_Apply: the factory calibration */
+    int16_t coefficient;                /*!< Fitted, in ppb per degree Celsius */
+    int32_t rate;                       /*!< Fitted, in ppb at DRIFT_REFERENCE_DECIDEGREES */
+    int32_t base;                       /*!< RTCCAL for the fit at DRIFT_REFERENCE_DECIDEGREES, in 1/2048 pulse */
+    int32_t slope;                      /*!< RTCCAL for the fit, in 1/(2048*256) pulse per deci-Celsius */
+    DRIFT_INTERVAL_T interval[DRIFT_HISTORY];   /*!< In no order; seconds is 0 for unused ones */
+} DRIFT_RECORD_T;
+
+/**
+ * To be called when the phone sets the RTC, before it is set. Learns from the error of the RTC, see above.
+ * @param rtc The RTC time.
+ * @param reference The time given by the phone.
+ * @param temperature The temperature now, in deci-Celsius: the mean of the interval when the log has none.
+ * @pre The EEPROM and the storage mod are initialized.
+ */
+extern void Drift_Sync(uint32_t rtc, uint32_t reference, int temperature);
+
+/**
+ * Sets RTCCAL for the next @a seconds, see above. Does nothing before the first sync.
+ * @param temperature The temperature now, in deci-Celsius.
+ * @param seconds Until the next call; at most DRIFT_MAX_APPLY_SECONDS are accounted for.
+ * @pre The EEPROM is initialized.
+ */
+extern void Drift_Apply(int temperature, uint32_t seconds);
+
+#endif /* DRIFT_H_ */
@@ -0,0 +1,76 @@
+/*
+ * event.h
+ *
+ * Events from the interrupt handlers to the main loop. The handlers post, the main loop takes them one by one and
+ * sleeps whenever none is pending: the core only runs when something happened.
+ *
+ * The queue is lock free with a single producer and a single consumer. All producers are interrupt handlers at the
+ * same priority: they cannot preempt each other, so together they are the single producer. Only the main loop
+ * consumes. Do not post from the main loop.
+ */
+
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Pending events kept; a power of 2. Posts on a full queue are dropped and counted. */
+#define EVENT_QUEUE_SIZE    8
+
+typedef enum EVENT_TYPE {
+    EVENT_TICK,                 /*!< RTC wake-up, once a second */
+    EVENT_TEMPERATURE,          /*!< A measurement completed; data: deci-Celsius */
+    EVENT_NFC_FIELD,            /*!< The NFC field changed; data: 1 when present, 0 when gone */
+    EVENT_NFC_MESSAGE,          /*!< The phone wrote an NDEF message */
+    EVENT_TYPE_COUNT
+} EVENT_TYPE_T;
+
+typedef struct EVENT_S {
+    uint8_t     type;           /*!< EVENT_TYPE_T */
+    int32_t     data;
+    uint32_t    time;           /*!< Timer_GetFreeRunning when posted */
+} EVENT_T;
+
+typedef void (*EVENT_HANDLER_T)(const EVENT_T *event);
+
+/** Per event type, in ticks of Timer_GetFreeRunning */
+typedef struct EVENT_TYPE_STATS_S {
+    uint32_t    count;
+    uint32_t    maxLatency;     /*!< From the post until its handler started */
+    uint32_t    maxDuration;    /*!< Of the handler */
+    uint32_t    totalDuration;
+} EVENT_TYPE_STATS_T;
+
+typedef struct EVENT_STATS_S {
+    EVENT_TYPE_STATS_T type[EVENT_TYPE_COUNT];
+    uint32_t    asleep;         /*!< Ticks slept in Event_Dispatch while the queue was empty */
+    uint32_t    awake;          /*!< All other ticks since the statistics were reset */
+    uint32_t    dropped;        /*!< Posts lost on a full queue */
+} EVENT_STATS_T;
+
+/**
+ * Empties the queue and resets the statistics.
+ * @pre Timer_StartFreeRunning was called, else all times read 0.
+ */
+extern void Event_Init(void);
+
+/**
+ * Queues an event. To be called from interrupt handlers only.
+ * @return false if the queue was full: the event is dropped.
+ */
+extern bool Event_Post(EVENT_TYPE_T type, int32_t data);
+
+/**
+ * Sleeps until an event is pending, then calls its handler.
+ * @param handlers One per EVENT_TYPE_T; NULL ignores that type.
+ */
+extern void Event_Dispatch(const EVENT_HANDLER_T handlers[EVENT_TYPE_COUNT]);
+
+/**
+ * Retrieves the statistics.
+ * @param reset If true, the statistics restart from now.
+ */
+extern void Event_GetStats(EVENT_STATS_T *stats, bool reset);
+
+#endif /* EVENT_H_ */
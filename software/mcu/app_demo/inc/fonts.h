@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    fonts.h
+  * @brief   Compressed glyphs and icons of the OLED clock face
+  ******************************************************************************
+  */
+
+#ifndef __FONTS_H_
+#define __FONTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * The tables are generated by tools/fontc/fontc.py into fonts.c, which holds only the glyphs the firmware uses.
+ * Glyphs and icons are stored in the panel's page layout, one row of @c width bytes per page, and each one is
+ * compressed separately as a stream of tokens:
+ */
+#define FONT_RLE_LITERAL    (0x00)  // 0nnnnnnn: n+1 literal bytes follow
+#define FONT_RLE_REPEAT     (0x80)  // 10nnnnnn: the next byte is repeated n+2 times
+#define FONT_RLE_ZEROS      (0xC0)  // 11nnnnnn: n+1 zero bytes
+
+/* Placement of a glyph in proportional text */
+typedef struct {
+    uint8_t         left;       // First column drawn
+    uint8_t         advance;    // Columns drawn from there on, spacing included; may extend beyond the glyph width
+} GLYPH_METRICS_T;
+
+typedef struct {
+    const uint8_t  *pData;      // All glyph streams
+    const uint16_t *pOffset;    // Start of each glyph in pData
+    const GLYPH_METRICS_T *pMetrics;    // Of each glyph
+    const char     *pChars;     // The characters present, in glyph order; the first one is used for all others
+    uint8_t         width;      // Columns per glyph
+    uint8_t         pages;      // Pages (8 rows) per glyph
+} FONT_T;
+
+typedef struct {
+    const uint8_t  *pData;      // Stream of the complete icon
+    uint8_t         width;
+    uint8_t         pages;
+} BITMAP_T;
+
+extern const FONT_T Font8x16;
+extern const FONT_T Font16x32;
+
+extern const BITMAP_T Bmp_Degree;
+extern const BITMAP_T Bmp_AlarmSet;
+extern const BITMAP_T Bmp_AlarmClr;
+extern const BITMAP_T Bmp_BatteryFull;
+extern const BITMAP_T Bmp_BatteryMid;
+extern const BITMAP_T Bmp_BatteryLow;
+extern const BITMAP_T Bmp_BatteryEmpty;
+
+/* Decoder state of one glyph or icon stream */
+typedef struct {
+    const uint8_t *src;
+    uint8_t count;      // Bytes left in the current token
+    uint8_t value;      // Byte of a repeat or zero token
+    bool literal;
+} FONT_STREAM_T;
+
+/* Returns the next decoded byte of a glyph or icon stream */
+static inline uint8_t Font_StreamNext(FONT_STREAM_T *s)
+{
+    uint8_t token;
+
+    if (s->count == 0) {
+        token = *s->src++;
+        if ((token & FONT_RLE_REPEAT) == FONT_RLE_LITERAL) {
+            s->count = (uint8_t)(token + 1);
+            s->literal = true;
+        }
+        else if ((token & FONT_RLE_ZEROS) == FONT_RLE_ZEROS) {
+            s->count = (uint8_t)((token & 0x3F) + 1);
+            s->value = 0;
+            s->literal = false;
+        }
+        else {
+            s->count = (uint8_t)((token & 0x3F) + 2);
+            s->value = *s->src++;
+            s->literal = false;
+        }
+    }
+    s->count--;
+    return s->literal ? *s->src++ : s->value;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * format.h
+ *
+ * Numbers to text without printf. Each emitter writes into the buffer of the caller at @a out and returns the end of
+ * what it wrote. None of them writes a NUL, so fields are chained as p = Format_Uint(p, ...), and the caller terminates
+ * the whole once, or not at all when the text goes into a fixed field as in text.c. There are no varargs and no
+ * state; the longest output of each emitter is given below.
+ *
+ * The Cortex-M0+ has no divider: a division by 10 here is a few shifts and adds, not a call to __aeabi_uidivmod. With
+ * sprintf gone, Redlib's printf - __vfprintf, the floating point of fp_display and the double helpers, malloc and the
+ * stdio buffers it drags along - is no longer linked; tools/format/mapsize.py reports what that was in a map file.
+ */
+
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+#include <stdint.h>
+
+/** Longest output of each emitter, for its largest arguments or width */
+#define FORMAT_UINT_SIZE    10                      /*!< 4294967295 */
+#define FORMAT_INT_SIZE     11                      /*!< -2147483648 */
+#define FORMAT_TENTHS_SIZE  12                      /*!< -214748364.8 */
+#define FORMAT_TIME_SIZE    5                       /*!< 23:59 */
+#define FORMAT_DATE_SIZE    10                      /*!< 2106-02-07 */
+#define FORMAT_HEX_SIZE(count) (2 * (count))
+
+/**
+ * @a value in decimal, right aligned in at least @a width characters: "%*u" when @a pad is ' ', "%0*u" when it is '0'.
+ * @return The end of the text.
+ */
+extern char *Format_Uint(char *out, uint32_t value, uint8_t width, char pad);
+
+/**
+ * As Format_Uint, with a '-' for a negative @a value: before the spaces of the padding, after the zeros, as printf.
+ * @return The end of the text.
+ */
+extern char *Format_Int(char *out, int32_t value, uint8_t width, char pad);
+
+/**
+ * A fixed-point value in tenths, e.g. a temperature: -123 gives "-12.3", 5 gives "0.5", right aligned in at least
+ * @a width characters with spaces.
+ * @return The end of the text.
+ */
+extern char *Format_Tenths(char *out, int32_t tenths, uint8_t width);
+
+/**
+ * "hh:mm", both with two digits.
+ * @param separator Between the hours and the minutes, e.g. ' ' for the blinking colon.
+ * @return The end of the text.
+ */
+extern char *Format_Time(char *out, uint8_t hours, uint8_t minutes, char separator);
+
+/**
+ * "yyyy-mm-dd"
+ * @return The end of the text.
+ */
+extern char *Format_Date(char *out, uint32_t year, uint8_t month, uint8_t day);
+
+/**
+ * Two upper case hexadecimal digits per byte, in the order given, e.g. for the UID of Chip_IAP_ReadUID.
+ * @return The end of the text.
+ */
+extern char *Format_Hex(char *out, const uint8_t *bytes, uint8_t count);
+
+#endif /* FORMAT_H_ */
@@ -0,0 +1,39 @@
+/*
+ * graph.h
+ *
+ * Temperature history graph, drawn over the upper six pages of the panel in place of the time and temperature.
+ * The date or text message line below it is left alone.
+ */
+
+#ifndef GRAPH_H_
+#define GRAPH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** The most values Graph_Show plots */
+#define GRAPH_MAX_VALUES    8
+
+/**
+ * Plots the values as a line with a marker per value, scaled between their minimum and maximum, which are printed
+ * at the left. Nothing is rendered when the same values are shown already.
+ * Render budget at 2 MHz, estimated in Cortex-M0+ cycles from the code paths involved:
+ * - clearing the 6 pages: about 10k cycles
+ * - two labels of at most 5 glyphs, decoded byte by byte: about 10k cycles
+ * - scaling: 2 library divisions per value, about 2k cycles for 8 values
+ * - the line: one pixel per column or row stepped, about 50 cycles each. A slow trend takes about 100 pixels, 5k
+ *   cycles; a worst case zigzag over the full height between all 8 values about 420 pixels, 21k cycles.
+ * That is 27k to 43k cycles, or 14 to 22 ms, per rendered frame. Sending it takes at most 6 bursts of 136 bytes,
+ * about 30 ms of bus time at 250 kHz, which runs under interrupt after this returns.
+ * @param values The values in tenths of a degree, oldest first.
+ * @param count The number of values, at most GRAPH_MAX_VALUES; less than 2 shows only the labels.
+ */
+extern void Graph_Show(const int *values, uint8_t count);
+
+/**
+ * Blanks the area of the graph, so the clock face can be drawn again.
+ * @return true if the graph was shown, i.e. whatever was in its area must be drawn again.
+ */
+extern bool Graph_Hide(void);
+
+#endif /* GRAPH_H_ */
@@ -0,0 +1,56 @@
+/*
+ * layout.h
+ *
+ * Proportional text in a box. Each glyph takes only its own width plus one column of spacing, see fontc.py, and
+ * icons can be placed in the text with the symbol escapes below. A box is always drawn completely: the columns the
+ * text leaves free are blanked, so a field is updated by drawing it again, without clearing its line first.
+ * Everything is rendered into the RAM copy of the panel; only what changed is sent by the next OLED_Flush.
+ */
+
+#ifndef LAYOUT_H_
+#define LAYOUT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+
+/*
+ * Symbol escapes, to be concatenated with the text, e.g. "21.5" LAYOUT_DEGREE "C". The escape is complete before the
+ * concatenation, so a following letter that is a hexadecimal digit does not extend it.
+ */
+#define LAYOUT_DEGREE           "\x01"
+#define LAYOUT_ALARM_SET        "\x02"
+#define LAYOUT_ALARM_CLR        "\x03"
+#define LAYOUT_BATTERY_FULL     "\x04"
+#define LAYOUT_BATTERY_MID      "\x05"
+#define LAYOUT_BATTERY_LOW      "\x06"
+#define LAYOUT_BATTERY_EMPTY    "\x07"
+
+typedef enum LAYOUT_ALIGN {
+    LAYOUT_ALIGN_LEFT,
+    LAYOUT_ALIGN_CENTRE,
+    LAYOUT_ALIGN_RIGHT
+} LAYOUT_ALIGN_T;
+
+/** A field on the panel */
+typedef struct LAYOUT_BOX_S {
+    const FONT_T   *font;
+    uint8_t         x;          /*!< First column, exact */
+    uint8_t         width;      /*!< Columns; nothing is drawn outside the box */
+    uint8_t         page;       /*!< First page; the box is as high as the font */
+    LAYOUT_ALIGN_T  align;      /*!< Placement of text narrower than the box; wider text is clipped at both ends */
+} LAYOUT_BOX_T;
+
+/**
+ * @return The width of @a str in @a font, in columns, spacing after the last glyph included.
+ *  Characters not present in the font take the width of a space.
+ */
+extern int Layout_Measure(const FONT_T *font, const char *str);
+
+/**
+ * Draws @a str aligned in @a box, and blanks the rest of the box.
+ * @return The width of @a str, as given by Layout_Measure.
+ */
+extern int Layout_Draw(const LAYOUT_BOX_T *box, const char *str);
+
+#endif /* LAYOUT_H_ */
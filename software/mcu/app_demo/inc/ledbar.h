@@ -0,0 +1,65 @@
+/*
+ * ledbar.h
+ *
+ * The temperature bar: six LEDs, lit from LED0 up to the level of the temperature. The first is always lit while the
+ * bar shows, the others each above a threshold, see LedBar_SetThresholds. The pins are all in port 0: a level is turned
+ * into the mask of its pins once, by a table, and written to the port in one masked write of DATA[LEDBAR_PINS], which
+ * leaves the other pins of the port - the OLED supply, the buzzer - as they are.
+ *
+ * Each LED draws about 2 mA when lit, more than the rest of the clock awake. The bar is therefore driven at a duty
+ * below full, by software PWM on a match register of the 32-bit timer, see Timer_StartCallback: the pins go on at the
+ * start of each LEDBAR_PERIOD_US and off after the duty. That is two interrupts per period, a few dozen cycles each; at
+ * full duty the pins stay on and no interrupt runs.
+ *
+ * The LED time - the time each LED was lit, weighted by the duty - is added to the profile by each LedBar_Show, see
+ * Profile_AddLed: tools/profile/profile.py reports it per full wake, the display interval of the bar.
+ */
+
+#ifndef LEDBAR_H_
+#define LEDBAR_H_
+
+#include <stdint.h>
+
+/** The LEDs of the bar, LED0 first: PIO0_0, PIO0_1, PIO0_2, PIO0_6, PIO0_8, PIO0_9 */
+#define LEDBAR_COUNT        6
+#define LEDBAR_PINS         ((1 << 0) | (1 << 1) | (1 << 2) | (1 << 6) | (1 << 8) | (1 << 9))
+
+/** Duty in 1/LEDBAR_DUTY_FULL of the period */
+#define LEDBAR_DUTY_BITS    4
+#define LEDBAR_DUTY_FULL    (1 << LEDBAR_DUTY_BITS)
+
+/** PWM period: 125 Hz does not flicker */
+#define LEDBAR_PERIOD_US    8000
+
+/**
+ * Sets where the LEDs after LED0 come on: LED n + 1 is lit when the temperature is above @a thresholds[n].
+ * @param thresholds In ascending order, in the unit of the temperatures given to LedBar_Level.
+ */
+extern void LedBar_SetThresholds(const int16_t thresholds[LEDBAR_COUNT - 1]);
+
+/**
+ * The level of a temperature: 1 up to the first threshold, LEDBAR_COUNT above the last.
+ * @param temperature Signed: below zero is below all thresholds.
+ */
+extern uint8_t LedBar_Level(int temperature);
+
+/**
+ * Lights the first @a level LEDs at @a duty, the others off. Only changes the pins and the PWM when either differs
+ * from the last call.
+ * @param level 0 - LEDBAR_COUNT, 0 turns the bar off.
+ * @param duty 0 - LEDBAR_DUTY_FULL.
+ * @pre Timer_StartFreeRunning was called, for the PWM and the LED time.
+ */
+extern void LedBar_Show(uint8_t level, uint8_t duty);
+
+/**
+ * @return The level shown, 0 when the bar is off.
+ */
+extern uint8_t LedBar_GetLevel(void);
+
+/**
+ * Turns the bar off, stops the PWM and adds the LED time to the profile. To be called before deep power down.
+ */
+extern void LedBar_Off(void);
+
+#endif /* LEDBAR_H_ */
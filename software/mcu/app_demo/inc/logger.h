@@ -0,0 +1,132 @@
+/*
+ * logger.h
+ *
+ * Temperature log in the storage mod, one sample every LOGGER_INTERVAL_SECONDS, also while the IC is in deep power
+ * down. An RTC wake-up that only has to take a sample runs the fast path of Logger_SampleAndSleep straight from main:
+ * no Init, so the NFC block, I2C, the OLED panel and the LEDs stay unpowered. Only TSEN, the EEPROM and the RTC are
+ * used, and the core sleeps during the conversion.
+ *
+ * Budget: every sample wake must be back in deep power down within LOGGER_BUDGET_US, counted from the start of main.
+ * The charge per sample is that time at the active current at 2 MHz: at an assumed 250 uA, 1.25 uAs for a 5 ms wake;
+ * at one sample per 15 minutes about 0.03 uAh a day. The duration of the last sample wake is kept in a PMU retained
+ * register, see Logger_GetLastWake, so it can be checked on the board.
+ *
+ * Staging: an EEPROM write blocks the core for the program cycle of the row, and wears the row. The fast path therefore
+ * keeps up to LOGGER_STAGED_MAX samples in the retained register, and writes them to the storage mod together with
+ * the sample of every LOGGER_BATCH-th wake: one row program instead of LOGGER_BATCH. The wakes in between do not touch
+ * the EEPROM at all.
+ * Power loss policy: the retained register survives deep power down, but not a loss of the battery. At most
+ * LOGGER_STAGED_MAX samples - LOGGER_STAGED_MAX * LOGGER_INTERVAL_SECONDS of log - are at risk. When the brown-out
+ * detector trips the staged samples are written at once, and the full wake path writes them in Logger_Flush before
+ * anything else, so the phone always reads a complete log.
+ */
+
+#ifndef LOGGER_H_
+#define LOGGER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Seconds between two samples. Samples are taken at multiples of this interval of the RTC time. */
+#define LOGGER_INTERVAL_SECONDS     (15*60)
+
+/** Longest acceptable sample wake, from the start of main until deep power down, in microseconds. */
+#define LOGGER_BUDGET_US            20000
+
+/** Context of TMeas_Measure for the fast path: App_TmeasCb passes these results to Logger_TmeasCb. */
+#define LOGGER_TMEAS_CONTEXT        2
+
+/** PMU retained register holding the staged samples and the duration of the last sample wake */
+#define LOGGER_RETAINED_WORD        2
+
+/** Samples the retained register can hold: #STORAGE_BITSIZE bits each */
+#define LOGGER_STAGED_MAX           2
+
+/** Wakes per EEPROM write: the staged samples plus the sample of the wake itself */
+#define LOGGER_BATCH                (LOGGER_STAGED_MAX + 1)
+
+/** Seconds until the fast path opens the EEPROM again at the latest, given the seconds to the next wake */
+#define LOGGER_SECONDS_TO_COMMIT(wakeSeconds) ((wakeSeconds) + (LOGGER_BATCH - 1) * LOGGER_INTERVAL_SECONDS)
+
+/**
+ * Layout of the retained register:
+ * - bit 31: a sample wake took longer than #LOGGER_BUDGET_US since the flag was cleared
+ * - bit 30: the last sample wake wrote the EEPROM
+ * - bits 29:24: duration of the last sample wake, in units of LOGGER_RETAINED_WAKE_UNIT_US, saturated
+ * - bits 23:22: number of staged samples
+ * - bits 21:0: the staged samples, the oldest in the least significant bits
+ */
+#define LOGGER_RETAINED_OVER_BUDGET (1u << 31)
+#define LOGGER_RETAINED_COMMITTED   (1u << 30)
+#define LOGGER_RETAINED_WAKE_SHIFT  24
+#define LOGGER_RETAINED_WAKE_MASK   0x3Fu
+#define LOGGER_RETAINED_WAKE_UNIT_US 512
+#define LOGGER_RETAINED_COUNT_SHIFT 22
+#define LOGGER_RETAINED_COUNT_MASK  0x3u
+#define LOGGER_RETAINED_SAMPLE_MASK ((1u << STORAGE_BITSIZE) - 1)
+
+/**
+ * @return Seconds until the next sample is due, 1 up to #LOGGER_INTERVAL_SECONDS.
+ */
+extern uint32_t Logger_SecondsToSample(void);
+
+/**
+ * Appends a sample to the storage mod.
+ * @param value The temperature in deci-Celsius.
+ * @pre The EEPROM and the storage mod are initialized.
+ */
+extern void Logger_Store(int value);
+
+/**
+ * Called by App_TmeasCb with the result of a measurement started with #LOGGER_TMEAS_CONTEXT. Called under interrupt.
+ */
+extern void Logger_TmeasCb(int value);
+
+/**
+ * Forgets the staged samples and the last sample wake. After a power-on reset the retained register holds no data.
+ */
+extern void Logger_Clear(void);
+
+/**
+ * Writes the samples staged by the fast path to the storage mod, oldest first. Must be called on the full wake path
+ * before any new sample is stored.
+ * @pre The EEPROM and the storage mod are initialized.
+ */
+extern void Logger_Flush(void);
+
+/**
+ * The fast path: takes one sample, stages it or stores it with the staged ones, and goes back to deep power down.
+ * To be called first thing in main, after an RTC wake-up when nothing else is due.
+ * @param wakeSeconds Seconds until the RTC wakes the IC again.
+ * @note Does not return.
+ */
+extern void Logger_SampleAndSleep(uint32_t wakeSeconds);
+
+/**
+ * The mean of the samples logged over the last @a seconds.
+ * @param seconds At least #LOGGER_INTERVAL_SECONDS.
+ * @param mean Receives the mean, in deci-Celsius.
+ * @return false if the storage mod holds no sample of that time.
+ * @pre The EEPROM and the storage mod are initialized, Logger_Flush was called.
+ */
+extern bool Logger_GetMean(uint32_t seconds, int *mean);
+
+/**
+ * The last samples logged, for the history graph.
+ * @param samples Receives at most @a max samples in deci-Celsius, oldest first.
+ * @param max The number of samples wanted.
+ * @return The number of samples, less than @a max while the storage mod holds fewer.
+ * @pre The EEPROM and the storage mod are initialized, Logger_Flush was called.
+ */
+extern int Logger_GetLast(int *samples, int max);
+
+/**
+ * @param overBudget Set to true if any sample wake took longer than #LOGGER_BUDGET_US since the flag was cleared.
+ * @param committed Set to true if the last sample wake wrote the EEPROM. May be NULL.
+ * @param clear Clear the over budget flag.
+ * @return The duration of the last sample wake in microseconds, rounded up to #LOGGER_RETAINED_WAKE_UNIT_US;
+ *  0 if none was measured yet.
+ */
+extern uint32_t Logger_GetLastWake(bool *overBudget, bool *committed, bool clear);
+
+#endif /* LOGGER_H_ */
@@ -64,7 +64,26 @@
 #define EE_HEADER_SIZE              (4U)
 #define EE_PAGE_SIZE                (64U)
 
+// EEPROM layout: the temperature history in the first row, the text message from the phone in the second one, the
+// profile table in the third one, the alarms in the fourth one, the drift of the RTC in the fifth one, the time zone
+// in the sixth one
+#define EE_OFFSET_TEXT              (EE_PAGE_SIZE)
+#define EE_TEXT_SIZE                (EE_PAGE_SIZE)   // Including the terminating NUL
+#define EE_OFFSET_PROFILE           (2 * EE_PAGE_SIZE)
+#define EE_OFFSET_ALARM             (3 * EE_PAGE_SIZE)
+#define EE_OFFSET_DRIFT             (4 * EE_PAGE_SIZE)
+#define EE_OFFSET_ZONE              (5 * EE_PAGE_SIZE)
+
 // System alive timing when powered by external, minutes
 #define WAKEUP_MINS                 (2)
 
+// While the display is on, the temperature history graph replaces the clock for the last seconds of every cycle
+#define VIEW_CYCLE_SECONDS          (15)
+#define VIEW_GRAPH_SECONDS          (3)
+
+// PMU retained word 3: header in the upper half, the carry of Drift_Apply in the lower half; bit 0 is free
+#define RETAINED_STATUS_HEADER      (0xAA550000)
+#define RETAINED_STATUS_DRIFT_SHIFT 1           // Bits 15:1, signed, in 1/8 RTCCAL pulse seconds
+#define RETAINED_STATUS_DRIFT_MASK  (0x7FFFu)
+
 #endif
@@ -97,7 +97,20 @@ typedef enum APP_MSG_ID {
      *  100 ms. This second response must be fetched by issuing a command with #MSG_ID_GETRESPONSE.
      * @note asynchronous command
      */
-    APP_MSG_ID_MEASURETEMPERATURE = 0x50
+    APP_MSG_ID_MEASURETEMPERATURE = 0x50,
+
+    /**
+     * @c 0x51 @n
+     * Retrieves the statistics of the cycle probes on the storage, NDEF and msg code, see probe.h.
+     * @param APP_MSG_CMD_GETPROFILE_T
+     * @return #MSG_RESPONSE_RESULTONLY_T if the command could not be handled;
+     *  #APP_MSG_RESPONSE_GETPROFILE_T otherwise.
+     * @note synchronous command
+     * @note Firmware built without probes answers with @c count equal to 0.
+     * @note The same response, msg header included, is added to the NDEF message as a MIME record for the rest of
+     *  the wake after the phone wrote the text "PRB", see probe.h.
+     */
+    APP_MSG_ID_GETPROFILE = 0x51
 } APP_MSG_ID_T;
 
 /* -------------------------------------------------------------------------------- */
@@ -174,6 +187,11 @@ typedef struct APP_MSG_CMD_MEASURETEMPERATURE_S {
     uint8_t resolution; /**< Type: #TSEN_RESOLUTION_T */
 } APP_MSG_CMD_MEASURETEMPERATURE_T;
 
+/** @see APP_MSG_ID_GETPROFILE */
+typedef struct APP_MSG_CMD_GETPROFILE_S {
+    uint8_t reset; /**< If not @c 0, the statistics restart after they are retrieved. */
+} APP_MSG_CMD_GETPROFILE_T;
+
 /* ------------------------------------------------------------------------- */
 
 /** @see APP_MSG_ID_GETMEASUREMENTS */
@@ -277,6 +295,35 @@ typedef struct APP_MSG_RESPONSE_MEASURETEMPERATURE_S {
     int16_t temperature; /**< The measured temperature in deci-Celsius degrees. */
 } APP_MSG_RESPONSE_MEASURETEMPERATURE_T;
 
+/** One probe in #APP_MSG_RESPONSE_GETPROFILE_T. All times are in system clock cycles. */
+typedef struct APP_MSG_PROBE_S {
+    uint32_t count; /**< Calls since the statistics were reset. */
+    uint32_t min; /**< Shortest call; @c 0xFFFFFFFF when @c count is 0. */
+    uint32_t max; /**< Longest call. */
+    uint32_t total; /**< All calls; @c 0xFFFFFFFF when saturated. */
+} APP_MSG_PROBE_T;
+
+/** @see APP_MSG_ID_GETPROFILE */
+typedef struct APP_MSG_RESPONSE_GETPROFILE_S {
+    /**
+     * The command result.
+     * Only when @c result equals #MSG_OK, the contents below this field are valid.
+     */
+    uint32_t result;
+
+    /**
+     * The number of #APP_MSG_PROBE_T that follow, in the order of #PROBE_ID_T: Storage_Write, Storage_Seek,
+     * Storage_Read, MoveSamplesFromEepromToFlash, NDEFT2T_CommitMessage, Msg_HandleCommand, RTC_Ticks2Date,
+     * FormatTemperatures.
+     */
+    uint8_t count;
+
+    /** Padding bytes. Must be @c 0. */
+    uint8_t zero[3];
+
+    //APP_MSG_PROBE_T probe[count];
+} APP_MSG_RESPONSE_GETPROFILE_T;
+
 #pragma pack(pop)
 
 #endif /** @} */
@@ -0,0 +1,87 @@
+/*
+ * probe.h
+ *
+ * Cycle probes on the hot paths of the storage, ndeft2t and msg mods, on the date of the display and on the text of
+ * the NDEF message, to catch a regression before it reaches the field. A probe is a PROBE_BEGIN at the start of a
+ * function, or of a block, and a PROBE_END at its end: the ticks of the free-running 32-bit timer in between are
+ * converted to cycles at the clock level of the end, and added to the calls, minimum, maximum and total of the probe.
+ * Probes of nested functions each count their full time, the cost of a probe itself - some 20 cycles - included. A
+ * probe changing the clock level in between is only approximate.
+ *
+ * app_sel.h includes this file, so the mods see the macros; without it they compile to nothing. The statistics are
+ * read as the response to APP_MSG_ID_GETPROFILE, and printed by tools/probe/probe.py. The msg commands are not routed
+ * from NFC in this firmware, so PROBE_MSG_COMMAND stays at 0 calls: the phone writes "PRB" instead, and the NDEF
+ * message carries the response for the rest of the wake, see main.c.
+ *
+ * All probes run in the main loop, never under interrupt.
+ */
+
+#ifndef PROBE_H_
+#define PROBE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* The probes are in Debug builds only, unless set explicitly */
+#ifndef PROBE
+#if defined(DEBUG)
+#define PROBE               1
+#else
+#define PROBE               0
+#endif
+#endif
+
+typedef enum PROBE_ID {
+    PROBE_STORAGE_WRITE,        /*!< Storage_Write */
+    PROBE_STORAGE_SEEK,         /*!< Storage_Seek */
+    PROBE_STORAGE_READ,         /*!< Storage_Read */
+    PROBE_STORAGE_MOVE,         /*!< MoveSamplesFromEepromToFlash, within Storage_Write */
+    PROBE_NDEF_COMMIT,          /*!< NDEFT2T_CommitMessage */
+    PROBE_MSG_COMMAND,          /*!< Msg_HandleCommand, including the handler */
+    PROBE_RTC_DATE,             /*!< RTC_Ticks2Date, every second of the display */
+    PROBE_NDEF_TEXT,            /*!< FormatTemperatures of main, the text record of the NDEF message */
+    PROBE_COUNT
+} PROBE_ID_T;
+
+/** Bytes of the response to APP_MSG_ID_GETPROFILE, without the msg header, see Probe_GetResponse */
+#define PROBE_RESPONSE_SIZE (8 + (16 * PROBE_COUNT))
+
+/** In system clock cycles */
+typedef struct PROBE_STATS_S {
+    uint32_t count;
+    uint32_t min;               /*!< 0xFFFFFFFF while count is 0 */
+    uint32_t max;
+    uint32_t total;             /*!< Saturates */
+} PROBE_STATS_T;
+
+#if PROBE
+extern uint32_t Timer_GetFreeRunning(void);
+#define PROBE_BEGIN(id)     uint32_t probeStart_##id = Timer_GetFreeRunning()
+#define PROBE_END(id)       Probe_Record(id, Timer_GetFreeRunning() - probeStart_##id)
+#else
+#define PROBE_BEGIN(id)
+#define PROBE_END(id)
+#endif
+
+/**
+ * Adds one call to @a id. Called by PROBE_END.
+ * @param ticks Ticks of Timer_GetFreeRunning.
+ */
+extern void Probe_Record(PROBE_ID_T id, uint32_t ticks);
+
+/**
+ * Retrieves the statistics of all probes.
+ * @param reset If true, all statistics restart from now.
+ */
+extern void Probe_GetStats(PROBE_STATS_T stats[PROBE_COUNT], bool reset);
+
+/**
+ * Writes the statistics of all probes as the response to APP_MSG_ID_GETPROFILE: APP_MSG_RESPONSE_GETPROFILE_T,
+ * followed by one APP_MSG_PROBE_T per probe, none when the firmware is built without probes.
+ * @param buffer At least PROBE_RESPONSE_SIZE bytes.
+ * @param reset If true, all statistics restart after they are retrieved.
+ * @return The number of bytes written.
+ */
+extern int Probe_GetResponse(uint8_t *buffer, bool reset);
+
+#endif /* PROBE_H_ */
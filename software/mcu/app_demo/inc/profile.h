@@ -0,0 +1,118 @@
+/*
+ * profile.h
+ *
+ * Where the charge goes: the time spent in a few regions of the firmware, summed over all full wakes, so the charge per
+ * day of each subsystem can be estimated. tools/profile/profile.py does that, with the current of each region.
+ *
+ * A region is timed between Profile_Enter and Profile_Exit on the free-running 32-bit timer: 1 tick per microsecond,
+ * whatever the clock level. Regions that are timed elsewhere already are added with Profile_Add. The conversions of
+ * TSEN are taken from TMeas_GetStats, the time of the full wake itself from Profile_Init until Profile_Save. A region
+ * may be entered and exited under interrupt, but each region always in the same context, and not nested in itself.
+ * Beside the regions, the LED time of the temperature bar is added with Profile_AddLed: not a region of the firmware,
+ * but the time each LED was lit, see ledbar.h.
+ *
+ * The totals are kept in RAM during the wake, and added to the table in EEPROM row EE_OFFSET_PROFILE by Profile_Save
+ * just before deep power down: the PMU retained registers are all in use. That is one row program per full wake,
+ * which is not in the table itself. The sample wakes of the logger never touch the table; the duration of the last one
+ * is exported alongside it, see Logger_GetLastWake.
+ * The timer wraps after 71 minutes: a full wake must be shorter, as it is on battery.
+ *
+ * The table is exported as one line of text, see Profile_Format: in the NDEF message after the phone wrote "PRF", or
+ * by any other pipe able to send a string.
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Set to 0 to leave out all timing and the row program in DeInit */
+#ifndef PROFILE
+#define PROFILE             1
+#endif
+
+typedef enum PROFILE_REGION {
+    PROFILE_REGION_AWAKE,       /*!< A: the full wake, from Profile_Init until Profile_Save */
+    PROFILE_REGION_SLEEP,       /*!< S: the core sleeping in Event_Dispatch */
+    PROFILE_REGION_DISPLAY,     /*!< D: an OLED_Flush, until its last span was sent over I2C */
+    PROFILE_REGION_EEPROM,      /*!< E: writing the EEPROM, until the row is programmed */
+    PROFILE_REGION_NDEF,        /*!< N: NDEFT2T_CommitMessage */
+    PROFILE_REGION_TSEN,        /*!< T: a temperature conversion, see TMeas_GetStats */
+    PROFILE_REGION_COUNT
+} PROFILE_REGION_T;
+
+/** Unit of the totals in the table; at 64 us a total lasts 3 days before the table is halved */
+#define PROFILE_UNIT_US     64
+
+/** Marks a table written by this firmware */
+#define PROFILE_HEADER      0x50524F02
+
+/** Longest line written by Profile_Format, including the terminating NUL */
+#define PROFILE_FORMAT_SIZE (4 + 10 + 12 + PROFILE_REGION_COUNT * 23 + 12 + 1)
+
+/** The table, as stored in EEPROM */
+typedef struct PROFILE_TABLE_S {
+    uint32_t header;                        /*!< PROFILE_HEADER */
+    uint32_t seconds;                       /*!< RTC seconds covered by the table */
+    uint32_t rtc;                           /*!< RTC time of the last Profile_Save */
+    uint32_t total[PROFILE_REGION_COUNT];   /*!< In PROFILE_UNIT_US */
+    uint32_t count[PROFILE_REGION_COUNT];   /*!< Times the region was exited */
+    uint32_t led;                           /*!< LED time, in PROFILE_UNIT_US of one LED lit */
+} PROFILE_TABLE_T;
+
+/**
+ * Starts the profile of a full wake: the totals start at 0, the time of the wake from now.
+ * @pre Timer_StartFreeRunning was called.
+ */
+extern void Profile_Init(void);
+
+/**
+ * Marks the start of @a region.
+ */
+extern void Profile_Enter(PROFILE_REGION_T region);
+
+/**
+ * Marks the end of @a region, and adds the time since Profile_Enter to it.
+ */
+extern void Profile_Exit(PROFILE_REGION_T region);
+
+/**
+ * Adds time to @a region, measured by the caller.
+ * @param ticks Ticks of Timer_GetFreeRunning.
+ */
+extern void Profile_Add(PROFILE_REGION_T region, uint32_t ticks);
+
+/**
+ * Adds LED time: @a ticks of one LED lit, or as many ticks less per LED lit more. Summed in units at once, as six LEDs
+ * would overflow a sum in ticks within 12 minutes.
+ * @param ticks Ticks of Timer_GetFreeRunning.
+ */
+extern void Profile_AddLed(uint32_t ticks);
+
+/**
+ * Keeps the seconds covered by the table right when the RTC is set.
+ * @param seconds The new RTC time minus the old one.
+ */
+extern void Profile_Shift(int32_t seconds);
+
+/**
+ * Adds the totals of this wake, and the seconds since the previous Profile_Save, to the table in EEPROM. The table
+ * starts anew when it holds no table of this firmware, or when the RTC went back: after a loss of the battery.
+ * When a total would overflow, all totals, counts and seconds are halved: the charge per day stays the same.
+ * To be called once, last thing before deep power down.
+ * @pre The EEPROM is initialized.
+ */
+extern void Profile_Save(void);
+
+/**
+ * Writes the table in EEPROM as one line of text:
+ * @code PROF<seconds> L<last sample wake in us> A<total>/<count> S<total>/<count> D.. E.. N.. T.. B<led> @endcode
+ * with the totals and the LED time in PROFILE_UNIT_US, in the order of PROFILE_REGION_T.
+ * @param buffer At least PROFILE_FORMAT_SIZE bytes.
+ * @return The length of the line, without the terminating NUL.
+ * @pre The EEPROM is initialized.
+ */
+extern int Profile_Format(char *buffer);
+
+#endif /* PROFILE_H_ */
@@ -20,11 +20,19 @@ typedef struct RTC_VALUE_S {
 } RTC_VALUE_T;
 
 /**
- * Convert tick values to Date format.
+ * Convert the RTC time to Date format, the day of the week in WEEKS, 0 is Sunday.
+ * The RTC counts UTC: see RTC_Ticks2Date and zone.h for the local time.
  * @return NULL.
  */
 void RTC_Convert2Date(RTC_VALUE_T *rtc);
 
+/**
+ * Convert a time in seconds since 1970 - UTC, or local time from Zone_ToLocal - to Date format, as RTC_Convert2Date.
+ * Constant time; within the same day only the time of the day is computed again.
+ * @return NULL.
+ */
+void RTC_Ticks2Date(uint32_t ticks, RTC_VALUE_T *rtc);
+
 /**
  * Convert Date format to tick values.
  * @return ticks value.
@@ -11,7 +11,21 @@
 #define __SSD1306__
 
 #include <stdint.h>
+#include <stdbool.h>
 
+#define SSD1306_WIDTH       (128)   // Columns of the panel
+#define SSD1306_PAGES       (8)     // Pages of 8 pixel rows each
+
+/* Set to 1 to count the I2C traffic sent to the panel, see OLED_GetBusStats */
+#ifndef SSD1306_BUS_STATS
+#define SSD1306_BUS_STATS   0
+#endif
+
+/* I2C traffic towards the panel */
+typedef struct {
+    uint32_t transactions;  // Number of start ... stop sequences
+    uint32_t bytes;         // Bytes on the bus, address byte included
+} OLED_BUS_STATS_T;
 
 //API functions
 /**
@@ -20,16 +34,120 @@
  */
 extern void ssd1306_init(void);
 extern void OLED_Fill(uint8_t dat);
+extern void OLED_SetPos(uint8_t x, uint8_t y);
 extern void OLED_Enable(void);
 extern void OLED_Disable(void);
 extern void OLED_ShowStr(uint8_t x, uint8_t y, uint8_t *str);
+extern void OLED_ShowCN(uint8_t x, uint8_t y, uint8_t N);       // 8x16 glyph of character N + 32
 extern void OLED_DrawBMP(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t BMP[]);
-extern void OLED_ShowBat(uint8_t data);
+extern void OLED_ShowBat(uint8_t data);     // 0: full, 1: mid, 2: low, 3: empty
 extern void OLED_ShowTime(uint8_t x, uint8_t y, uint8_t *str);
+extern void OLED_ShowFONT32(uint8_t x, uint8_t y, uint8_t N);   // 16x32 glyph of character N + 32
 extern void OLED_ShowAlarm(uint8_t data);
 
+/**
+ * All OLED_Show and OLED_Draw calls render into a RAM copy of the panel. This sends every changed span of each page
+ * as one burst transaction. Nothing is sent when nothing changed.
+ * The spans are queued on I2C0 and sent under interrupt: this returns immediately. A next draw call sleeps until the
+ * flush has completed.
+ */
+extern void OLED_Flush(void);
+
+/**
+ * @return true while the spans of the last OLED_Flush are still being sent.
+ */
+extern bool OLED_IsFlushing(void);
+
+/**
+ * Sleeps until the last OLED_Flush has completed.
+ */
+extern void OLED_WaitFlush(void);
+
+/**
+ * Blanks pages @a first up to and including @a last in the RAM copy.
+ */
+extern void OLED_ClearPages(uint8_t first, uint8_t last);
+
+/**
+ * Sets a single pixel in the RAM copy. Unlike the OLED_Show functions, @a x is the exact column.
+ * @param x Column, 0 - 127.
+ * @param y Row from the top, 0 - 63; pixels outside the panel are ignored.
+ */
+extern void OLED_DrawPixel(uint8_t x, uint8_t y);
+
+/**
+ * Sets the 8 pixels of one column of one page in the RAM copy. Unlike the OLED_Show functions, @a x is the exact
+ * column; columns and pages outside the panel are ignored.
+ * @param data Bit 0 is the top row of the page.
+ */
+extern void OLED_WriteColumn(uint8_t x, uint8_t page, uint8_t data);
+
+/**
+ * Marks the complete RAM copy as changed, so the next OLED_Flush sends the full frame.
+ */
+extern void OLED_Invalidate(void);
+
+#if SSD1306_BUS_STATS
+/**
+ * Retrieve the I2C traffic sent to the panel since the last reset of the counters.
+ * @param reset If true, the counters are cleared after reading.
+ */
+extern void OLED_GetBusStats(OLED_BUS_STATS_T *stats, bool reset);
+#endif
+
+/* Direction of the panel's continuous horizontal scroll, the value is the setup command */
+typedef enum {
+    OLED_SCROLL_RIGHT = 0x26,
+    OLED_SCROLL_LEFT  = 0x27,
+} OLED_SCROLL_T;
+
+/* Scroll step intervals in frames, as encoded in the scroll setup command */
+#define OLED_SCROLL_FRAMES_2    (7)
+#define OLED_SCROLL_FRAMES_3    (4)
+#define OLED_SCROLL_FRAMES_4    (5)
+#define OLED_SCROLL_FRAMES_5    (0)
+#define OLED_SCROLL_FRAMES_25   (6)
+#define OLED_SCROLL_FRAMES_64   (1)
+#define OLED_SCROLL_FRAMES_128  (2)
+#define OLED_SCROLL_FRAMES_256  (3)
+
+/**
+ * Lets the panel rotate pages @a firstPage up to and including @a lastPage by one column every @a interval frames,
+ * without any further bus traffic. Their content must have been sent with OLED_Flush before.
+ * While scrolling, drawing into these pages only updates the RAM copy; it is sent after OLED_ScrollStop.
+ * Other pages can be drawn and flushed as usual.
+ * @param interval One of OLED_SCROLL_FRAMES_x.
+ */
+extern void OLED_ScrollStart(uint8_t firstPage, uint8_t lastPage, OLED_SCROLL_T dir, uint8_t interval);
+
+/**
+ * Stops the scroll. The scrolled pages are left shifted on the panel, so the next OLED_Flush sends them again.
+ */
+extern void OLED_ScrollStop(void);
+
+/**
+ * @return true between OLED_ScrollStart and OLED_ScrollStop.
+ */
+extern bool OLED_IsScrolling(void);
+
+/* Contrast and pre-charge period set by ssd1306_init */
+#define OLED_CONTRAST_INIT      (0xFF)
+#define OLED_PRECHARGE_INIT     (0x22)  // Phase 1 and phase 2 of 2 display clocks each
+
+/**
+ * Sets the panel contrast and pre-charge period; nothing is sent if the panel already has these.
+ * The segment current, and with it most of the panel's supply current, scales with the contrast.
+ * @param contrast 0x00 - 0xFF.
+ * @param precharge Phase 2 in the high nibble, phase 1 in the low nibble, in display clocks of 1 - 15 each.
+ */
+extern void OLED_SetBrightness(uint8_t contrast, uint8_t precharge);
+
+/**
+ * Cuts the supply of the panel, after any ongoing flush has completed. Configuration and GDDRAM are lost: the panel is
+ * brought up again with ssd1306_init. Deep Power Down tri-states the supply enable anyway, so a sleep of the
+ * controller with its frame kept would not survive until the next wake-up.
+ */
 extern void oled_lpw_enter(void);
-extern void oled_lpw_exit(void);
 
 #endif
 
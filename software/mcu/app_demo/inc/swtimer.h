@@ -0,0 +1,70 @@
+/*
+ * swtimer.h
+ *
+ * Software timers on the single RTC wake-up counter. Any number of one-shot and periodic timers can be pending; they
+ * are kept in a list sorted by deadline, and the wake-up counter is programmed for the nearest deadline only. The IC
+ * thus wakes when work is due, not every second.
+ *
+ * Deadlines are whole seconds of the RTC. The timers are owned by the caller and are linked into the list while
+ * running, so they must stay valid until they expire or are stopped: use static storage.
+ * All functions are to be called from the main loop, never under interrupt. RTC_IRQHandler only posts EVENT_TICK;
+ * its handler must call #SwTimer_Run.
+ */
+
+#ifndef SWTIMER_H_
+#define SWTIMER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Largest delay the wake-up counter can count, in seconds: its reload value has 24 bits. */
+#define SWTIMER_MAX_SECONDS     0x00FFFFFF
+
+typedef void (*SWTIMER_CB_T)(void);
+
+typedef struct SWTIMER_S {
+    struct SWTIMER_S   *pNext;      /*!< Private: next in the list */
+    uint32_t            deadline;   /*!< Private: RTC time of the next expiry */
+    uint32_t            period;     /*!< Private: seconds between expiries, 0 for a one-shot timer */
+    SWTIMER_CB_T        cb;         /*!< Private: called on expiry */
+    bool                running;    /*!< Private: linked in the list */
+} SWTIMER_T;
+
+/**
+ * Starts a timer, or restarts it when it is running already.
+ * @param timer The timer to start.
+ * @param seconds Seconds from now until the first expiry. 0 expires it at the next call to #SwTimer_Run.
+ * @param period Seconds between expiries after the first, or 0 for a one-shot timer.
+ * @param cb Called from #SwTimer_Run on each expiry. It may start and stop any timer, its own included.
+ */
+extern void SwTimer_Start(SWTIMER_T *timer, uint32_t seconds, uint32_t period, SWTIMER_CB_T cb);
+
+/**
+ * Stops a timer. Nothing happens if it is not running.
+ */
+extern void SwTimer_Stop(SWTIMER_T *timer);
+
+/**
+ * @return true when the timer is running: it will expire (again).
+ */
+extern bool SwTimer_IsRunning(const SWTIMER_T *timer);
+
+/**
+ * @return Seconds until the timer expires, 0 when it is due or not running.
+ */
+extern uint32_t SwTimer_Remaining(const SWTIMER_T *timer);
+
+/**
+ * Moves all deadlines, to keep the running timers where they were after the RTC was set.
+ * @param delta The new RTC time minus the old.
+ */
+extern void SwTimer_Shift(int32_t delta);
+
+/**
+ * Calls the callbacks of all expired timers, in order of deadline, restarts the periodic ones, and programs the
+ * wake-up counter for the nearest deadline left. Periods missed meanwhile are skipped, not caught up.
+ * With no timer running, the wake-up counter is stopped.
+ */
+extern void SwTimer_Run(void);
+
+#endif /* SWTIMER_H_ */
@@ -0,0 +1,50 @@
+/*
+ * textscroll.h
+ *
+ * Text message sent from the phone, shown in place of the date line when g_TextModeFlag is set.
+ * The message is sent to the panel one screen at a time, after which the panel scrolls it by itself: while a screen
+ * is shown there is no bus traffic and no work for this side.
+ */
+
+#ifndef TEXTSCROLL_H_
+#define TEXTSCROLL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+/** The longest message kept */
+#define TEXTSCROLL_MAX_LENGTH   ((int)EE_TEXT_SIZE - 1)
+
+/**
+ * Stores a new message in EEPROM. Copying stops at the first character that is not printable ASCII.
+ * @param text The message as received, not necessarily NUL terminated.
+ * @param max The maximum number of characters to take from @a text.
+ * @return The length of the stored message; 0 means the message was cleared.
+ */
+extern int TextScroll_Set(const uint8_t *text, int max);
+
+/**
+ * Reads the stored message from EEPROM.
+ * @return The length of the message; 0 if there is none.
+ */
+extern int TextScroll_Load(void);
+
+/**
+ * Draws the first screen of the message, sends it and lets the panel scroll it.
+ * @pre The panel is on.
+ */
+extern void TextScroll_Start(void);
+
+/**
+ * To be called once per second while the message is shown. A message longer than one screen gets its next screen
+ * paged in after the panel has scrolled the current one around once.
+ */
+extern void TextScroll_Tick(void);
+
+/**
+ * Stops the scroll and blanks the message line, ready for the date.
+ */
+extern void TextScroll_Stop(void);
+
+#endif /* TEXTSCROLL_H_ */
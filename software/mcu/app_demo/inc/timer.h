@@ -79,15 +79,21 @@ bool Timer_CheckMeasurementTimeout(void);
 
 /* -------------------------------------------------------------------------------- */
 
+/** Rate of the 32-bit timer: its prescaler is set for the system clock, so 1 tick is 1 microsecond at any clock. */
+#define TIMER_TICK_HZ (1000 * 1000)
+
 /**
  * Starts a timer.
- * @note The 32-bit timer is used, without setting any interrupts. It will run as fast as possible.
+ * @note The 32-bit timer is used, without setting any interrupts, except the match registers used by
+ *  #Timer_Delay_us and #Timer_StartCallback. It counts #TIMER_TICK_HZ, and wraps around after 71 minutes. Differences
+ *  of two readings are valid across a wrap.
+ * @pre The system clock is a multiple of #TIMER_TICK_HZ.
  */
 void Timer_StartFreeRunning(void);
 
 /**
  * Stops the 32-bit timer.
- * @post A call to #Timer_GetFreeRunning will now return ??
+ * @post A call to #Timer_GetFreeRunning will now return 0.
  */
 void Timer_StopFreeRunning(void);
 
@@ -98,5 +104,54 @@ void Timer_StopFreeRunning(void);
  */
 uint32_t Timer_GetFreeRunning(void);
 
+/**
+ * Keeps the 32-bit timer at #TIMER_TICK_HZ for a new system clock. Called by the clock governor around a switch.
+ * @param frequency The system clock in Hz, a multiple of #TIMER_TICK_HZ.
+ */
+void Timer_SetClock(uint32_t frequency);
+
+/* -------------------------------------------------------------------------------- */
+
+/**
+ * Waits with the core asleep, instead of spinning: the first match register of the 32-bit timer wakes it at the
+ * deadline. Interrupts are handled meanwhile, as usual.
+ * The timer counts #TIMER_TICK_HZ at any system clock, so the clock may change during the delay.
+ * @param us The delay in microseconds. Waits at least this long.
+ * @note When the free running timer is not started, it is started for the delay and stopped again afterwards.
+ * @note Not to be called under interrupt.
+ * @note At most 71 minutes.
+ */
+void Timer_Delay_us(uint32_t us);
+
+/**
+ * As #Timer_Delay_us, in milliseconds.
+ * @param ms The delay in milliseconds.
+ */
+void Timer_Delay_ms(uint32_t ms);
+
+/* -------------------------------------------------------------------------------- */
+
+/**
+ * Called under interrupt by the 32-bit timer.
+ * @return The ticks until the next call, counted from the previous deadline and not from now, so a periodic callback
+ *  does not drift by the latency of the interrupt. 0 to stop.
+ */
+typedef uint32_t (*TIMER_CALLBACK_T)(void);
+
+/**
+ * Calls @a callback after @a ticks, and then as it returns: on the second match register of the 32-bit timer, beside
+ * a delay. A deadline that passed already, e.g. after a long interrupt, is moved to just after now.
+ * Replaces the callback of an earlier call.
+ * @param ticks Ticks of #TIMER_TICK_HZ, at least 1.
+ * @pre #Timer_StartFreeRunning was called.
+ */
+void Timer_StartCallback(uint32_t ticks, TIMER_CALLBACK_T callback);
+
+/**
+ * Stops the callback of #Timer_StartCallback.
+ * @post The callback is not running, and will not be called anymore.
+ */
+void Timer_StopCallback(void);
+
 
 #endif
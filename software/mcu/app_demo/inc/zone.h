@@ -0,0 +1,76 @@
+/*
+ * zone.h
+ *
+ * The time zone: the RTC counts UTC, the log and the timers run on it, and only what is shown - the clock face, the
+ * brightness of the night, the alarms - is local time. A zone is a standard offset from UTC plus, optionally, daylight
+ * saving time between two rules of the kind "the last Sunday of March at 02:00", as the M format of POSIX TZ:
+ * CET-1CEST,M3.5.0,M10.5.0/3 is {60, 60, {3, 5, 0, 0, 120}, {10, 5, 0, 0, 180}}. The time of a rule is local time as
+ * it is before the change: standard time for the start, daylight time for the end. Where the end comes before the
+ * start in the year, as south of the equator, daylight time spans the new year.
+ *
+ * Zone_ToLocal keeps the offset in effect and the UTC times of the transitions before and after it: per call that is
+ * two comparisons and an addition. Only a time outside that span - after a transition, or after the RTC was set -
+ * looks up the transitions again, which takes a few divisions. The zone is kept in EEPROM row EE_OFFSET_ZONE; before
+ * one is set the offset is 0, and the RTC holds local time as it did before zones existed.
+ */
+
+#ifndef ZONE_H_
+#define ZONE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Bounds of ZONE_T.offset and ZONE_T.save, in minutes */
+#define ZONE_MIN_OFFSET     (-12 * 60)
+#define ZONE_MAX_OFFSET     (14 * 60)
+#define ZONE_MAX_SAVE       (2 * 60)
+
+/** Week of a rule for the last one of the month */
+#define ZONE_LAST_WEEK      5
+
+/** A transition: the @a week-th @a weekday of @a month, at @a minute past midnight */
+typedef struct ZONE_RULE_S {
+    uint8_t month;          /*!< 1 - 12 */
+    uint8_t week;           /*!< 1 - 4, or ZONE_LAST_WEEK */
+    uint8_t weekday;        /*!< 0 is Sunday */
+    uint8_t reserved;
+    uint16_t minute;        /*!< Up to 48 hours: 24:00 is midnight at the end of that day */
+} ZONE_RULE_T;
+
+typedef struct ZONE_S {
+    int16_t offset;         /*!< Standard time minus UTC, in minutes */
+    int16_t save;           /*!< Added during daylight saving time, in minutes; 0 when the zone has none */
+    ZONE_RULE_T start;      /*!< Start of daylight saving time, in standard time; not used when save is 0 */
+    ZONE_RULE_T end;        /*!< End of daylight saving time, in daylight time; not used when save is 0 */
+} ZONE_T;
+
+/**
+ * Reads the zone from EEPROM.
+ * @pre The EEPROM is initialized.
+ */
+extern void Zone_Load(void);
+
+/**
+ * Replaces the zone, and writes it to EEPROM if it changed.
+ * @return false, and the zone is left as it was, when @a zone is out of the bounds above.
+ * @pre The EEPROM is initialized.
+ */
+extern bool Zone_Set(const ZONE_T *zone);
+
+extern void Zone_Get(ZONE_T *zone);
+
+/**
+ * @param utc A time of the RTC.
+ * @return The local time at @a utc.
+ */
+extern uint32_t Zone_ToLocal(uint32_t utc);
+
+/**
+ * The inverse of Zone_ToLocal. A local time that occurs twice, in the hour the clock is set back, gives the first UTC
+ * time; one that does not occur, in the hour the clock skips, is taken for standard time.
+ * @param local A local time.
+ * @return The RTC time at which the local time is @a local.
+ */
+extern uint32_t Zone_ToUtc(uint32_t local);
+
+#endif /* ZONE_H_ */
@@ -18,23 +18,26 @@
 #define SW_MINOR_VERSION 11
 
 #define MSG_APP_HANDLERS App_CmdHandler
-#define MSG_APP_HANDLERS_COUNT 4U
+#define MSG_APP_HANDLERS_COUNT 5U
 #define MSG_RESPONSE_BUFFER_SIZE 20 /**< A value large enough to store #APP_MSG_RESPONSE_MEASURETEMPERATURE_T - nothing else is buffered. */
 #define MSG_RESPONSE_BUFFER App_ResponseBuffer
 #define MSG_ENABLE_PREPAREDEBUG 1
 #define MSG_ENABLE_GETUID 1
 
 #define TMEAS_CB App_TmeasCb
+#define TMEAS_TIMESTAMP Timer_GetFreeRunning /**< 1 us per tick, see TIMER_TICK_HZ */
 
 #define NDEFT2T_EEPROM_COPY_SUPPPORT 0
 #define NDEFT2T_FIELD_STATUS_CB NDEFT2T_FieldStatus_Cb
 #define NDEFT2T_MSG_AVAILABLE_CB NDEFT2T_MsgAvailable_Cb
 
-//#define STORAGE_TYPE int16_t
-//#define STORAGE_BITSIZE 11 /**< round_up(log_2(2 * APP_MSG_MAX_TEMPERATURE)) */
-//#define STORAGE_SIGNED 1
+#define STORAGE_TYPE int16_t
+#define STORAGE_BITSIZE 11 /**< round_up(log_2(2 * APP_MSG_MAX_TEMPERATURE)) */
+#define STORAGE_SIGNED 1
 //#define STORAGE_EEPROM_FIRST_ROW (EEPROM_NR_OF_RW_ROWS - 3*16)
 //#define STORAGE_COMPRESS_CB App_CompressCb
 //#define STORAGE_DECOMPRESS_CB App_DecompressCb
 
+#include "probe.h" /**< PROBE_BEGIN and PROBE_END in the storage, ndeft2t and msg mods */
+
 #endif
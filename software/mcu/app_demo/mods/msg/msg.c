@@ -18,6 +18,12 @@
 #include "chip.h"
 #include "msg/msg.h"
 
+/* Cycle probes, only when the application provides them */
+#ifndef PROBE_BEGIN
+#define PROBE_BEGIN(id)
+#define PROBE_END(id)
+#endif
+
 /* -------------------------------------------------------------------------
  * Types & defines
  * ------------------------------------------------------------------------- */
@@ -470,6 +476,7 @@ void Msg_AddResponse(uint8_t msgId, int payloadLen, const uint8_t* pPayload)
 
 void Msg_HandleCommand(int cmdLength, const uint8_t* pCmdData)
 {
+    PROBE_BEGIN(PROBE_MSG_COMMAND);
     if ((cmdLength < MSG_HEADER_SIZE) || (pCmdData == NULL)) {
         ASSERT(false);
     }
@@ -514,4 +521,5 @@ void Msg_HandleCommand(int cmdLength, const uint8_t* pCmdData)
             Msg_AddResponse(msgId, responseLength, (uint8_t*)&response);
         }
     }
+    PROBE_END(PROBE_MSG_COMMAND);
 }
@@ -15,6 +15,12 @@
 #include "chip.h"
 #include "ndeft2t/ndeft2t.h"
 
+/* Cycle probes, only when the application provides them */
+#ifndef PROBE_BEGIN
+#define PROBE_BEGIN(id)
+#define PROBE_END(id)
+#endif
+
 /* -------------------------------------------------------------------------
  * Private types and enumerations
  * ------------------------------------------------------------------------- */
@@ -160,6 +166,7 @@ static bool CreateRecord(void *pInstance, const NDEFT2T_CREATE_RECORD_INFO_T *pR
                                  NDEFT2T_RECORD_TYPE_T type, NDEFT2T_TNF_T tnf, int hdrLen, bool typeStringPresent);
 static uint8_t* DecodeNdefTlv(int *lenTlv);
 static bool ValidateNdefMsg(void *pInstance);
+static bool CommitMessage(void *pInstance);
 #if NDEFT2T_EEPROM_COPY_SUPPPORT == 1
     static void CopyFromEeprom(uint8_t *pDst, const void * pSrc, int size);
 #endif /*NDEFT2T_EEPROM_COPY_SUPPPORT*/
@@ -352,6 +359,15 @@ void NDEFT2T_CommitRecord(void *pInstance)
 
 /** Commits message by finalising the message header. */
 bool NDEFT2T_CommitMessage(void *pInstance)
+{
+    PROBE_BEGIN(PROBE_NDEF_COMMIT);
+    bool success = CommitMessage(pInstance);
+    PROBE_END(PROBE_NDEF_COMMIT);
+    return success;
+}
+
+/** The body of NDEFT2T_CommitMessage, which only adds the probe */
+static bool CommitMessage(void *pInstance)
 {
     NDEFT2T_INSTANCE_T *pInst = (NDEFT2T_INSTANCE_T *)pInstance;
     uint32_t *pCursor;
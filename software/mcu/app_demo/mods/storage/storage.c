@@ -14,6 +14,12 @@
 #include <string.h>
 #include "storage.h"
 
+/* Cycle probes, only when the application provides them */
+#ifndef PROBE_BEGIN
+#define PROBE_BEGIN(id)
+#define PROBE_END(id)
+#endif
+
 /**
  * @file
  *
@@ -922,6 +928,7 @@ static void WriteToFlash(const int pageCursor, const void * pData, const int pag
  */
 static bool MoveSamplesFromEepromToFlash(void)
 {
+    PROBE_BEGIN(PROBE_STORAGE_MOVE);
     bool success;
     uint8_t * pOut = STORAGE_WORKAREA;
 
@@ -1018,6 +1025,7 @@ static bool MoveSamplesFromEepromToFlash(void)
         sInstance.flashByteCursor = newFlashByteCursor;
     }
 
+    PROBE_END(PROBE_STORAGE_MOVE);
     return success;
 }
 
@@ -1217,6 +1225,7 @@ void Storage_Reset(bool checkAll)
 
 int Storage_Write(STORAGE_TYPE * samples, int n)
 {
+    PROBE_BEGIN(PROBE_STORAGE_WRITE);
     int count = 0;
     ASSERT(samples != NULL);
 
@@ -1250,11 +1259,13 @@ int Storage_Write(STORAGE_TYPE * samples, int n)
     }
 
     sBitCursorChanged |= (count > 0);
+    PROBE_END(PROBE_STORAGE_WRITE);
     return count;
 }
 
 bool Storage_Seek(int n)
 {
+    PROBE_BEGIN(PROBE_STORAGE_SEEK);
     int currentSequence;
     int currentCursor;
     int nextSequence;
@@ -1308,11 +1319,13 @@ bool Storage_Seek(int n)
     }
     sInstance.targetSequence = n;
 
+    PROBE_END(PROBE_STORAGE_SEEK);
     return sInstance.readSequence >= 0;
 }
 
 int Storage_Read(STORAGE_TYPE * samples, int n)
 {
+    PROBE_BEGIN(PROBE_STORAGE_READ);
     int count = 0;
     ASSERT(samples != NULL);
 
@@ -1369,5 +1382,6 @@ int Storage_Read(STORAGE_TYPE * samples, int n)
         samples[i] = (STORAGE_TYPE)((STORAGE_TYPE)(samples[i] << msbits) >> msbits);
     }
 #endif
+    PROBE_END(PROBE_STORAGE_READ);
     return count;
 }
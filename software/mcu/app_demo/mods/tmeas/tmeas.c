@@ -23,6 +23,13 @@
  * ------------------------------------------------------------------------- */
 
 static int Convert(TMEAS_FORMAT_T format, int input);
+#if defined(TMEAS_CB)
+static int ToNative(TMEAS_FORMAT_T format, int value);
+static void EndWatch(bool force);
+#endif
+#if defined(TMEAS_TIMESTAMP)
+static void Record(TSEN_RESOLUTION_T resolution, uint32_t latency, uint32_t active);
+#endif
 
 /* -------------------------------------------------------------------------
  * Private variables
@@ -32,6 +39,17 @@ static volatile bool sMeasurementInProgress = false;
 #if defined(TMEAS_CB)
 static volatile TMEAS_FORMAT_T sFormat;
 static volatile uint32_t sContext;
+/** The ongoing conversion was started by TMeas_Watch: it only interrupts on an excursion. */
+static volatile bool sWatching = false;
+#endif
+
+#if defined(TMEAS_TIMESTAMP)
+extern uint32_t TMEAS_TIMESTAMP(void);
+static TMEAS_STATS_T sStats[TMEAS_RESOLUTION_COUNT];
+/** When the ongoing conversion was started */
+static volatile uint32_t sStart;
+/** Time spent starting the ongoing conversion */
+static volatile uint32_t sActive;
 #endif
 
 /* -------------------------------------------------------------------------
@@ -41,21 +59,35 @@ static volatile uint32_t sContext;
 #if defined(TMEAS_CB)
 void TSEN_IRQHandler(void)
 {
+#if defined(TMEAS_TIMESTAMP)
+    uint32_t entry = TMEAS_TIMESTAMP();
+    uint32_t exit;
+#endif
     /* If interrupt is reached, we can safely deduct that the RDY bit was set and therefore the
      * TSEN_STATUS_MEASUREMENT_SUCCESS status bit is set. The remaining (RANGE) status bits, even when set, should not
      * invalidate the temperature measurement,
      * hence we can always assume that, at this moment, the value present in the TSEN Value register is always valid.
+     * For a conversion of TMeas_Watch, a threshold interrupt likewise is only raised once the value is known.
      */
     /* Measurement ready. Read the data (thereby also clearing the interrupt). */
+    TSEN_RESOLUTION_T resolution = Chip_TSen_GetResolution(NSS_TSEN);
     int value = Chip_TSen_GetValue(NSS_TSEN);
     int output = Convert(sFormat, value);
+    if (sWatching) {
+        Chip_TSen_Int_ClearRawStatus(NSS_TSEN, TSEN_INT_THRESHOLD_LOW | TSEN_INT_THRESHOLD_HIGH);
+        sWatching = false;
+    }
     NVIC_DisableIRQ(TSEN_IRQn);
     Chip_TSen_DeInit(NSS_TSEN);
     {
         extern void TMEAS_CB(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, uint32_t context);
-        TMEAS_CB(Chip_TSen_GetResolution(NSS_TSEN), sFormat, output, sContext);
+        TMEAS_CB(resolution, sFormat, output, sContext);
     }
     sMeasurementInProgress = false;
+#if defined(TMEAS_TIMESTAMP)
+    exit = TMEAS_TIMESTAMP();
+    Record(resolution, exit - sStart, sActive + (exit - entry));
+#endif
 }
 #endif
 
@@ -105,6 +137,75 @@ static int Convert(TMEAS_FORMAT_T format, int input)
     return output;
 }
 
+#if defined(TMEAS_CB)
+/* The inverse of Convert: the thresholds are compared in HW against the uncorrected native value. */
+static int ToNative(TMEAS_FORMAT_T format, int value)
+{
+    int native;
+
+    switch (format) {
+#if TMEAS_KELVIN
+        case TMEAS_FORMAT_KELVIN:
+            native = Chip_TSen_KelvinToNative(value, 10);
+            break;
+#endif
+#if TMEAS_CELSIUS
+        case TMEAS_FORMAT_CELSIUS:
+            native = Chip_TSen_CelsiusToNative(value, 10);
+            break;
+#endif
+#if TMEAS_FAHRENHEIT
+        case TMEAS_FORMAT_FAHRENHEIT:
+            native = Chip_TSen_FahrenheitToNative(value, 10);
+            break;
+#endif
+        default:
+        case TMEAS_FORMAT_NATIVE:
+            native = value;
+            break;
+    }
+#if TMEAS_SENSOR_CORRECTION
+    /* N' = N - N/128 + 137, see Convert */
+    native = ((native - 137) * 128) / 127;
+#endif
+    return native;
+}
+
+/* Ends a conversion of TMeas_Watch. Unless @a force, only when it is complete and within the limits: when it is
+ * outside, TSEN_IRQHandler reports it.
+ */
+static void EndWatch(bool force)
+{
+    __disable_irq();
+    if (sWatching && (force
+            || (!(Chip_TSen_ReadStatus(NSS_TSEN, NULL) & TSEN_STATUS_SENSOR_IN_OPERATION)
+                && !(Chip_TSen_Int_GetRawStatus(NSS_TSEN) & (TSEN_INT_THRESHOLD_LOW | TSEN_INT_THRESHOLD_HIGH))))) {
+        NVIC_DisableIRQ(TSEN_IRQn);
+        Chip_TSen_DeInit(NSS_TSEN);
+        sWatching = false;
+        sMeasurementInProgress = false;
+    }
+    __enable_irq();
+}
+#endif
+
+#if defined(TMEAS_TIMESTAMP)
+static void Record(TSEN_RESOLUTION_T resolution, uint32_t latency, uint32_t active)
+{
+    TMEAS_STATS_T *stats = &sStats[resolution % TMEAS_RESOLUTION_COUNT];
+
+    stats->count++;
+    stats->latency += latency;
+    if (latency > stats->maxLatency) {
+        stats->maxLatency = latency;
+    }
+    stats->active += active;
+    if (active > stats->maxActive) {
+        stats->maxActive = active;
+    }
+}
+#endif
+
 /* -------------------------------------------------------------------------
  * Exported functions
  * ------------------------------------------------------------------------- */
@@ -115,6 +216,11 @@ int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool sync
     /* gracefully do nothing and avoid compiler warnings */
     (void)synchronous;
     (void)context;
+#else
+    EndWatch(false);
+#endif
+#if defined(TMEAS_TIMESTAMP)
+    uint32_t entry = TMEAS_TIMESTAMP();
 #endif
     int output = TMEAS_ERROR;
     if (!sMeasurementInProgress) {
@@ -132,6 +238,10 @@ int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool sync
 #endif
         output = TMEAS_ERROR;
 
+#if defined(TMEAS_TIMESTAMP)
+        sStart = TMEAS_TIMESTAMP();
+        sActive = sStart - entry;
+#endif
         Chip_TSen_Start(NSS_TSEN);
 #if defined(TMEAS_CB)
         if (synchronous)
@@ -147,14 +257,99 @@ int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool sync
             NVIC_DisableIRQ(TSEN_IRQn);
             Chip_TSen_DeInit(NSS_TSEN);
             sMeasurementInProgress = false;
+#if defined(TMEAS_TIMESTAMP)
+            {
+                uint32_t exit = TMEAS_TIMESTAMP();
+                Record(resolution, exit - sStart, exit - entry);
+            }
+#endif
         }
 #if defined(TMEAS_CB)
         else {
             output = 0;
             /* sMeasurementInProgress is set to false in TSEN_IRQHandler */
+#if defined(TMEAS_TIMESTAMP)
+            sActive += TMEAS_TIMESTAMP() - sStart;
+#endif
         }
 #endif
     }
 
     return output;
 }
+
+void TMeas_Wait(void)
+{
+#if defined(TMEAS_CB)
+    /* Same masked check-then-sleep as the application's event loop: the interrupt cannot be missed */
+    __disable_irq();
+    while (sMeasurementInProgress && !sWatching) {
+        Chip_PMU_PowerMode_EnterSleep();
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+#endif
+}
+
+int TMeas_Watch(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int low, int high, uint32_t context)
+{
+#if defined(TMEAS_CB)
+#if defined(TMEAS_TIMESTAMP)
+    uint32_t entry = TMEAS_TIMESTAMP();
+#endif
+    EndWatch(false);
+    if (sMeasurementInProgress) {
+        return TMEAS_ERROR;
+    }
+    sMeasurementInProgress = true;
+    sWatching = true;
+    sFormat = format;
+    sContext = context;
+
+    Chip_TSen_Init(NSS_TSEN);
+    Chip_TSen_SetResolution(NSS_TSEN, resolution);
+    Chip_TSen_Int_SetThresholdLow(NSS_TSEN, ToNative(format, low));
+    Chip_TSen_Int_SetThresholdHigh(NSS_TSEN, ToNative(format, high));
+    Chip_TSen_Int_ClearRawStatus(NSS_TSEN, TSEN_INT_ALL);
+    Chip_TSen_Int_SetEnabledMask(NSS_TSEN, TSEN_INT_THRESHOLD_LOW | TSEN_INT_THRESHOLD_HIGH);
+    NVIC_EnableIRQ(TSEN_IRQn);
+#if defined(TMEAS_TIMESTAMP)
+    sStart = TMEAS_TIMESTAMP();
+    sActive = sStart - entry;
+#endif
+    Chip_TSen_Start(NSS_TSEN);
+    return 0;
+#else
+    /* gracefully do nothing and avoid compiler warnings */
+    (void)resolution;
+    (void)format;
+    (void)low;
+    (void)high;
+    (void)context;
+    return TMEAS_ERROR;
+#endif
+}
+
+void TMeas_StopWatch(void)
+{
+#if defined(TMEAS_CB)
+    EndWatch(true);
+#endif
+}
+
+void TMeas_GetStats(TSEN_RESOLUTION_T resolution, TMEAS_STATS_T *pStats, bool reset)
+{
+#if defined(TMEAS_TIMESTAMP)
+    __disable_irq();
+    *pStats = sStats[resolution % TMEAS_RESOLUTION_COUNT];
+    if (reset) {
+        memset(&sStats[resolution % TMEAS_RESOLUTION_COUNT], 0, sizeof(TMEAS_STATS_T));
+    }
+    __enable_irq();
+#else
+    (void)resolution;
+    (void)reset;
+    memset(pStats, 0, sizeof(TMEAS_STATS_T));
+#endif
+}
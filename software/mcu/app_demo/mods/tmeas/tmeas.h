@@ -43,6 +43,12 @@
  *  Main code:
  *  @snippet tmeas_mod_example_2.c tmeas_mod_example_2
  *
+ *  @par Watching the temperature
+ *  The TSEN HW block has no continuous mode: each conversion is started by software. #TMeas_Watch starts a conversion
+ *  that compares its result against a low and a high threshold in HW, and only interrupts - and calls the callback -
+ *  when the temperature is outside the limits. A conversion within the limits does not wake the core at all; the
+ *  next call to this mod ends it.
+ *
  * @{
  */
 
@@ -82,6 +88,22 @@ typedef enum TMEAS_FORMAT {
  */
 typedef void (*pTMeas_Cb_t)(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, uint32_t context);
 
+/** Number of possible values of #TSEN_RESOLUTION_T, the index in the statistics of #TMeas_GetStats */
+#define TMEAS_RESOLUTION_COUNT 8
+
+/**
+ * Timing of the measurements taken at one resolution, in the unit of @c TMEAS_TIMESTAMP: microseconds.
+ * @see TMeas_GetStats
+ */
+typedef struct TMEAS_STATS_S {
+    uint32_t count; /*!< Measurements completed */
+    uint32_t latency; /*!< Sum over all measurements: from the start of the conversion until the result was reported */
+    uint32_t maxLatency; /*!< Longest latency of a single measurement */
+    uint32_t active; /*!< Sum over all measurements: the core ran this mod's code, starting and ending the conversion.
+                          For a synchronous measurement, the whole latency. */
+    uint32_t maxActive; /*!< Longest active time of a single measurement */
+} TMEAS_STATS_T;
+
 /* -------------------------------------------------------------------------
  * Exported function prototypes
  * ------------------------------------------------------------------------- */
@@ -110,4 +132,47 @@ typedef void (*pTMeas_Cb_t)(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format,
  */
 int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool synchronous, uint32_t context);
 
+/**
+ * Sleeps until the asynchronous measurement started by #TMeas_Measure has been reported. Returns immediately when no
+ * such measurement is ongoing.
+ * Instead of spinning on the TSEN status, the core sleeps during the conversion; interrupts are handled meanwhile.
+ * @note Does nothing when @c TMEAS_CB is not defined.
+ * @note Does not wait for a conversion started by #TMeas_Watch: it may not interrupt at all.
+ */
+void TMeas_Wait(void);
+
+/**
+ * Starts one conversion that is only reported when the temperature is outside the given limits.
+ * The limits are programmed in the thresholds of the TSEN HW block, which then only raises its interrupt on an
+ * excursion. Call this again periodically to keep watching.
+ * @param resolution : The required resolution.
+ * @param format : The format of @c low and @c high, and of the reported value.
+ * @param low : The temperature is reported when it is below this value.
+ * @param high : The temperature is reported when it is above this value.
+ * @param context : As for #TMeas_Measure.
+ * @return
+ *   - #TMEAS_ERROR when the TSEN HW block is in use, or when @c TMEAS_CB is not defined.
+ *   - Else @c 0: @c TMEAS_CB will be called under interrupt when the result is outside the limits.
+ *   .
+ * @note The conversion keeps the TSEN HW block powered when the result is within the limits, until the next call to
+ *  #TMeas_Measure, #TMeas_Watch or #TMeas_StopWatch.
+ */
+int TMeas_Watch(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int low, int high, uint32_t context);
+
+/**
+ * Ends a conversion started by #TMeas_Watch, and powers down the TSEN HW block.
+ * @note Nothing happens when #TMeas_Watch was not called.
+ */
+void TMeas_StopWatch(void);
+
+/**
+ * Retrieves the timing of the measurements at one resolution.
+ * @param resolution : The resolution to report.
+ * @param [out] pStats : Filled with the statistics since they were last reset; all zero when @c TMEAS_TIMESTAMP is
+ *  not defined.
+ * @param reset : Set to @c true to start counting from zero for this resolution.
+ * @note The conversions of #TMeas_Watch that stay within the limits are not counted: they are never reported.
+ */
+void TMeas_GetStats(TSEN_RESOLUTION_T resolution, TMEAS_STATS_T *pStats, bool reset);
+
 #endif /** @} */
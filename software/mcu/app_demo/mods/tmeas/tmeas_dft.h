@@ -73,6 +73,18 @@
 //    #define TMEAS_CB your_callback
 #endif
 
+/**
+ * By default, measurements are not timed.
+ * To keep the statistics reported by #TMeas_GetStats, define a function here that returns a free running count in
+ * microseconds. It is called from the main thread and under interrupt, and must be valid whenever a measurement runs.
+ * @note The function must take no arguments and return a @c uint32_t. Differences of two counts must be valid across a
+ *  wrap.
+ * @note This must be set to the name of a function, not a pointer to a function: no dereference will be made!
+ */
+#ifndef TMEAS_TIMESTAMP
+//    #define TMEAS_TIMESTAMP your_timestamp
+#endif
+
 /**
  * @}
  */
@@ -0,0 +1,129 @@
+/*
+ * alarm.c
+ *
+ * The table is kept in RAM from Alarm_Load on; the EEPROM row is only written when an alarm changes.
+ */
+#include <string.h>
+#include "board.h"
+#include "main.h"
+#include "alarm.h"
+
+#define DAY_SECONDS         (24 * 60 * 60)
+#define WEEK_SECONDS        (7 * DAY_SECONDS)
+
+/* Day of the week of RTC day 0, 1970-01-01 */
+#define EPOCH_WEEKDAY       4
+
+/** Marks a table written by this firmware */
+#define ALARM_HEADER        0x414C4D01
+
+typedef struct ALARM_TABLE_S {
+    uint32_t header;                /*!< ALARM_HEADER */
+    ALARM_T alarm[ALARM_COUNT];
+} ALARM_TABLE_T;
+
+/* Fails to compile when the table does not fit in its EEPROM row */
+static char sTestTableSize[(sizeof(ALARM_TABLE_T) <= EE_PAGE_SIZE) - 1] __attribute__((unused));
+
+static ALARM_TABLE_T sTable;
+
+/* The first time at or after @a from that @a alarm goes off, whether it is enabled or not */
+static uint32_t NextOf(const ALARM_T *alarm, uint32_t from)
+{
+    uint32_t day = from / DAY_SECONDS;
+    uint32_t time = (uint32_t)alarm->hour * 60 * 60 + (uint32_t)alarm->minute * 60;
+    uint32_t weekday = (day + EPOCH_WEEKDAY) % 7;
+    uint8_t days = alarm->days ? alarm->days : ALARM_EVERY_DAY;
+
+    if (from - day * DAY_SECONDS > time) {
+        day++;
+        weekday = (weekday + 1) % 7;
+    }
+    while (!(days & ALARM_DAY(weekday))) {
+        day++;
+        weekday = (weekday + 1) % 7;
+    }
+    return day * DAY_SECONDS + time;
+}
+
+static void Save(void)
+{
+    sTable.header = ALARM_HEADER;
+    Chip_EEPROM_Write(NSS_EEPROM, EE_OFFSET_ALARM, &sTable, sizeof(sTable));
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Alarm_Load(void)
+{
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_ALARM, &sTable, sizeof(sTable));
+    if (sTable.header != ALARM_HEADER) {
+        memset(&sTable, 0, sizeof(sTable));
+    }
+}
+
+void Alarm_Set(int slot, const ALARM_T *alarm)
+{
+    if ((slot >= 0) && (slot < ALARM_COUNT) && memcmp(&sTable.alarm[slot], alarm, sizeof(ALARM_T))) {
+        sTable.alarm[slot] = *alarm;
+        Save();
+    }
+}
+
+void Alarm_Get(int slot, ALARM_T *alarm)
+{
+    *alarm = sTable.alarm[slot];
+}
+
+uint32_t Alarm_Next(uint32_t after)
+{
+    uint32_t next = ALARM_NONE;
+    uint32_t time;
+    int n;
+
+    for (n = 0; n < ALARM_COUNT; n++) {
+        if (sTable.alarm[n].flags & ALARM_ENABLED) {
+            time = NextOf(&sTable.alarm[n], after + 1);
+            if (time < next) {
+                next = time;
+            }
+        }
+    }
+    return next;
+}
+
+uint32_t Alarm_Fired(uint32_t now)
+{
+    bool changed = false;
+    int n;
+
+    for (n = 0; n < ALARM_COUNT; n++) {
+        if (((sTable.alarm[n].flags & (ALARM_ENABLED | ALARM_ONCE)) == (ALARM_ENABLED | ALARM_ONCE))
+                && (NextOf(&sTable.alarm[n], now - ALARM_LATE_SECONDS) <= now)) {
+            sTable.alarm[n].flags &= (uint8_t)~ALARM_ENABLED;
+            changed = true;
+        }
+    }
+    if (changed) {
+        Save();
+    }
+    return Alarm_Next(now);
+}
+
+uint16_t Alarm_MinuteOfWeek(uint32_t time)
+{
+    uint32_t day = time / DAY_SECONDS;
+
+    return (uint16_t)(((day + EPOCH_WEEKDAY) % 7) * 24 * 60 + (time - day * DAY_SECONDS) / 60);
+}
+
+uint32_t Alarm_SecondsTo(uint16_t minuteOfWeek, uint32_t now)
+{
+    uint32_t day = now / DAY_SECONDS;
+    uint32_t second = ((day + EPOCH_WEEKDAY) % 7) * DAY_SECONDS + (now - day * DAY_SECONDS);
+    uint32_t late = (second + WEEK_SECONDS - (uint32_t)minuteOfWeek * 60) % WEEK_SECONDS;   // since the alarm time
+
+    return (late <= ALARM_LATE_SECONDS) ? 0 : WEEK_SECONDS - late;
+}
+
+// end file
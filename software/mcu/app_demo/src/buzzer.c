@@ -9,6 +9,14 @@
 #include "timer.h"
 #include "buzzer.h"
 
+/* The 16-bit timer counts 1 MHz at any system clock; toggling the pin every 125 ticks gives a 4 kHz tone */
+#define BUZZER_TICK_HZ  (1000 * 1000)
+#define BUZZER_TOGGLE   125
+
+static uint32_t sPrescale;
+static bool sPrescaleKnown = false;
+static bool sRunning = false;
+
 /**
  * Buzzer enable
  */
@@ -17,15 +25,21 @@ void buzzer_start(void)
     Chip_IOCON_SetPinConfig(NSS_IOCON, 3, IOCON_FUNC_1 | IOCON_RMODE_INACT);
     Chip_TIMER16_0_Init();
 
+    if (!sPrescaleKnown) {
+        sPrescale = (uint32_t)Chip_Clock_System_GetClockFreq() / BUZZER_TICK_HZ - 1;
+        sPrescaleKnown = true;
+    }
     Chip_TIMER_Disable(NSS_TIMER16_0);
     Chip_TIMER_Reset(NSS_TIMER16_0);
-    Chip_TIMER_SetMatch(NSS_TIMER16_0, 0, 250);
+    Chip_TIMER_PrescaleSet(NSS_TIMER16_0, sPrescale);
+    Chip_TIMER_SetMatch(NSS_TIMER16_0, 0, BUZZER_TOGGLE);
     Chip_TIMER_ResetOnMatchEnable(NSS_TIMER16_0, 0);
     Chip_TIMER_StopOnMatchDisable(NSS_TIMER16_0, 0);
     Chip_TIMER_MatchDisableInt(NSS_TIMER16_0, 0);
     Chip_TIMER_SetMatchOutputMode(NSS_TIMER16_0, 0, TIMER_MATCH_OUTPUT_EMC);
     Chip_TIMER_ExtMatchControlSet(NSS_TIMER16_0, 0, TIMER_EXTMATCH_TOGGLE, 0);
     Chip_TIMER_Enable(NSS_TIMER16_0);
+    sRunning = true;
 }
 
 /**
@@ -40,7 +54,19 @@ void buzzer_stop(void)
     Chip_TIMER_Disable(NSS_TIMER16_0);
     Chip_TIMER_Reset(NSS_TIMER16_0);
     Chip_TIMER_ExtMatchControlSet(NSS_TIMER16_0, 0, TIMER_EXTMATCH_TOGGLE, 0);
-    Chip_TIMER_MatchDisableInt(NSS_TIMER32_0, 1);
+    sRunning = false;
+}
+
+/**
+ * Keeps the tone for a new system clock
+ */
+void buzzer_set_clock(uint32_t frequency)
+{
+    sPrescale = frequency / BUZZER_TICK_HZ - 1;
+    sPrescaleKnown = true;
+    if (sRunning) {
+        Chip_TIMER_PrescaleSet(NSS_TIMER16_0, sPrescale);
+    }
 }
 
 // end file
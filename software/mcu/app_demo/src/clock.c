@@ -0,0 +1,135 @@
+/*
+ * clock.c
+ *
+ * A switch never lets a peripheral run too fast, not even for a moment: when raising the clock, the dividers of I2C0
+ * and the timers are set for the new clock first - so they run slower until the switch - and when lowering it, they
+ * are set after. The flash wait state likewise is added before and removed after.
+ */
+#include "board.h"
+#include "timer.h"
+#include "buzzer.h"
+#include "clock.h"
+
+/** Above this clock, flash needs a wait state. See NSS_CLOCK_RESTRICTIONS. */
+#define FLASH_NO_WAIT_MAX_HZ    (4 * 1000 * 1000)
+
+/** Least value of SCLH and SCLL the I2C block takes, as Chip_I2C_SetClockRate gave at the former fixed clock */
+#define I2C_SCL_MIN             4
+
+static const int sFrequency[CLOCK_LEVEL_COUNT] = {CLOCK_IDLE_HZ, CLOCK_NORMAL_HZ, CLOCK_FAST_HZ};
+
+static uint8_t sRequests[CLOCK_LEVEL_COUNT];
+static CLOCK_LEVEL_T sLevel = CLOCK_LEVEL_NORMAL;
+static uint32_t sI2CRate;
+
+/* Sets the SCL duty cycle of I2C0 for sI2CRate at @a frequency. Chip_I2C_SetClockRate is not used: it divides
+ * Chip_Clock_System_GetClockFreq, which during a switch is not yet or no longer @a frequency.
+ */
+static void SetI2CDividers(int frequency)
+{
+    uint32_t scl = (uint32_t)frequency / sI2CRate;
+    uint32_t high = scl >> 1;
+    uint32_t low = scl - high;
+
+    /* At CLOCK_IDLE_HZ the bus runs slower than sI2CRate rather than below the minimum */
+    NSS_I2C->SCLH = (high < I2C_SCL_MIN) ? I2C_SCL_MIN : high;
+    NSS_I2C->SCLL = (low < I2C_SCL_MIN) ? I2C_SCL_MIN : low;
+}
+
+/* Sets the dividers of I2C0 and the timers for @a frequency */
+static void SetDividers(int frequency)
+{
+    if (sI2CRate) {
+        SetI2CDividers(frequency);
+    }
+    Timer_SetClock((uint32_t)frequency);
+    buzzer_set_clock((uint32_t)frequency);
+}
+
+static void Switch(CLOCK_LEVEL_T level)
+{
+    int from = sFrequency[sLevel];
+    int to = sFrequency[level];
+
+    if (to > from) {
+        SetDividers(to);
+        if (to > FLASH_NO_WAIT_MAX_HZ) {
+            Chip_Flash_SetNumWaitStates(1);
+        }
+        Chip_Clock_System_SetClockFreq(to);
+    }
+    else {
+        Chip_Clock_System_SetClockFreq(to);
+        if (to <= FLASH_NO_WAIT_MAX_HZ) {
+            Chip_Flash_SetNumWaitStates(0);
+        }
+        SetDividers(to);
+    }
+    sLevel = level;
+}
+
+static void Update(void)
+{
+    CLOCK_LEVEL_T level = CLOCK_LEVEL_IDLE;
+    int n;
+
+#if !CLOCK_GOVERNOR
+    return;
+#endif
+    for (n = CLOCK_LEVEL_COUNT - 1; n > CLOCK_LEVEL_IDLE; n--) {
+        if (sRequests[n]) {
+            level = (CLOCK_LEVEL_T)n;
+            break;
+        }
+    }
+    if ((level == CLOCK_LEVEL_FAST) && Chip_PMU_Switch_GetVNFC()) {
+        /* Powered by the NFC field */
+        level = CLOCK_LEVEL_NORMAL;
+    }
+    if (level != sLevel) {
+        Switch(level);
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Clock_Init(void)
+{
+    int n;
+
+    for (n = 0; n < CLOCK_LEVEL_COUNT; n++) {
+        sRequests[n] = 0;
+    }
+    sLevel = CLOCK_LEVEL_NORMAL;
+}
+
+void Clock_Request(CLOCK_LEVEL_T level)
+{
+    sRequests[level]++;
+    if (level > sLevel) {
+        Update();
+    }
+}
+
+void Clock_Release(CLOCK_LEVEL_T level)
+{
+    if (sRequests[level]) {
+        sRequests[level]--;
+    }
+    Update();
+}
+
+CLOCK_LEVEL_T Clock_GetLevel(void)
+{
+    return sLevel;
+}
+
+void Clock_SetI2CRate(uint32_t rate)
+{
+    sI2CRate = rate;
+    if (rate) {
+        SetI2CDividers(sFrequency[sLevel]);
+    }
+}
+
+// end file
@@ -0,0 +1,134 @@
+/*
+ * clockface.c
+ *
+ * Layout, as drawn before by OLED_ShowTime, OLED_ShowStr, OLED_ShowBat and OLED_ShowAlarm:
+ *   page 0-1: temperature in columns 0 - 59, alarm icon at 60, battery icon at 104
+ *   page 2-5: hh:mm in 16x32 glyphs from column 24
+ *   page 6-7: date, centred
+ */
+#include <string.h>
+#include "board.h"
+#include "ssd1306.h"
+#include "clockface.h"
+#include "format.h"
+#include "layout.h"
+
+#define TIME_X          24
+#define TIME_Y          2
+#define TIME_CELL_W     16
+
+static const LAYOUT_BOX_T sDateBox = {&Font8x16, 0, SSD1306_WIDTH, 6, LAYOUT_ALIGN_CENTRE};
+static const LAYOUT_BOX_T sTempBox = {&Font8x16, 0, 60, 0, LAYOUT_ALIGN_LEFT};
+
+/* What each cell shows on the panel; only meaningful while sValid */
+static bool     sValid;
+static char     sTime[5];           // One 16x32 glyph per cell: hour tens, hour ones, colon, minute tens, minute ones
+static uint32_t sDate;              // year << 16 | month << 8 | day
+static bool     sDateShown;
+static int      sTemperature;
+static bool     sFahrenheit;
+static uint8_t  sBattery;
+static bool     sAlarm;
+
+#if SSD1306_BUS_STATS
+static OLED_BUS_STATS_T sTickStats;
+#endif
+
+void ClockFace_Invalidate(void)
+{
+    sValid = false;
+}
+
+/* Time cells are drawn one glyph each, so a minute change only redraws the digits that changed */
+static uint16_t UpdateTime(const CLOCKFACE_T *face)
+{
+    char time[5];
+    uint16_t drawn = 0;
+    uint8_t i;
+
+    Format_Time(time, face->hours, face->minutes, face->colon ? ':' : ' ');
+
+    for (i = 0; i < sizeof(time); i++) {
+        if (!sValid || (time[i] != sTime[i])) {
+            OLED_ShowFONT32((uint8_t)(TIME_X + i * TIME_CELL_W), TIME_Y, (uint8_t)(time[i] - 32));
+            sTime[i] = time[i];
+            drawn |= (uint16_t)(1u << (CLOCKFACE_CELL_HOUR_TENS + i));
+        }
+    }
+    return drawn;
+}
+
+static uint16_t UpdateDate(const CLOCKFACE_T *face)
+{
+    uint32_t date = (face->year << 16) | ((uint32_t)face->month << 8) | face->day;
+    char str[FORMAT_DATE_SIZE + 1];
+
+    if (!face->showDate) {
+        sDateShown = false;
+        return 0;
+    }
+    if (sValid && sDateShown && (date == sDate)) {
+        return 0;
+    }
+    *Format_Date(str, face->year, face->month, face->day) = '\0';
+    Layout_Draw(&sDateBox, str);
+    sDate = date;
+    sDateShown = true;
+    return 1u << CLOCKFACE_CELL_DATE;
+}
+
+static uint16_t UpdateTemperature(const CLOCKFACE_T *face)
+{
+    char str[FORMAT_TENTHS_SIZE + 3];
+    char *p;
+
+    if (sValid && (face->temperature == sTemperature) && (face->fahrenheit == sFahrenheit)) {
+        return 0;
+    }
+    /* The box blanks whatever a longer value left behind */
+    p = Format_Tenths(str, face->temperature, 0);
+    *p++ = LAYOUT_DEGREE[0];
+    *p++ = face->fahrenheit ? 'F' : 'C';
+    *p = '\0';
+    Layout_Draw(&sTempBox, str);
+    sTemperature = face->temperature;
+    sFahrenheit = face->fahrenheit;
+    return 1u << CLOCKFACE_CELL_TEMPERATURE;
+}
+
+uint16_t ClockFace_Update(const CLOCKFACE_T *face)
+{
+    uint16_t drawn;
+
+#if SSD1306_BUS_STATS
+    /* All spans of the previous update are queued once its flush is over */
+    OLED_WaitFlush();
+    OLED_GetBusStats(&sTickStats, true);
+#endif
+
+    drawn = UpdateTime(face);
+    drawn |= UpdateDate(face);
+    drawn |= UpdateTemperature(face);
+    if (!sValid || (face->battery != sBattery)) {
+        OLED_ShowBat(face->battery);
+        sBattery = face->battery;
+        drawn |= 1u << CLOCKFACE_CELL_BATTERY;
+    }
+    if (!sValid || (face->alarm != sAlarm)) {
+        OLED_ShowAlarm(face->alarm ? 1 : 0);
+        sAlarm = face->alarm;
+        drawn |= 1u << CLOCKFACE_CELL_ALARM;
+    }
+    sValid = true;
+
+    /* Also sends what others marked dirty, e.g. the full frame after ssd1306_init */
+    OLED_Flush();
+    return drawn;
+}
+
+#if SSD1306_BUS_STATS
+void ClockFace_GetTickStats(OLED_BUS_STATS_T *stats)
+{
+    *stats = sTickStats;
+}
+#endif
@@ -0,0 +1,203 @@
+/*
+ * drift.c
+ *
+ * Drift_Sync does the 64-bit arithmetic, once per tap of the phone; Drift_Apply, on the sample wakes, only adds and
+ * shifts what Prepare left in the record.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "board.h"
+#include "logger.h"
+#include "main.h"
+#include "drift.h"
+
+/* RTCCAL is kept in 1/2048 pulse */
+#define FRACTION_BITS       11
+
+/* Rates beyond these are not taken for the TFRO */
+#define MAX_PPB             500000
+#define MAX_PPB_PER_DEGREE  20000
+
+#define PPB                 1000000000
+
+/* Fails to compile when the record does not fit in its EEPROM row */
+static char sTestRecordSize[(sizeof(DRIFT_RECORD_T) <= EE_PAGE_SIZE) - 1] __attribute__((unused));
+
+/* Fails to compile when the carry of Drift_Apply does not fit in its bits of the retained word */
+static char sTestCarrySize[(4 * DRIFT_MAX_APPLY_SECONDS < (RETAINED_STATUS_DRIFT_MASK + 1) / 2) - 1]
+        __attribute__((unused));
+
+static int32_t Clamp(int64_t value, int32_t limit)
+{
+    return (int32_t)((value > limit) ? limit : ((value < -limit) ? -limit : value));
+}
+
+/* Fills in base and slope: RTCCAL for the rate and the coefficient of the record */
+static void Prepare(DRIFT_RECORD_T *record)
+{
+    int64_t cal = (int64_t)record->cal << FRACTION_BITS;
+
+    record->base = (int32_t)(cal + cal * record->rate / PPB);
+    record->slope = (int32_t)(cal * record->coefficient * 256 / 10 / PPB);
+}
+
+/* Weighted least squares of the history: the rate, and the coefficient when the temperatures are far enough apart */
+static void Fit(DRIFT_RECORD_T *record)
+{
+    int64_t sw = 0;
+    int64_t st = 0;
+    int64_t stt = 0;
+    int64_t sr = 0;
+    int64_t str = 0;
+    int64_t det;
+    int64_t w;
+    int64_t t;
+    int min = INT16_MAX;
+    int max = INT16_MIN;
+    int n;
+
+    for (n = 0; n < DRIFT_HISTORY; n++) {
+        if (record->interval[n].seconds) {
+            w = record->interval[n].seconds / 3600;
+            t = record->interval[n].temperature - DRIFT_REFERENCE_DECIDEGREES;
+            sw += w;
+            st += w * t;
+            stt += w * t * t;
+            sr += w * record->interval[n].rate;
+            str += w * t * record->interval[n].rate;
+            if (record->interval[n].temperature < min) {
+                min = record->interval[n].temperature;
+            }
+            if (record->interval[n].temperature > max) {
+                max = record->interval[n].temperature;
+            }
+        }
+    }
+    if (!sw) {
+        return;
+    }
+    det = sw * stt - st * st;
+    if ((max - min >= DRIFT_MIN_SPREAD_DECIDEGREES) && (det > 0)) {
+        record->coefficient = (int16_t)Clamp((sw * str - st * sr) * 10 / det, MAX_PPB_PER_DEGREE);
+    }
+    record->rate = Clamp((sr - record->coefficient * st / 10) / sw, MAX_PPB);
+}
+
+/* The interval a new one at @a temperature takes the place of: an unused one, else the one nearest in temperature */
+static int Replace(const DRIFT_RECORD_T *record, int temperature)
+{
+    int best = 0;
+    int distance;
+    int n;
+
+    for (n = 0; n < DRIFT_HISTORY; n++) {
+        if (!record->interval[n].seconds) {
+            return n;
+        }
+        distance = abs(record->interval[n].temperature - temperature);
+        if (distance < abs(record->interval[best].temperature - temperature)) {
+            best = n;
+        }
+    }
+    return best;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Drift_Sync(uint32_t rtc, uint32_t reference, int temperature)
+{
+    DRIFT_RECORD_T record;
+    uint32_t seconds;
+    int32_t error;
+    int32_t model;
+    int mean;
+    int n;
+
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_DRIFT, &record, sizeof(record));
+    if (record.header != DRIFT_HEADER) {
+        /* The first sync: RTCCAL was never changed */
+        memset(&record, 0, sizeof(record));
+        record.header = DRIFT_HEADER;
+        record.cal = (uint16_t)Chip_RTC_GetCalibration(NSS_RTC);
+        record.coefficient = DRIFT_DEFAULT_PPB_PER_DEGREE;
+        Prepare(&record);
+    }
+    else {
+        /* Positive when the RTC is behind */
+        error = (int32_t)(reference - rtc) + record.pending;
+        seconds = rtc - (uint32_t)record.pending - record.sync;
+        if ((error > DRIFT_MAX_SYNC_SECONDS) || (error < -DRIFT_MAX_SYNC_SECONDS) || ((int32_t)seconds <= 0)) {
+            /* Set on purpose, or back in time: nothing to learn */
+            record.pending = 0;
+        }
+        else if (seconds < DRIFT_MIN_SECONDS) {
+            /* Too short to tell: the interval continues, the error counts in the next sync */
+            record.pending = error;
+            Chip_EEPROM_Write(NSS_EEPROM, EE_OFFSET_DRIFT, &record, sizeof(record));
+            return;
+        }
+        else {
+            if (!Logger_GetMean(seconds, &mean)) {
+                mean = temperature;
+            }
+            model = record.rate + record.coefficient * (mean - DRIFT_REFERENCE_DECIDEGREES) / 10;
+            n = Replace(&record, mean);
+            record.interval[n].seconds = seconds;
+            record.interval[n].rate = Clamp(model - (int64_t)error * PPB / seconds, MAX_PPB);
+            record.interval[n].temperature = (int16_t)mean;
+            record.interval[n].reserved = 0;
+            Fit(&record);
+            Prepare(&record);
+            record.pending = 0;
+        }
+    }
+    record.sync = reference;
+    Chip_EEPROM_Write(NSS_EEPROM, EE_OFFSET_DRIFT, &record, sizeof(record));
+}
+
+void Drift_Apply(int temperature, uint32_t seconds)
+{
+#if DRIFT
+    DRIFT_RECORD_T record;
+    uint32_t status;
+    uint32_t exact;
+    uint32_t cal;
+    int32_t carry;
+    int32_t add;
+
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_DRIFT, &record, sizeof(record));
+    Chip_PMU_GetRetainedData(&status, 3, 1);
+    if ((record.header != DRIFT_HEADER) || ((status & 0xFFFF0000) != RETAINED_STATUS_HEADER)) {
+        return;
+    }
+    if (seconds > DRIFT_MAX_APPLY_SECONDS) {
+        seconds = DRIFT_MAX_APPLY_SECONDS;
+    }
+    exact = (uint32_t)(record.base + record.slope * (temperature - DRIFT_REFERENCE_DECIDEGREES) / 256);
+    cal = exact >> FRACTION_BITS;
+
+    /* The carry is in 1/8 pulse seconds: what the pulses used so far lag behind the exact ones */
+    carry = (int32_t)((status >> RETAINED_STATUS_DRIFT_SHIFT) & RETAINED_STATUS_DRIFT_MASK);
+    if (carry > (int32_t)(RETAINED_STATUS_DRIFT_MASK / 2)) {
+        carry -= (int32_t)(RETAINED_STATUS_DRIFT_MASK + 1);
+    }
+    add = (int32_t)(((exact & ((1 << FRACTION_BITS) - 1)) * seconds) >> (FRACTION_BITS - 3));
+    if (carry + add >= 4 * (int32_t)seconds) {
+        cal++;
+        carry += add - 8 * (int32_t)seconds;
+    }
+    else {
+        carry += add;
+    }
+    Chip_RTC_SetCalibration(NSS_RTC, (int)cal);
+
+    status &= ~(RETAINED_STATUS_DRIFT_MASK << RETAINED_STATUS_DRIFT_SHIFT);
+    status |= ((uint32_t)carry & RETAINED_STATUS_DRIFT_MASK) << RETAINED_STATUS_DRIFT_SHIFT;
+    Chip_PMU_SetRetainedData(&status, 3, 1);
+#else
+    (void)temperature;
+    (void)seconds;
+#endif
+}
+
+// end file
@@ -0,0 +1,103 @@
+/*
+ * event.c
+ */
+#include <string.h>
+#include "board.h"
+#include "timer.h"
+#include "clock.h"
+#include "profile.h"
+#include "event.h"
+
+/* sHead is only written by the producer, sTail only by the consumer: each side owns the entries between them */
+static EVENT_T sQueue[EVENT_QUEUE_SIZE];
+static volatile uint8_t sHead;
+static volatile uint8_t sTail;
+
+static EVENT_STATS_T sStats;
+static uint32_t sStatsStart;
+
+void Event_Init(void)
+{
+    __disable_irq();
+    sHead = 0;
+    sTail = 0;
+    __enable_irq();
+    memset(&sStats, 0, sizeof(sStats));
+    sStatsStart = Timer_GetFreeRunning();
+}
+
+bool Event_Post(EVENT_TYPE_T type, int32_t data)
+{
+    EVENT_T *event;
+    uint8_t head = sHead;
+
+    if ((uint8_t)(head - sTail) >= EVENT_QUEUE_SIZE) {
+        sStats.dropped++;
+        return false;
+    }
+    event = &sQueue[head & (EVENT_QUEUE_SIZE - 1)];
+    event->type = (uint8_t)type;
+    event->data = data;
+    event->time = Timer_GetFreeRunning();
+    /* Publish only once the entry is complete */
+    sHead = (uint8_t)(head + 1);
+    return true;
+}
+
+void Event_Dispatch(const EVENT_HANDLER_T handlers[EVENT_TYPE_COUNT])
+{
+    EVENT_T event;
+    EVENT_TYPE_STATS_T *stats;
+    uint32_t start;
+    uint32_t duration;
+    uint32_t slept;
+
+    /* Same masked check-then-sleep as OLED_WaitFlush: a post in between cannot be missed */
+    __disable_irq();
+    while (sHead == sTail) {
+        start = Timer_GetFreeRunning();
+        Chip_PMU_PowerMode_EnterSleep();
+        slept = Timer_GetFreeRunning() - start;
+        sStats.asleep += slept;
+        Profile_Add(PROFILE_REGION_SLEEP, slept);
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+
+    event = sQueue[sTail & (EVENT_QUEUE_SIZE - 1)];
+    sTail = (uint8_t)(sTail + 1);
+
+    /* Sleeping above runs at the idle clock */
+    Clock_Request(CLOCK_LEVEL_NORMAL);
+    start = Timer_GetFreeRunning();
+    if ((event.type < EVENT_TYPE_COUNT) && handlers[event.type]) {
+        handlers[event.type](&event);
+    }
+    duration = Timer_GetFreeRunning() - start;
+    Clock_Release(CLOCK_LEVEL_NORMAL);
+
+    if (event.type < EVENT_TYPE_COUNT) {
+        stats = &sStats.type[event.type];
+        stats->count++;
+        if (start - event.time > stats->maxLatency) {
+            stats->maxLatency = start - event.time;
+        }
+        if (duration > stats->maxDuration) {
+            stats->maxDuration = duration;
+        }
+        stats->totalDuration += duration;
+    }
+}
+
+void Event_GetStats(EVENT_STATS_T *stats, bool reset)
+{
+    uint32_t now = Timer_GetFreeRunning();
+
+    *stats = sStats;
+    stats->awake = now - sStatsStart - sStats.asleep;
+    if (reset) {
+        memset(&sStats, 0, sizeof(sStats));
+        sStatsStart = now;
+    }
+}
@@ -0,0 +1,274 @@
+/*
+ * Generated by tools/fontc/fontc.py from tools/fontc/fonts_src.c - do not edit.
+ *
+ * Former tables:    3456 bytes
+ * Compressed:       1583 bytes, including indexes and all battery icons
+ * Reclaimed:        1873 bytes = 29 to 30 flash pages
+ * Sample capacity: +1334 samples of 11 bits (at least)
+ */
+
+#include "fonts.h"
+
+/* Font8x16: 48 of 95 glyphs, 689 bytes instead of 768 */
+static const uint8_t sFont8x16Data[] =
+{
+    /* ' ' */
+        0xCF,
+    /* '!' */
+        0xC2, 0x00, 0xF0, 0xC6, 0x01, 0x67, 0x60, 0xC2,
+    /* "'" */
+        0x02, 0x20, 0x2C, 0x1C, 0xCC,
+    /* '(' */
+        0xC2, 0x03, 0xC0, 0x30, 0x08, 0x04, 0xC3, 0x03, 0x0F, 0x30, 0x40, 0x80, 0xC0,
+    /* ')' */
+        0xC0, 0x03, 0x04, 0x08, 0x30, 0xC0, 0xC3, 0x03, 0x80, 0x40, 0x30, 0x0F, 0xC2,
+    /* '+' */
+        0xC2, 0x00, 0xE0, 0xC3, 0x81, 0x02, 0x00, 0x3F, 0x81, 0x02, 0xC0,
+    /* ',' */
+        0xC8, 0x01, 0x60, 0xE0, 0xC4,
+    /* '-' */
+        0xC8, 0x85, 0x02,
+    /* '.' */
+        0xC8, 0x01, 0x60, 0x60, 0xC4,
+    /* '/' */
+        0xC4, 0x02, 0xC0, 0x30, 0x08, 0xC0, 0x03, 0xC0, 0x30, 0x0C, 0x03, 0xC2,
+    /* '0' */
+        0xC0, 0x05, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, 0xC1, 0x05, 0x0F, 0x10, 0x20, 0x20, 0x10, 0x0F,
+        0xC0,
+    /* '1' */
+        0xC0, 0x02, 0x20, 0x20, 0xF0, 0xC4, 0x04, 0x40, 0x40, 0x7F, 0x40, 0x40, 0xC1,
+    /* '2' */
+        0xC0, 0x00, 0xE0, 0x82, 0x10, 0x00, 0xE0, 0xC1, 0x05, 0x60, 0x50, 0x48, 0x44, 0x43, 0x60, 0xC0,
+    /* '3' */
+        0xC0, 0x00, 0x60, 0x81, 0x10, 0x01, 0x90, 0x60, 0xC1, 0x05, 0x30, 0x40, 0x41, 0x41, 0x22, 0x1C,
+        0xC0,
+    /* '4' */
+        0xC1, 0x03, 0x80, 0x40, 0x20, 0xF0, 0xC2, 0x05, 0x0E, 0x09, 0x48, 0x48, 0x7F, 0x48, 0xC0,
+    /* '5' */
+        0xC0, 0x00, 0xF0, 0x83, 0x10, 0xC1, 0x05, 0x33, 0x42, 0x41, 0x41, 0x22, 0x1C, 0xC0,
+    /* '6' */
+        0xC0, 0x04, 0xC0, 0x20, 0x10, 0x10, 0x30, 0xC2, 0x05, 0x1F, 0x22, 0x41, 0x41, 0x22, 0x1C, 0xC0,
+    /* '7' */
+        0xC0, 0x05, 0x70, 0x10, 0x10, 0x90, 0x70, 0x10, 0xC3, 0x01, 0x7E, 0x01, 0xC2,
+    /* '8' */
+        0xC0, 0x00, 0xE0, 0x82, 0x10, 0x00, 0xE0, 0xC1, 0x05, 0x38, 0x45, 0x42, 0x42, 0x45, 0x38, 0xC0,
+    /* '9' */
+        0xC0, 0x05, 0xC0, 0x20, 0x10, 0x10, 0x20, 0xC0, 0xC1, 0x05, 0x01, 0x62, 0x44, 0x44, 0x22, 0x1F,
+        0xC0,
+    /* ':' */
+        0xC2, 0x01, 0x80, 0x80, 0xC5, 0x01, 0x61, 0x61, 0xC2,
+    /* '?' */
+        0xC0, 0x01, 0xE0, 0x90, 0x81, 0x10, 0x00, 0xE0, 0xC3, 0x03, 0x60, 0x6C, 0x02, 0x01, 0xC0,
+    /* 'A' */
+        0xC1, 0x02, 0x80, 0x70, 0xC0, 0xC2, 0x07, 0x40, 0x78, 0x47, 0x04, 0x05, 0x4E, 0x70, 0x40,
+    /* 'B' */
+        0x01, 0x10, 0xF0, 0x81, 0x10, 0x00, 0xE0, 0xC1, 0x01, 0x40, 0x7F, 0x81, 0x41, 0x01, 0x22, 0x1C,
+        0xC0,
+    /* 'C' */
+        0x01, 0x80, 0x60, 0x82, 0x10, 0x00, 0x70, 0xC0, 0x01, 0x0F, 0x30, 0x81, 0x40, 0x01, 0x20, 0x10,
+        0xC0,
+    /* 'D' */
+        0x01, 0x10, 0xF0, 0x81, 0x10, 0x01, 0x20, 0xC0, 0xC0, 0x01, 0x40, 0x7F, 0x81, 0x40, 0x01, 0x20,
+        0x1F, 0xC0,
+    /* 'E' */
+        0x06, 0x10, 0xF0, 0x10, 0x10, 0xD0, 0x10, 0x20, 0xC0, 0x06, 0x40, 0x7F, 0x41, 0x41, 0x47, 0x40,
+        0x30, 0xC0,
+    /* 'F' */
+        0x06, 0x10, 0xF0, 0x10, 0x10, 0xD0, 0x10, 0x20, 0xC0, 0x04, 0x40, 0x7F, 0x41, 0x01, 0x07, 0xC2,
+    /* 'G' */
+        0x01, 0x80, 0x60, 0x81, 0x10, 0x00, 0x70, 0xC1, 0x06, 0x0F, 0x30, 0x40, 0x40, 0x44, 0x3C, 0x04,
+        0xC0,
+    /* 'H' */
+        0x02, 0x10, 0xF0, 0x10, 0xC1, 0x0A, 0x10, 0xF0, 0x10, 0x40, 0x7F, 0x42, 0x02, 0x02, 0x42, 0x7F,
+        0x40,
+    /* 'I' */
+        0xC0, 0x04, 0x10, 0x10, 0xF0, 0x10, 0x10, 0xC2, 0x04, 0x40, 0x40, 0x7F, 0x40, 0x40, 0xC1,
+    /* 'J' */
+        0xC1, 0x04, 0x10, 0x10, 0xF0, 0x10, 0x10, 0xC0, 0x00, 0x80, 0xC2, 0x00, 0xFF, 0xC2,
+    /* 'K' */
+        0x06, 0x10, 0xF0, 0x10, 0x80, 0x50, 0x30, 0x10, 0xC0, 0x06, 0x40, 0x7F, 0x41, 0x03, 0x4C, 0x70,
+        0x40, 0xC0,
+    /* 'L' */
+        0x02, 0x10, 0xF0, 0x10, 0xC4, 0x01, 0x40, 0x7F, 0x82, 0x40, 0x00, 0x60, 0xC0,
+    /* 'M' */
+        0x02, 0x10, 0xF0, 0xF0, 0xC0, 0x02, 0xF0, 0xF0, 0x10, 0xC0, 0x06, 0x40, 0x7F, 0x01, 0x7E, 0x01,
+        0x7F, 0x40, 0xC0,
+    /* 'N' */
+        0x03, 0x10, 0xF0, 0x60, 0x80, 0xC0, 0x09, 0x10, 0xF0, 0x10, 0x40, 0x7F, 0x40, 0x01, 0x0E, 0x30,
+        0x7F, 0xC0,
+    /* 'O' */
+        0x01, 0xC0, 0x20, 0x81, 0x10, 0x01, 0x20, 0xC0, 0xC0, 0x01, 0x1F, 0x20, 0x81, 0x40, 0x01, 0x20,
+        0x1F, 0xC0,
+    /* 'P' */
+        0x01, 0x10, 0xF0, 0x82, 0x10, 0x00, 0xE0, 0xC0, 0x02, 0x40, 0x7F, 0x42, 0x81, 0x02, 0x00, 0x01,
+        0xC0,
+    /* 'Q' */
+        0x01, 0xC0, 0x20, 0x81, 0x10, 0x01, 0x20, 0xC0, 0xC0, 0x06, 0x1F, 0x30, 0x48, 0x48, 0x70, 0xA0,
+        0x9F, 0xC0,
+    /* 'R' */
+        0x01, 0x10, 0xF0, 0x82, 0x10, 0x00, 0xE0, 0xC0, 0x07, 0x40, 0x7F, 0x41, 0x01, 0x07, 0x19, 0x60,
+        0x40,
+    /* 'S' */
+        0xC0, 0x00, 0xE0, 0x82, 0x10, 0x00, 0x70, 0xC1, 0x05, 0x70, 0x41, 0x42, 0x42, 0x44, 0x38, 0xC0,
+    /* 'T' */
+        0x06, 0x30, 0x10, 0x10, 0xF0, 0x10, 0x10, 0x30, 0xC2, 0x02, 0x40, 0x7F, 0x40, 0xC2,
+    /* 'U' */
+        0x02, 0x10, 0xF0, 0x10, 0xC1, 0x02, 0x10, 0xF0, 0x10, 0xC0, 0x00, 0x3F, 0x82, 0x40, 0x00, 0x3F,
+        0xC0,
+    /* 'V' */
+        0x02, 0x10, 0xF0, 0x10, 0xC1, 0x02, 0x90, 0x70, 0x10, 0xC1, 0x03, 0x0F, 0x70, 0x1C, 0x03, 0xC1,
+    /* 'W' */
+        0x01, 0xF0, 0x10, 0xC0, 0x00, 0xF0, 0xC0, 0x01, 0x10, 0xF0, 0xC0, 0x06, 0x07, 0x78, 0x0E, 0x01,
+        0x0E, 0x78, 0x07, 0xC0,
+    /* 'X' */
+        0x02, 0x10, 0x30, 0xD0, 0xC1, 0x0A, 0xD0, 0x30, 0x10, 0x40, 0x60, 0x58, 0x07, 0x07, 0x58, 0x60,
+        0x40,
+    /* 'Y' */
+        0x02, 0x10, 0x70, 0x90, 0xC0, 0x02, 0x90, 0x70, 0x10, 0xC2, 0x02, 0x41, 0x7E, 0x41, 0xC2,
+    /* 'Z' */
+        0x00, 0x20, 0x81, 0x10, 0x02, 0x90, 0x70, 0x10, 0xC0, 0x06, 0x40, 0x70, 0x4C, 0x42, 0x41, 0x40,
+        0x30, 0xC0,
+};
+
+static const uint16_t sFont8x16Offset[] =
+{
+    0, 1, 9, 14, 27, 40, 51, 56, 59, 64, 76, 93, 106, 122, 139, 154, 168, 184, 197, 213, 230, 239, 254, 269, 286, 303, 321, 339, 355, 372, 389, 404, 418, 436, 449, 468, 486, 504, 521, 539, 556, 572, 586, 603, 619, 639, 656, 671,
+};
+
+static const GLYPH_METRICS_T sFont8x16Metrics[] =
+{
+    {0, 4}, {3, 3}, {0, 4}, {3, 5}, {1, 5}, {0, 8}, {1, 3}, {1, 8},
+    {1, 3}, {1, 8}, {1, 7}, {1, 7}, {1, 7}, {1, 7}, {1, 7}, {1, 7},
+    {1, 7}, {1, 7}, {1, 7}, {1, 7}, {3, 3}, {1, 7}, {0, 9}, {0, 8},
+    {0, 8}, {0, 8}, {0, 8}, {0, 8}, {0, 8}, {0, 9}, {1, 6}, {0, 8},
+    {0, 8}, {0, 8}, {0, 8}, {0, 9}, {0, 8}, {0, 8}, {0, 8}, {0, 9},
+    {1, 7}, {0, 8}, {0, 9}, {0, 9}, {0, 8}, {0, 9}, {0, 8}, {0, 8},
+};
+
+const FONT_T Font8x16 =
+{
+    sFont8x16Data, sFont8x16Offset, sFont8x16Metrics, " !'()+,-./0123456789:?ABCDEFGHIJKLMNOPQRSTUVWXYZ", 8, 2
+};
+
+/* Font16x32: 12 of 28 glyphs, 394 bytes instead of 768 */
+static const uint8_t sFont16x32Data[] =
+{
+    /* ' ' */
+        0xFF,
+    /* '0' */
+        0xC5, 0x83, 0x80, 0xC6, 0x04, 0xE0, 0xFC, 0x1E, 0x03, 0x01, 0xC2, 0x04, 0x01, 0x03, 0x0E, 0xFC,
+        0xE0, 0xC2, 0x02, 0x3F, 0xFF, 0xC0, 0xC6, 0x02, 0x80, 0xFF, 0x3F, 0xC3, 0x03, 0x01, 0x03, 0x06,
+        0x0C, 0x81, 0x08, 0x03, 0x0C, 0x06, 0x03, 0x01, 0xC1,
+    /* '1' */
+        0xC6, 0x01, 0x80, 0xC0, 0xC9, 0x82, 0x01, 0x01, 0xFF, 0xFF, 0xCD, 0x01, 0xFF, 0xFF, 0xC9, 0x81,
+        0x04, 0x03, 0x06, 0x07, 0x07, 0x06, 0x81, 0x04, 0xC2,
+    /* '2' */
+        0xC3, 0x00, 0x80, 0x83, 0x40, 0x02, 0xC0, 0x80, 0x80, 0xC4, 0x01, 0x1E, 0x19, 0xC6, 0x02, 0xC1,
+        0x7F, 0x3E, 0xC4, 0x07, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xC1, 0x00, 0xE0, 0xC3,
+        0x00, 0x07, 0x87, 0x06, 0x01, 0x07, 0x01, 0xC1,
+    /* '3' */
+        0xC2, 0x01, 0x80, 0x80, 0x82, 0x40, 0x02, 0xC0, 0x80, 0x80, 0xC5, 0x01, 0x0F, 0x0F, 0xC1, 0x81,
+        0x80, 0x03, 0xC0, 0x61, 0x3F, 0x1E, 0xC4, 0x01, 0xE0, 0xE0, 0xC4, 0x04, 0x01, 0x01, 0x03, 0xFE,
+        0x78, 0xC3, 0x02, 0x01, 0x03, 0x02, 0x83, 0x04, 0x02, 0x02, 0x03, 0x01, 0xC2,
+    /* '4' */
+        0xC8, 0x02, 0x80, 0xC0, 0xC0, 0xC7, 0x04, 0x80, 0x60, 0x30, 0x0C, 0x02, 0x81, 0xFF, 0xC4, 0x03,
+        0x10, 0x1C, 0x12, 0x11, 0x82, 0x10, 0x81, 0xFF, 0x81, 0x10, 0xC6, 0x81, 0x08, 0x81, 0x0F, 0x81,
+        0x08, 0xC0,
+    /* '5' */
+        0xC3, 0x88, 0xC0, 0xC4, 0x02, 0xF8, 0x87, 0x40, 0x82, 0x20, 0x02, 0x60, 0xC0, 0x80, 0xC4, 0x01,
+        0xE0, 0x61, 0xC6, 0x02, 0x80, 0xFF, 0x7E, 0xC3, 0x01, 0x01, 0x02, 0x84, 0x04, 0x02, 0x02, 0x03,
+        0x01, 0xC2,
+    /* '6' */
+        0xC5, 0x01, 0x80, 0xC0, 0x82, 0x40, 0x00, 0x80, 0xC4, 0x04, 0xE0, 0xFC, 0x0E, 0x81, 0x80, 0x82,
+        0x40, 0x02, 0xC0, 0x83, 0x03, 0xC3, 0x03, 0x3F, 0xFF, 0xC3, 0x01, 0xC5, 0x02, 0x01, 0xFF, 0x7E,
+        0xC4, 0x02, 0x01, 0x03, 0x06, 0x82, 0x04, 0x02, 0x02, 0x03, 0x01, 0xC1,
+    /* '7' */
+        0xC2, 0x89, 0xC0, 0xC3, 0x02, 0x0F, 0x03, 0x01, 0xC2, 0x04, 0x80, 0x60, 0x18, 0x06, 0x01, 0xC8,
+        0x02, 0xE0, 0xFC, 0x03, 0xCC, 0x01, 0x07, 0x07, 0xC7,
+    /* '8' */
+        0xC3, 0x01, 0x80, 0xC0, 0x82, 0x40, 0x01, 0xC0, 0x80, 0xC5, 0x04, 0x1E, 0x3F, 0x71, 0xE0, 0xC0,
+        0x82, 0x80, 0x02, 0x61, 0x3F, 0x1E, 0xC2, 0x04, 0xF8, 0xFC, 0x06, 0x03, 0x01, 0xC0, 0x06, 0x01,
+        0x01, 0x03, 0x07, 0x0E, 0xFC, 0xF8, 0xC3, 0x02, 0x01, 0x03, 0x02, 0x83, 0x04, 0x02, 0x02, 0x03,
+        0x01, 0xC2,
+    /* '9' */
+        0xC2, 0x01, 0x80, 0x80, 0x83, 0x40, 0x00, 0x80, 0xC5, 0x02, 0xFC, 0xFF, 0x03, 0xC6, 0x02, 0x83,
+        0xFE, 0xF8, 0xC3, 0x02, 0x81, 0x83, 0x06, 0x82, 0x04, 0x04, 0x02, 0x83, 0xF1, 0x7F, 0x0F, 0xC3,
+        0x01, 0x03, 0x03, 0x82, 0x04, 0x02, 0x06, 0x03, 0x01, 0xC4,
+    /* ':' */
+        0xD5, 0x03, 0x0C, 0x1E, 0x1E, 0x0C, 0xCB, 0x03, 0x30, 0x78, 0x78, 0x30, 0xD5,
+};
+
+static const uint16_t sFont16x32Offset[] =
+{
+    0, 1, 42, 67, 107, 152, 186, 220, 264, 289, 339, 381,
+};
+
+static const GLYPH_METRICS_T sFont16x32Metrics[] =
+{
+    {0, 8}, {2, 15}, {1, 15}, {1, 15}, {1, 15}, {1, 15}, {1, 15}, {2, 15},
+    {1, 15}, {1, 15}, {1, 15}, {6, 5},
+};
+
+const FONT_T Font16x32 =
+{
+    sFont16x32Data, sFont16x32Offset, sFont16x32Metrics, " 0123456789:", 16, 4
+};
+
+/* Bmp_Degree: 6 bytes instead of 8 */
+static const uint8_t sBmp_DegreeData[] =
+{
+    0x03, 0x06, 0x09, 0x09, 0x06, 0xC3,
+};
+
+const BITMAP_T Bmp_Degree = {sBmp_DegreeData, 4, 2};
+
+/* Bmp_AlarmSet: 31 bytes instead of 32 */
+static const uint8_t sBmp_AlarmSetData[] =
+{
+    0xC0, 0x0C, 0xC0, 0x36, 0x0B, 0x07, 0x05, 0x03, 0xFA, 0x03, 0x05, 0x07, 0x0B, 0x36, 0xC0, 0xC2,
+    0x0C, 0x07, 0x19, 0x21, 0x41, 0x41, 0x81, 0x81, 0x80, 0x40, 0x40, 0x20, 0x18, 0x07, 0xC1,
+};
+
+const BITMAP_T Bmp_AlarmSet = {sBmp_AlarmSetData, 16, 2};
+
+/* Bmp_AlarmClr: 1 bytes instead of 32 */
+static const uint8_t sBmp_AlarmClrData[] =
+{
+    0xDF,
+};
+
+const BITMAP_T Bmp_AlarmClr = {sBmp_AlarmClrData, 16, 2};
+
+/* Bmp_BatteryFull: 23 bytes instead of 48 */
+static const uint8_t sBmp_BatteryFullData[] =
+{
+    0xC2, 0x03, 0x7C, 0x44, 0xFF, 0x01, 0x81, 0x7D, 0x00, 0x01, 0x82, 0x7D, 0x00, 0x01, 0x83, 0x7D,
+    0x01, 0x01, 0xFF, 0xC5, 0x90, 0x01, 0xC0,
+};
+
+const BITMAP_T Bmp_BatteryFull = {sBmp_BatteryFullData, 24, 2};
+
+/* Bmp_BatteryMid: 20 bytes instead of 48 */
+static const uint8_t sBmp_BatteryMidData[] =
+{
+    0xC2, 0x02, 0x7C, 0x44, 0xFF, 0x83, 0x01, 0x82, 0x7D, 0x00, 0x01, 0x83, 0x7D, 0x01, 0x01, 0xFF,
+    0xC5, 0x90, 0x01, 0xC0,
+};
+
+const BITMAP_T Bmp_BatteryMid = {sBmp_BatteryMidData, 24, 2};
+
+/* Bmp_BatteryLow: 16 bytes instead of 48 */
+static const uint8_t sBmp_BatteryLowData[] =
+{
+    0xC2, 0x02, 0x7C, 0x44, 0xFF, 0x88, 0x01, 0x83, 0x7D, 0x01, 0x01, 0xFF, 0xC5, 0x90, 0x01, 0xC0,
+};
+
+const BITMAP_T Bmp_BatteryLow = {sBmp_BatteryLowData, 24, 2};
+
+/* Bmp_BatteryEmpty: 13 bytes instead of 48 */
+static const uint8_t sBmp_BatteryEmptyData[] =
+{
+    0xC2, 0x02, 0x7C, 0x44, 0xFF, 0x8E, 0x01, 0x00, 0xFF, 0xC5, 0x90, 0x01, 0xC0,
+};
+
+const BITMAP_T Bmp_BatteryEmpty = {sBmp_BatteryEmptyData, 24, 2};
@@ -0,0 +1,131 @@
+/*
+ * format.c
+ *
+ * All emitters go through Digits, which writes the decimal digits backwards into a small buffer on the stack.
+ */
+#include "format.h"
+
+/* @a value / 10, exact for all values: Hacker's Delight, 10-4, without multiplications */
+static uint32_t Div10(uint32_t value, uint32_t *remainder)
+{
+    uint32_t q = (value >> 1) + (value >> 2);
+    uint32_t r;
+
+    q += q >> 4;
+    q += q >> 8;
+    q += q >> 16;
+    q >>= 3;
+    r = value - (((q << 2) + q) << 1);
+    if (r > 9) {
+        q++;
+        r -= 10;
+    }
+    *remainder = r;
+    return q;
+}
+
+/* Writes @a value, least significant digit first, and at least @a minimum digits; returns their number */
+static uint8_t Digits(char digits[FORMAT_UINT_SIZE], uint32_t value, uint8_t minimum)
+{
+    uint32_t r;
+    uint8_t n = 0;
+
+    do {
+        value = Div10(value, &r);
+        digits[n++] = (char)('0' + r);
+    } while (value || (n < minimum));
+    return n;
+}
+
+static char *Pad(char *out, uint8_t length, uint8_t width, char pad)
+{
+    while (length < width) {
+        *out++ = pad;
+        length++;
+    }
+    return out;
+}
+
+static char *Reverse(char *out, const char *digits, uint8_t n)
+{
+    while (n) {
+        *out++ = digits[--n];
+    }
+    return out;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+char *Format_Uint(char *out, uint32_t value, uint8_t width, char pad)
+{
+    char digits[FORMAT_UINT_SIZE];
+    uint8_t n = Digits(digits, value, 1);
+
+    out = Pad(out, n, width, pad);
+    return Reverse(out, digits, n);
+}
+
+char *Format_Int(char *out, int32_t value, uint8_t width, char pad)
+{
+    char digits[FORMAT_UINT_SIZE];
+    uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+    uint8_t n = Digits(digits, magnitude, 1);
+    uint8_t length = (uint8_t)(n + (value < 0));
+
+    if (pad != '0') {
+        out = Pad(out, length, width, pad);
+    }
+    if (value < 0) {
+        *out++ = '-';
+    }
+    if (pad == '0') {
+        out = Pad(out, length, width, pad);
+    }
+    return Reverse(out, digits, n);
+}
+
+char *Format_Tenths(char *out, int32_t tenths, uint8_t width)
+{
+    char digits[FORMAT_UINT_SIZE];
+    uint32_t magnitude = (tenths < 0) ? 0u - (uint32_t)tenths : (uint32_t)tenths;
+    uint8_t n = Digits(digits, magnitude, 2);
+
+    out = Pad(out, (uint8_t)(n + 1 + (tenths < 0)), width, ' ');
+    if (tenths < 0) {
+        *out++ = '-';
+    }
+    out = Reverse(out, &digits[1], (uint8_t)(n - 1));
+    *out++ = '.';
+    *out++ = digits[0];
+    return out;
+}
+
+char *Format_Time(char *out, uint8_t hours, uint8_t minutes, char separator)
+{
+    out = Format_Uint(out, hours, 2, '0');
+    *out++ = separator;
+    return Format_Uint(out, minutes, 2, '0');
+}
+
+char *Format_Date(char *out, uint32_t year, uint8_t month, uint8_t day)
+{
+    out = Format_Uint(out, year, 0, '0');
+    *out++ = '-';
+    out = Format_Uint(out, month, 2, '0');
+    *out++ = '-';
+    return Format_Uint(out, day, 2, '0');
+}
+
+char *Format_Hex(char *out, const uint8_t *bytes, uint8_t count)
+{
+    static const char sHex[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+    while (count--) {
+        *out++ = sHex[*bytes >> 4];
+        *out++ = sHex[*bytes & 0x0F];
+        bytes++;
+    }
+    return out;
+}
+
+// end file
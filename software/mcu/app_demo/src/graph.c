@@ -0,0 +1,135 @@
+/*
+ * graph.c
+ *
+ * Layout of the upper six pages:
+ *   columns 0 - 41:   maximum label at page 0-1, minimum label at page 4-5, right aligned
+ *   columns 44 - 127: the plot, 48 rows high
+ */
+#include <string.h>
+#include "board.h"
+#include "ssd1306.h"
+#include "format.h"
+#include "graph.h"
+#include "layout.h"
+
+#define GRAPH_LAST_PAGE     5
+#define LABEL_MAX_Y         0
+#define LABEL_MIN_Y         4
+#define PLOT_X              44
+#define PLOT_W              (SSD1306_WIDTH - PLOT_X)
+#define PLOT_H              ((GRAPH_LAST_PAGE + 1) * 8)
+
+static int      sValues[GRAPH_MAX_VALUES];
+static uint8_t  sCount;
+static bool     sShown;
+
+/* Pixels outside the plot, e.g. from a marker at its edge, would land in the line below the graph */
+static void PlotPixel(int x, int y)
+{
+    if ((x >= PLOT_X) && (x < SSD1306_WIDTH) && (y >= 0) && (y < PLOT_H)) {
+        OLED_DrawPixel((uint8_t)x, (uint8_t)y);
+    }
+}
+
+/* Integer only line from (x0, y0) to (x1, y1), both ends included */
+static void DrawLine(int x0, int y0, int x1, int y1)
+{
+    int dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    int dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+    int err = dx + dy;
+    int e2;
+
+    for (;;) {
+        PlotPixel(x0, y0);
+        if ((x0 == x1) && (y0 == y1)) {
+            break;
+        }
+        e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void DrawLabel(uint8_t y, int value)
+{
+    LAYOUT_BOX_T box = {&Font8x16, 0, PLOT_X - 2, y, LAYOUT_ALIGN_RIGHT};
+    char str[FORMAT_TENTHS_SIZE + 1];
+
+    *Format_Tenths(str, value, 0) = '\0';
+    Layout_Draw(&box, str);
+}
+
+void Graph_Show(const int *values, uint8_t count)
+{
+    int min;
+    int max;
+    int x;
+    int y;
+    int prevX = 0;
+    int prevY = 0;
+    uint8_t i;
+
+    if (count > GRAPH_MAX_VALUES) {
+        values += count - GRAPH_MAX_VALUES;
+        count = GRAPH_MAX_VALUES;
+    }
+    if (sShown && (count == sCount) && (memcmp(values, sValues, count * sizeof(int)) == 0)) {
+        return;
+    }
+    memcpy(sValues, values, count * sizeof(int));
+    sCount = count;
+    sShown = true;
+
+    OLED_ClearPages(0, GRAPH_LAST_PAGE);
+    if (count > 0) {
+        min = max = values[0];
+        for (i = 1; i < count; i++) {
+            if (values[i] < min) {
+                min = values[i];
+            }
+            if (values[i] > max) {
+                max = values[i];
+            }
+        }
+        DrawLabel(LABEL_MAX_Y, max);
+        DrawLabel(LABEL_MIN_Y, min);
+        if (max == min) {
+            /* A flat line is drawn half way */
+            max++;
+            min--;
+        }
+        for (i = 0; (count > 1) && (i < count); i++) {
+            x = PLOT_X + (i * (PLOT_W - 1)) / (count - 1);
+            y = (PLOT_H - 1) - ((values[i] - min) * (PLOT_H - 1)) / (max - min);
+            if (i > 0) {
+                DrawLine(prevX, prevY, x, y);
+            }
+            /* Marker: a small cross, clipped at the edges of the plot */
+            PlotPixel(x - 1, y);
+            PlotPixel(x + 1, y);
+            PlotPixel(x, y - 1);
+            PlotPixel(x, y + 1);
+            prevX = x;
+            prevY = y;
+        }
+    }
+    OLED_Flush();
+}
+
+bool Graph_Hide(void)
+{
+    if (!sShown) {
+        return false;
+    }
+    OLED_ClearPages(0, GRAPH_LAST_PAGE);
+    sShown = false;
+    return true;
+}
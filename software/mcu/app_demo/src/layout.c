@@ -0,0 +1,143 @@
+/*
+ * layout.c
+ *
+ * Glyphs are decoded straight from their compressed streams into the RAM copy, one byte per column and page, and
+ * only the columns inside the box are written.
+ */
+#include <string.h>
+#include "board.h"
+#include "ssd1306.h"
+#include "layout.h"
+
+/* Icons of the symbol escapes, indexed by the escape character */
+static const BITMAP_T * const sSymbols[] = {
+    NULL,
+    &Bmp_Degree,
+    &Bmp_AlarmSet,
+    &Bmp_AlarmClr,
+    &Bmp_BatteryFull,
+    &Bmp_BatteryMid,
+    &Bmp_BatteryLow,
+    &Bmp_BatteryEmpty,
+};
+
+/* Drawing position in a box */
+typedef struct {
+    int x;              // Next column to draw
+    int clipLeft;       // First column of the box
+    int clipRight;      // Column after the box
+    uint8_t page;
+    uint8_t pages;
+} PEN_T;
+
+/* What one character of a string draws */
+typedef struct {
+    const uint8_t *src;
+    uint8_t width;
+    uint8_t pages;
+    uint8_t left;
+    uint8_t advance;
+} ITEM_T;
+
+static void GetItem(const FONT_T *font, char c, ITEM_T *item)
+{
+    const char *p;
+    uint8_t index;
+
+    if ((c > 0) && ((uint8_t)c < sizeof(sSymbols) / sizeof(sSymbols[0]))) {
+        item->src = sSymbols[(uint8_t)c]->pData;
+        item->width = sSymbols[(uint8_t)c]->width;
+        item->pages = sSymbols[(uint8_t)c]->pages;
+        item->left = 0;
+        item->advance = (uint8_t)(item->width + 1);
+        return;
+    }
+    /* Characters left out by fontc.py are drawn as the first glyph, a space */
+    p = strchr(font->pChars, c);
+    index = (uint8_t)(p ? p - font->pChars : 0);
+    item->src = &font->pData[font->pOffset[index]];
+    item->width = font->width;
+    item->pages = font->pages;
+    item->left = font->pMetrics[index].left;
+    item->advance = font->pMetrics[index].advance;
+}
+
+static void PutColumn(const PEN_T *pen, int x, uint8_t page, uint8_t data)
+{
+    if ((x >= pen->clipLeft) && (x < pen->clipRight)) {
+        OLED_WriteColumn((uint8_t)x, (uint8_t)(pen->page + page), data);
+    }
+}
+
+/* Blanks all pages of the box from the pen up to column @a to */
+static void Blank(PEN_T *pen, int to)
+{
+    uint8_t page;
+
+    for (; pen->x < to; pen->x++) {
+        for (page = 0; page < pen->pages; page++) {
+            PutColumn(pen, pen->x, page, 0);
+        }
+    }
+}
+
+static void DrawItem(PEN_T *pen, const ITEM_T *item)
+{
+    FONT_STREAM_T stream = {item->src, 0, 0, false};
+    uint8_t page;
+    int col;
+    uint8_t data;
+
+    for (page = 0; page < pen->pages; page++) {
+        for (col = 0; col < item->left + item->advance; col++) {
+            /* Pages and columns beyond the glyph are part of its box: blank */
+            data = 0;
+            if ((page < item->pages) && (col < item->width)) {
+                data = Font_StreamNext(&stream);
+            }
+            if (col >= item->left) {
+                PutColumn(pen, pen->x + col - item->left, page, data);
+            }
+        }
+        /* Skip what is left of this page of the glyph */
+        for (; (page < item->pages) && (col < item->width); col++) {
+            (void)Font_StreamNext(&stream);
+        }
+    }
+    pen->x += item->advance;
+}
+
+int Layout_Measure(const FONT_T *font, const char *str)
+{
+    ITEM_T item;
+    int width = 0;
+
+    for (; *str; str++) {
+        GetItem(font, *str, &item);
+        width += item.advance;
+    }
+    return width;
+}
+
+int Layout_Draw(const LAYOUT_BOX_T *box, const char *str)
+{
+    PEN_T pen = {box->x, box->x, box->x + box->width, box->page, box->font->pages};
+    ITEM_T item;
+    int width = Layout_Measure(box->font, str);
+    int start = box->x;
+
+    if (box->align == LAYOUT_ALIGN_RIGHT) {
+        start += box->width - width;
+    }
+    else if (box->align == LAYOUT_ALIGN_CENTRE) {
+        start += (box->width - width) / 2;
+    }
+    Blank(&pen, start);
+    pen.x = start;
+    for (; *str; str++) {
+        GetItem(box->font, *str, &item);
+        DrawItem(&pen, &item);
+    }
+    Blank(&pen, pen.clipRight);
+    return width;
+}
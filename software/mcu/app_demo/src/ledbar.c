@@ -0,0 +1,119 @@
+/*
+ * ledbar.c
+ *
+ * The PWM callback only writes the mask of the level or 0; everything else is set up by LedBar_Show with the callback
+ * stopped.
+ */
+#include "board.h"
+#include "timer.h"
+#include "profile.h"
+#include "ledbar.h"
+
+/* The pins of the first n LEDs */
+static const uint16_t sLevelMask[LEDBAR_COUNT + 1] = {
+    0,
+    (1 << 0),
+    (1 << 0) | (1 << 1),
+    (1 << 0) | (1 << 1) | (1 << 2),
+    (1 << 0) | (1 << 1) | (1 << 2) | (1 << 6),
+    (1 << 0) | (1 << 1) | (1 << 2) | (1 << 6) | (1 << 8),
+    LEDBAR_PINS,
+};
+
+#define PERIOD_TICKS        (LEDBAR_PERIOD_US * (TIMER_TICK_HZ / 1000000))
+
+/* Fails to compile when the duty does not divide the period into whole ticks */
+static char sTestPeriod[(PERIOD_TICKS % LEDBAR_DUTY_FULL == 0) - 1] __attribute__((unused));
+
+static int16_t sThresholds[LEDBAR_COUNT - 1];
+static uint8_t sLevel;
+static uint8_t sDuty;
+static uint32_t sMask;
+static uint32_t sOnTicks;
+static bool sOn;
+
+/* Start of the time not yet added to the profile */
+static uint32_t sSince;
+
+/* Flips the pins at each edge of the PWM; returns the ticks until the next edge */
+static uint32_t Pwm(void)
+{
+    sOn = !sOn;
+    NSS_GPIO->DATA[LEDBAR_PINS] = sOn ? sMask : 0;
+    return sOn ? sOnTicks : PERIOD_TICKS - sOnTicks;
+}
+
+/* Adds the LED time since the previous call to the profile */
+static void Account(void)
+{
+    uint32_t now = Timer_GetFreeRunning();
+
+    Profile_AddLed(((now - sSince) >> LEDBAR_DUTY_BITS) * sDuty * sLevel);
+    sSince = now;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void LedBar_SetThresholds(const int16_t thresholds[LEDBAR_COUNT - 1])
+{
+    int n;
+
+    for (n = 0; n < LEDBAR_COUNT - 1; n++) {
+        sThresholds[n] = thresholds[n];
+    }
+}
+
+uint8_t LedBar_Level(int temperature)
+{
+    uint8_t level = 1;
+    int n;
+
+    for (n = 0; n < LEDBAR_COUNT - 1; n++) {
+        if (temperature > sThresholds[n]) {
+            level++;
+        }
+    }
+    return level;
+}
+
+void LedBar_Show(uint8_t level, uint8_t duty)
+{
+    if (level > LEDBAR_COUNT) {
+        level = LEDBAR_COUNT;
+    }
+    if (duty > LEDBAR_DUTY_FULL) {
+        duty = LEDBAR_DUTY_FULL;
+    }
+    if ((level == 0) || (duty == 0)) {
+        level = 0;
+        duty = 0;
+    }
+    Account();
+    if ((level == sLevel) && (duty == sDuty)) {
+        return;
+    }
+
+    Timer_StopCallback();
+    sLevel = level;
+    sDuty = duty;
+    sMask = sLevelMask[level];
+    sOnTicks = PERIOD_TICKS / LEDBAR_DUTY_FULL * duty;
+    NSS_GPIO->DATA[LEDBAR_PINS] = sMask;
+    if ((duty != 0) && (duty != LEDBAR_DUTY_FULL)) {
+        /* On now, off after the duty */
+        sOn = true;
+        Timer_StartCallback(sOnTicks, Pwm);
+    }
+}
+
+uint8_t LedBar_GetLevel(void)
+{
+    return sLevel;
+}
+
+void LedBar_Off(void)
+{
+    LedBar_Show(0, 0);
+}
+
+// end file
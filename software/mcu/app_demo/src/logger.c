@@ -0,0 +1,229 @@
+/*
+ * logger.c
+ */
+#include "board.h"
+#include "tmeas/tmeas.h"
+#include "storage/storage.h"
+#include "timer.h"
+#include "logger.h"
+#include "drift.h"
+
+#if LOGGER_STAGED_MAX * STORAGE_BITSIZE > LOGGER_RETAINED_COUNT_SHIFT
+#error The staged samples do not fit in the retained register
+#endif
+
+static volatile int sSample;
+
+/* Sign extends a staged sample */
+static STORAGE_TYPE Unpack(uint32_t status, int n)
+{
+    uint32_t bits = (status >> (n * STORAGE_BITSIZE)) & LOGGER_RETAINED_SAMPLE_MASK;
+
+#if STORAGE_SIGNED
+    if (bits & (1u << (STORAGE_BITSIZE - 1))) {
+        bits |= ~LOGGER_RETAINED_SAMPLE_MASK;
+    }
+#endif
+    return (STORAGE_TYPE)bits;
+}
+
+/* Writes the staged samples, and the new one if count is one more than staged; returns the status without them */
+static uint32_t Commit(uint32_t status, int count, int value)
+{
+    STORAGE_TYPE samples[LOGGER_BATCH];
+    int staged = (int)((status >> LOGGER_RETAINED_COUNT_SHIFT) & LOGGER_RETAINED_COUNT_MASK);
+    int n;
+
+    for (n = 0; n < staged; n++) {
+        samples[n] = Unpack(status, n);
+    }
+    if (count > staged) {
+        samples[n] = (STORAGE_TYPE)value;
+    }
+    if (count > 0) {
+        (void)Storage_Write(samples, count);
+    }
+    return status & ~((LOGGER_RETAINED_COUNT_MASK << LOGGER_RETAINED_COUNT_SHIFT) | ((1u << LOGGER_RETAINED_COUNT_SHIFT) - 1));
+}
+
+/* -------------------------------------------------------------------------------- */
+
+uint32_t Logger_SecondsToSample(void)
+{
+    uint32_t now = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+
+    return LOGGER_INTERVAL_SECONDS - (now % LOGGER_INTERVAL_SECONDS);
+}
+
+void Logger_Store(int value)
+{
+    STORAGE_TYPE sample = (STORAGE_TYPE)value;
+
+    (void)Storage_Write(&sample, 1);
+}
+
+void Logger_TmeasCb(int value)
+{
+    sSample = value;
+}
+
+void Logger_Clear(void)
+{
+    uint32_t status = 0;
+
+    Chip_PMU_SetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+}
+
+void Logger_Flush(void)
+{
+    uint32_t status;
+    int staged;
+
+    Chip_PMU_GetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+    staged = (int)((status >> LOGGER_RETAINED_COUNT_SHIFT) & LOGGER_RETAINED_COUNT_MASK);
+    if (staged > LOGGER_STAGED_MAX) {
+        /* Not written by this firmware: nothing to recover */
+        staged = 0;
+        status = 0;
+    }
+    if (staged > 0) {
+        status = Commit(status, staged, 0);
+        Chip_PMU_SetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+    }
+}
+
+void Logger_SampleAndSleep(uint32_t wakeSeconds)
+{
+    uint32_t status;
+    uint32_t us;
+    uint32_t staged;
+    uint32_t units;
+    bool bod;
+
+    /* Counts from here: the start-up before main is not included */
+    Timer_StartFreeRunning();
+
+    Chip_PMU_SetBODEnabled(true);
+    bod = ((Chip_PMU_GetStatus() & PMU_STATUS_BROWNOUT) != 0);
+    Chip_PMU_SetBODEnabled(false);
+
+    Chip_PMU_GetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+    staged = (status >> LOGGER_RETAINED_COUNT_SHIFT) & LOGGER_RETAINED_COUNT_MASK;
+    if (staged > LOGGER_STAGED_MAX) {
+        staged = 0;
+        status = 0;
+    }
+    status &= ~LOGGER_RETAINED_COMMITTED;
+
+    if (TMeas_Measure(TSEN_10BITS, TMEAS_FORMAT_CELSIUS, false, LOGGER_TMEAS_CONTEXT) != TMEAS_ERROR) {
+        TMeas_Wait();
+
+        if ((staged < LOGGER_STAGED_MAX) && !bod) {
+            /* Stage: no EEPROM access at all */
+            status |= ((uint32_t)sSample & LOGGER_RETAINED_SAMPLE_MASK) << (staged * STORAGE_BITSIZE);
+            status &= ~(LOGGER_RETAINED_COUNT_MASK << LOGGER_RETAINED_COUNT_SHIFT);
+            status |= (staged + 1) << LOGGER_RETAINED_COUNT_SHIFT;
+        }
+        else {
+            /* A full batch, or the battery is running out: one write for all */
+            Chip_EEPROM_Init(NSS_EEPROM);
+            Storage_Init();
+            status = Commit(status, (int)staged + 1, sSample);
+            /* RTCCAL until the next batch */
+            Drift_Apply(sSample, LOGGER_SECONDS_TO_COMMIT(wakeSeconds));
+            Storage_DeInit();
+            Chip_EEPROM_DeInit(NSS_EEPROM);
+            status |= LOGGER_RETAINED_COMMITTED;
+        }
+    }
+
+    Timer_StartMeasurementTimeout((int)wakeSeconds);
+
+    us = Timer_GetFreeRunning() / (TIMER_TICK_HZ / 1000000);
+    Timer_StopFreeRunning();
+    units = (us + LOGGER_RETAINED_WAKE_UNIT_US - 1) / LOGGER_RETAINED_WAKE_UNIT_US;
+    if (units > LOGGER_RETAINED_WAKE_MASK) {
+        units = LOGGER_RETAINED_WAKE_MASK;
+    }
+    status &= ~(LOGGER_RETAINED_WAKE_MASK << LOGGER_RETAINED_WAKE_SHIFT);
+    status |= units << LOGGER_RETAINED_WAKE_SHIFT;
+    if (us > LOGGER_BUDGET_US) {
+        status |= LOGGER_RETAINED_OVER_BUDGET;
+    }
+    Chip_PMU_SetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+
+    Chip_PMU_PowerMode_EnterDeepPowerDown(bod);
+    for (;;);
+}
+
+bool Logger_GetMean(uint32_t seconds, int *mean)
+{
+    STORAGE_TYPE samples[16];
+    int count = Storage_GetCount();
+    int want = (int)(seconds / LOGGER_INTERVAL_SECONDS);
+    int read;
+    int n;
+    int32_t sum = 0;
+    int total = 0;
+
+    if (want > count) {
+        want = count;
+    }
+    if ((want <= 0) || !Storage_Seek(count - want)) {
+        return false;
+    }
+    do {
+        read = Storage_Read(samples, (want - total < 16) ? want - total : 16);
+        for (n = 0; n < read; n++) {
+            sum += samples[n];
+        }
+        total += read;
+    } while ((read > 0) && (total < want));
+    if (!total) {
+        return false;
+    }
+    *mean = (int)(sum / total);
+    return true;
+}
+
+int Logger_GetLast(int *samples, int max)
+{
+    STORAGE_TYPE chunk[16];
+    int count = Storage_GetCount();
+    int want = (max < count) ? max : count;
+    int read;
+    int n;
+    int total = 0;
+
+    if ((want <= 0) || !Storage_Seek(count - want)) {
+        return 0;
+    }
+    do {
+        read = Storage_Read(chunk, (want - total < 16) ? want - total : 16);
+        for (n = 0; n < read; n++) {
+            samples[total + n] = chunk[n];
+        }
+        total += read;
+    } while ((read > 0) && (total < want));
+    return total;
+}
+
+uint32_t Logger_GetLastWake(bool *overBudget, bool *committed, bool clear)
+{
+    uint32_t status;
+
+    Chip_PMU_GetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+    if (overBudget) {
+        *overBudget = ((status & LOGGER_RETAINED_OVER_BUDGET) != 0);
+    }
+    if (committed) {
+        *committed = ((status & LOGGER_RETAINED_COMMITTED) != 0);
+    }
+    if (clear && (status & LOGGER_RETAINED_OVER_BUDGET)) {
+        status &= ~LOGGER_RETAINED_OVER_BUDGET;
+        Chip_PMU_SetRetainedData(&status, LOGGER_RETAINED_WORD, 1);
+    }
+    return ((status >> LOGGER_RETAINED_WAKE_SHIFT) & LOGGER_RETAINED_WAKE_MASK) * LOGGER_RETAINED_WAKE_UNIT_US;
+}
+
+// end file
@@ -16,6 +16,15 @@
 #include "ndeft2t/ndeft2t.h"
 #include "tmeas/tmeas.h"
 #include "timer.h"
+#include "event.h"
+#include "swtimer.h"
+#include "logger.h"
+#include "clock.h"
+#include "profile.h"
+#include "alarm.h"
+#include "drift.h"
+#include "zone.h"
+#include "format.h"
 
 #include "validate.h"
 
@@ -29,6 +38,11 @@
 #include "main.h"
 
 #include "ssd1306.h"
+#include "clockface.h"
+#include "textscroll.h"
+#include "graph.h"
+#include "brightness.h"
+#include "ledbar.h"
 #include "buzzer.h"
 #include "rtc.h"
 
@@ -38,6 +52,25 @@
 
 static void Init(void);
 static void DeInit(void);
+static void DisplayOn(void);
+static void DisplayOff(void);
+static void OnTick(const EVENT_T *event);
+static void OnTemperature(const EVENT_T *event);
+static void OnNfcField(const EVENT_T *event);
+static void OnNfcMessage(const EVENT_T *event);
+static void OnSecond(void);
+static void OnAwakeEnd(void);
+static void OnAlarm(void);
+static void RecordHistory(void);
+static void LogSample(void);
+static void PollHostCommand(void);
+static uint32_t SecondsToWake(void);
+static bool IsSampleWake(void);
+static void GetLocalTime(void);
+static int FormatTemperatures(char *text);
+static void SetLedThresholds(void);
+static uint8_t LedDuty(void);
+static void ShowLeds(void);
 
 
 /** Application's main entry point. Declared here since it is referenced in ResetISR. */
@@ -56,11 +89,23 @@ static      uint8_t     sNdefInstance[NDEFT2T_INSTANCE_SIZE];
 volatile    bool        sTargetWritten = false;               // nfc reader want to write or not flag
 volatile    bool        g_nfcOn        = false;               // nfc reader touched or not flag
 
+static      SWTIMER_T   sSecondTimer;                         // display and measurement, every second while awake
+static      SWTIMER_T   sAwakeTimer;                          // end of the display window, see StayAwake
+static      SWTIMER_T   sHistoryTimer;                        // temperature history, every g_TempPeriod
+static      SWTIMER_T   sHostTimer;                           // waiting for the command of a written message, see PollHostCommand
+static      SWTIMER_T   sAlarmTimer;                          // next alarm of the table, also wakes the IC from deep power down
+static      SWTIMER_T   sLogTimer;                            // temperature log while awake, see logger.h
+static      PMU_DPD_WAKEUPREASON_T sWakeupReason;             // why the IC left deep power down
+static      bool        sProfileRequested;                    // the phone wrote "PRF": the NDEF message carries the profile
+static      char        sProfileText[PROFILE_FORMAT_SIZE];
+static      bool        sProbeRequested;                      // the phone wrote "PRB": the NDEF message carries the probes
+static      uint8_t     sProbeRecord[2 + PROBE_RESPONSE_SIZE];    // msg header, then the response to APP_MSG_ID_GETPROFILE
+static      uint8_t     sMime[] = MIME;                       // type of the record, as for the responses of the msg mod
+
 volatile    uint32_t    g_TemperatureValue	 = 0;             // Temperature value from LPC8N04 internal
 volatile    uint32_t    g_TemperatureoFValue = 0;             // Temperature value from LPC8N04 internal convert to oF
 volatile    uint32_t    g_TempRecord[5];                      // Temperature value record in every 5sec/1min/5mins
 
-volatile    uint8_t     g_OLEDDispBuf[4][16];                 // OLED display Buffer
 
 volatile    uint16_t    hostTimeout;                          // main time out value
 volatile    uint16_t    hostTicks;                            // main timer count value
@@ -71,8 +116,7 @@ volatile    uint32_t    g_LedStatus    = 0;                   // Led GPIO config
 volatile    uint32_t    g_TempSettings = 0;                   // Temperature sampling settings.
 
 volatile    RTC_VALUE_T g_sRTCValue;                          // RTC Value
-volatile    uint8_t     g_AlarmHour    = 0;                   // Alarm Hour
-volatile    uint8_t     g_AlarmMin     = 0;                   // Alarm Min
+volatile    uint16_t    g_AlarmNext    = 0;                   // Minute of the week of the next alarm, see alarm.h
 volatile    uint32_t    g_AlarmCnt     = 0;                   // Alarm counter
 
 volatile    uint8_t     g_MotorFlag    = 0;                   // 0-Disable Vibration Motor, 1-Enable Vibration Motor
@@ -80,7 +124,7 @@ volatile    uint32_t    g_MotorEnTime  = 0;                   // Decide moto vib
 
 const       char        g_taglang[2]   = "en";                // For NDEF header, english charactors
 
-volatile    uint8_t     g_TextModeFlag = 0;                   // TODO, MGN, Display Text from MobilePhone, 0-display date, 1-display text
+volatile    uint8_t     g_TextModeFlag = 0;                   // Display Text from MobilePhone, 0-display date, 1-display text
 
 volatile    uint8_t     g_AlarmEnFlag  = 0;                   // Alarm enable flag, 0-disable, 1-enable
 volatile    uint8_t     g_TempUnitType = 0;                   // Temperature Unit Type , 0-oC, 1-F
@@ -104,6 +148,7 @@ volatile    uint32_t    g_MainTickCnt  = 0;                 // Main Ticks, help
 volatile    uint8_t     g_OLEDInitFlag = 0;                 // 0 - not init, 1 - inited
 
 volatile    uint32_t    g_LPC8N04PSTAT = 0;                 // Save LPC8N04 PSTAT register as temp
+volatile    uint8_t     g_BatteryLow   = 0;                 // 1 - battery below the brown-out level when the OLED came on
 
 volatile	NDEFT2T_CREATE_RECORD_INFO_T g_recordInfo;
 
@@ -144,6 +189,7 @@ void NDEFT2T_FieldStatus_Cb(bool status)
         hostTicks = 0;
         g_nfcOn = false;
     }
+    Event_Post(EVENT_NFC_FIELD, status);
 }
 
 /** Called under interrupt. @see #NDEFT2T_MSG_AVAILABLE_CB. */
@@ -152,6 +198,7 @@ void NDEFT2T_MsgAvailable_Cb(void)
     sTargetWritten = true;
     hostTimeout = HOST_TIMEOUT;
     hostTicks = 0;
+    Event_Post(EVENT_NFC_MESSAGE, 0);
 }
 
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -175,6 +222,7 @@ void TMEAS_CB(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, ui
              */
             /* resolution == TSEN_10BITS */
             g_TemperatureValue = value;
+            Event_Post(EVENT_TEMPERATURE, value);
             break;
 
         case 1:
@@ -183,6 +231,11 @@ void TMEAS_CB(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, ui
             AppMsgHandlerSendMeasureTemperatureResponse(value != TMEAS_ERROR, (int16_t)value);
             break;
 
+        case LOGGER_TMEAS_CONTEXT:
+            /* A sample for the log, taken in the fast path of an RTC wake-up */
+            Logger_TmeasCb(value);
+            break;
+
         default:
             /* This value will be used in the initial response. We're still initializing everything at this point.
              * Unconditionally store the value for immediate use in the main thread.
@@ -193,89 +246,48 @@ void TMEAS_CB(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, ui
     }
 }
 
-// Calculate LED display numbers
-uint8_t led_light_calc(uint8_t unit)
+/**
+ * The thresholds of the LED bar, from the base and the step of g_TempSettings in the unit shown: LED3 comes on above
+ * the base, the others a step apart.
+ */
+static void SetLedThresholds(void)
 {
-    uint32_t Step = 0;
-    uint32_t g_TemperatureBase = 0;
-    uint32_t g_TemperatureValueTmp = 0;
+    int16_t thresholds[LEDBAR_COUNT - 1];
+    int base;
+    int step;
+    int n;
 
     /* unit = 0: oC */
     /* unit = 1: oF */
-    if(unit == 0) {
-        g_TemperatureValueTmp = g_TemperatureValue;
-        g_TemperatureBase = (((g_TempSettings >> 16) & 0x00FF) +20) * 10;
-        Step = (((g_TempSettings >> 8)  & 0x00FF) + 1) * 5;
+    if(g_TempUnitType == 0) {
+        base = (int)(((g_TempSettings >> 16) & 0x00FF) + 20) * 10;
+        step = (int)(((g_TempSettings >> 8)  & 0x00FF) + 1) * 5;
     }
     else {
-        g_TemperatureValueTmp = (g_TemperatureValue*18+3200)/10;
-        g_TemperatureBase = (((g_TempSettings >> 16) & 0x00FF) +68) * 10;
-        Step = (((g_TempSettings >> 8)  & 0x00FF) + 1) * 10;
-    }
-    /* turn on of off leds based on temperature values */
-    if(g_TemperatureValueTmp  <= (g_TemperatureBase-2*Step)) {
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-        return 1;
-    }
-    if( (g_TemperatureValueTmp > (g_TemperatureBase-2*Step)) && (g_TemperatureValueTmp <= (g_TemperatureBase-1*Step))) {
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-        return 2;
-    }
-    if( (g_TemperatureValueTmp > (g_TemperatureBase-1*Step)) && (g_TemperatureValueTmp <= (g_TemperatureBase-0*Step))) {
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-        return 3;
-    }
-    if( (g_TemperatureValueTmp > (g_TemperatureBase-0*Step)) && (g_TemperatureValueTmp <= (g_TemperatureBase+1*Step))) {
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 0);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-        return 4;
-    }
-    if( (g_TemperatureValueTmp > (g_TemperatureBase+1*Step)) && (g_TemperatureValueTmp <= (g_TemperatureBase+2*Step))) {
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-        return 5;
-    }
-    if( (g_TemperatureValueTmp > (g_TemperatureBase+2*Step))) {
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 1);
-        Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 1);
-        return 6;
-    }
-
-    /* Clear up LED, should never run */
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-    return 0;
+        base = (int)(((g_TempSettings >> 16) & 0x00FF) + 68) * 10;
+        step = (int)(((g_TempSettings >> 8)  & 0x00FF) + 1) * 10;
+    }
+    for(n = 0; n < LEDBAR_COUNT - 1; n++) {
+        thresholds[n] = (int16_t)(base + (n - 2) * step);
+    }
+    LedBar_SetThresholds(thresholds);
+}
+
+/* Duty of the LED bar in the brightness profile of the hour */
+static uint8_t LedDuty(void)
+{
+    return g_BrightnessProfiles[Brightness_Select(g_sRTCValue.HOURS, (g_BatteryLow == 1))].ledDuty;
+}
+
+/* Shows the temperature, in the unit of the thresholds, on the LED bar */
+static void ShowLeds(void)
+{
+    int temperature = (int)g_TemperatureValue;
+
+    if(g_TempUnitType == 1) {
+        temperature = (temperature*18+3200)/10;
+    }
+    LedBar_Show(LedBar_Level(temperature), LedDuty());
 }
 
 /* Initialize System */
@@ -287,14 +299,7 @@ static void Init(void)
      */
     Board_Init();
 
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 1, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 2, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 6, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 8, 0);
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 9, 0);
-
-    Chip_GPIO_SetPinState(NSS_GPIO, 0, 7, 0);
+    NSS_GPIO->DATA[LEDBAR_PINS] = 0;
 
     // LED0
     Chip_IOCON_SetPinConfig(NSS_IOCON, 0, IOCON_FUNC_0 | IOCON_RMODE_PULLUP);
@@ -319,14 +324,21 @@ static void Init(void)
     Chip_IOCON_SetPinConfig(NSS_IOCON, 7, IOCON_FUNC_0 | IOCON_RMODE_PULLUP);
     Chip_GPIO_SetPinDIROutput(NSS_GPIO, 0, 7);
 
-    // OLED Power disable
+    Chip_PMU_GetRetainedData(&g_LedStatus, 3, 1);
+    if( (g_LedStatus&0xFFFF0000) != RETAINED_STATUS_HEADER ) {
+        g_LedStatus = RETAINED_STATUS_HEADER;       // added a header and this will let system know this is not the first reset.
+        Chip_PMU_SetRetainedData(&g_LedStatus, 3, 1);   // Save Status in PUM_BUF[3]
+        Logger_Clear();                                 // Nothing staged survives a power-on reset
+    }
+
+    // OLED Power disable: the pins were tri-stated in deep power down, the panel lost its supply and needs ssd1306_init
     Chip_GPIO_SetPinState(NSS_GPIO, 0, 7, 0);
 
-    // Measurement temperature at the beginning
+    // Measurement temperature at the beginning, sleeping during the conversion
+    Timer_StartFreeRunning();       // Time base of the event statistics, of TMeas_GetStats and of the profile
+    Profile_Init();
     TMeas_Measure(TSEN_10BITS, TMEAS_FORMAT_CELSIUS, false, 0 /* Value used in App_TmeasCb */);
-        while (Chip_TSen_ReadStatus(NSS_TSEN, NULL) & TSEN_STATUS_SENSOR_IN_OPERATION) {
-        ; /* Wait until the temperature has become available in sQuickMeasurement. */
-    }
+    TMeas_Wait();
 
     // Temperature LED display settings
     // bit 31:28   27:24   23:20   19:16   15:12   11:8    7:3     3:0
@@ -337,11 +349,6 @@ static void Init(void)
         Chip_PMU_SetRetainedData(&g_TempSettings, 1, 1);
     }
 
-    Chip_PMU_GetRetainedData(&g_LedStatus, 3, 1);
-
-    g_LedStatus = 0xAA550000;                       // added a header and this will let system know this is not the first reset.
-    Chip_PMU_SetRetainedData(&g_LedStatus, 3, 1);   // Save Status in PUM_BUF[3]
-
     /* Reduce power consumption by adding a pull-down. The default register values after a reset do
      * not have enabled these pulls. The functionality of the SWD pins are kept.
      */
@@ -351,7 +358,12 @@ static void Init(void)
     Chip_NFC_Init(NSS_NFC);         // NFC initilize
     NDEFT2T_Init();                 // NFC NDEF format
 
+    Clock_Init();                   // From here on the clock follows the workload, see clock.h
     Chip_EEPROM_Init(NSS_EEPROM);   // Initial System EEPROM
+    Storage_Init();                 // Temperature log, see logger.h
+    Logger_Flush();                 // Samples staged in deep power down go first
+    Alarm_Load();                   // Alarms, see alarm.h
+    Zone_Load();                    // Time zone, see zone.h
     Timer_Init();                   // Timer Initilize
     Validate_Init();
 
@@ -391,20 +403,33 @@ static void Init(void)
  */
 static void DeInit(void)
 {
+    uint32_t wake;
     bool bod;
 
     NDEFT2T_DeInit();
+    Profile_Enter(PROFILE_REGION_EEPROM);
+    Storage_DeInit();
+    Profile_Exit(PROFILE_REGION_EEPROM);
+    LedBar_Off();
     NVIC_DisableIRQ(CT32B0_IRQn);
     buzzer_stop();
 
     // Config GPIO as low for low power consumption
     NSS_GPIO->DATA[0xFFF] = 0x0000;
 
+    Profile_Save();
+
     Chip_PMU_SetBODEnabled(true);
     bod = ((Chip_PMU_GetStatus() & PMU_STATUS_BROWNOUT) != 0);
     Chip_PMU_SetBODEnabled(false);
 
-    Timer_StartMeasurementTimeout(10);
+    /* The timers are lost in deep power down: only the log and the alarm need to wake the IC, the NFC field wakes it
+     * anyway
+     */
+    wake = SecondsToWake();
+    /* RTCCAL until the logger opens the EEPROM again */
+    Drift_Apply((int)g_TemperatureValue, LOGGER_SECONDS_TO_COMMIT(wake));
+    Timer_StartMeasurementTimeout((int)wake);
     // Enter deep power down - low power mode
     Chip_PMU_PowerMode_EnterDeepPowerDown(bod);
 
@@ -418,434 +443,723 @@ static void DeInit(void)
 }
 
 
-/* -------------------------------------------------------------------------------- */
-int main(void)
+/**
+ * Brings up the OLED panel: it is power cycled and fully configured, as it lost its supply in deep power down.
+ */
+static void DisplayOn(void)
 {
-    PMU_DPD_WAKEUPREASON_T wakeupReason;
+    ssd1306_init();
+    /* Sampled once per wake-up, as in DeInit: the brightness profile and battery icon follow it */
+    Chip_PMU_SetBODEnabled(true);
+    g_BatteryLow = ((Chip_PMU_GetStatus() & PMU_STATUS_BROWNOUT) != 0);
+    Chip_PMU_SetBODEnabled(false);
+    /* The RAM copy of the frame starts blank: render every cell again */
+    Graph_Hide();
+    ClockFace_Invalidate();
+    if(g_TextModeFlag == 1) {
+        TextScroll_Start();
+    }
+    g_OLEDInitFlag = 1;
+}
 
-    Init();
+/**
+ * Collects the temperature history for the graph: the last samples of the log, one per LOGGER_INTERVAL_SECONDS, oldest
+ * first, followed by the current temperature, all in the unit shown.
+ * @param values Receives at most GRAPH_MAX_VALUES values, in tenths of a degree.
+ * @return The number of values.
+ */
+static uint8_t GetHistory(int *values)
+{
+    uint8_t count;
+    uint8_t i;
+
+    count = (uint8_t)Logger_GetLast(values, GRAPH_MAX_VALUES - 1);
+    values[count++] = (int)g_TemperatureValue;
+    if(g_TempUnitType == 1) {
+        for(i = 0; i < count; i++) {
+            values[i] = (values[i]*18+3200)/10;
+        }
+    }
+    return count;
+}
 
-    Timer_StartMeasurementTimeout(1);                // Set 1Seconds period and update lcd
+/**
+ * Writes the text record of the NDEF message, as "TEMP0%5dTEMP1%5d...TEMP5%5d\r\n" did: the current temperature,
+ * then the five records, in tenths of a degree Celsius.
+ * @param text Receives at most 6 * 10 + 2 characters and a NUL.
+ * @return The length of the text, without the NUL.
+ */
+static int FormatTemperatures(char *text)
+{
+    char *p = text;
+    uint8_t i;
+
+    for(i = 0; i < 6; i++) {
+        *p++ = 'T';
+        *p++ = 'E';
+        *p++ = 'M';
+        *p++ = 'P';
+        *p++ = (char)('0' + i);
+        p = Format_Int(p, (int32_t)((i == 0) ? g_TemperatureValue : g_TempRecord[i-1]), 5, ' ');
+    }
+    *p++ = '\r';
+    *p++ = '\n';
+    *p = '\0';
+    return (int)(p - text);
+}
 
+/**
+ * Turns the OLED panel off before deep power down, which tri-states the supply pin anyway: the panel keeps nothing.
+ */
+static void DisplayOff(void)
+{
+    /* The scroll state of the panel goes with its supply */
+    TextScroll_Stop();
+    oled_lpw_enter();
     g_OLEDInitFlag = 0;
+}
 
-    Chip_PMU_GetRetainedData(&g_AppStatus, 0, 1);
+/* -------------------------------------------------------------------------------- */
 
-    /* first power-up */
-    if((g_AppStatus&0xFF000000) != 0x5A000000) {
-        /* Initialize RTC and OLED panel */
-        uint32_t iRTCSetTicks;
-        RTC_VALUE_T i_sRTCValueCal;
-        /* Set RTC date as 2017-11-22 23-59-20 */
-        i_sRTCValueCal.YEARS   = 2017;
-        i_sRTCValueCal.MONTHS  = 11;
-        i_sRTCValueCal.DAYS    = 22;
-        i_sRTCValueCal.HOURS   = 23;
-        i_sRTCValueCal.MINUTES = 59;
-        i_sRTCValueCal.SECONDS = 20;
-        iRTCSetTicks = RTC_Convert2Tick(&i_sRTCValueCal);
-        Chip_RTC_Time_SetValue(NSS_RTC, iRTCSetTicks);
-    }
+/**
+ * Keeps the IC awake and the display on for @a seconds from now: sAwakeTimer ends the window.
+ */
+static void StayAwake(uint32_t seconds)
+{
+    g_RTCTicksBak = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+    g_DispTimeCnt = seconds;
+    SwTimer_Start(&sAwakeTimer, seconds, 0, OnAwakeEnd);
+}
 
-    /* oled_lpw_exit(); */
-    /* Is Alarm Function Enabled? */
-    if( ((g_AppStatus>>23) & 0x01) == 0x01 )  g_AlarmEnFlag  = 1;
-    else                                      g_AlarmEnFlag  = 0;
-    /* Temperature Unit oC or F */
-    if( ((g_AppStatus>>22) & 0x01) == 0x01 )  g_TempUnitType = 1;
-    else                                      g_TempUnitType = 0;
-    /* Temperature Sampling */
-    if( ((g_AppStatus>>20) & 0x03) != 0x00 )  g_TempPeriod   = (g_AppStatus>>20) & 0x03;
-    else                                      g_TempPeriod   = 2;
-    /* Need Display a text or not */
-    if( ((g_AppStatus>>19) & 0x01) == 0x01 )  g_TextModeFlag = 1;
-    else                                      g_TextModeFlag = 0;
+/**
+ * The local date and time in g_sRTCValue, for the display: the RTC counts UTC, see zone.h.
+ */
+static void GetLocalTime(void)
+{
+    RTC_Ticks2Date(Zone_ToLocal((uint32_t)Chip_RTC_Time_GetValue(NSS_RTC)), &g_sRTCValue);
+}
 
-    /* Get Alarm Value */
-    g_AlarmHour = (g_AppStatus>>8)&0x000000FF;
-    g_AlarmMin  = (g_AppStatus>>0)&0x000000FF;
+/**
+ * Seconds until the next alarm, g_AlarmNext, 0 during its first ALARM_LATE_SECONDS.
+ */
+static uint32_t SecondsToAlarm(void)
+{
+    return Alarm_SecondsTo(g_AlarmNext, (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC));
+}
 
-    /* enter while loop */
-    g_AppStatus   = 1;                                  // Enter while() loop	
-    g_NFCDataUpdateFlag = 0;
-    /* Read Temperature Record first */
-    Chip_EEPROM_Read(NSS_EEPROM, 0, g_TempRecord, 20);
+/**
+ * (Re)starts or stops sAlarmTimer for the next alarm of the table, and sets g_AlarmEnFlag and g_AlarmNext after it.
+ * @param fired false after the table or the RTC changed: an alarm of the last ALARM_LATE_SECONDS still goes off.
+ *  true when the alarm just went off: the next one comes after it.
+ */
+static void StartAlarm(bool fired)
+{
+    uint32_t now = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+    uint32_t local = Zone_ToLocal(now);
+    uint32_t next = fired ? Alarm_Fired(local) : Alarm_Next(local - ALARM_LATE_SECONDS - 1);
+
+    if(next != ALARM_NONE) {
+        /* The table is in local time, the timer and the retained minute are in RTC time */
+        next = Zone_ToUtc(next);
+        g_AlarmEnFlag = 1;
+        g_AlarmNext   = Alarm_MinuteOfWeek(next);
+        SwTimer_Start(&sAlarmTimer, (next > now) ? next - now : 0, 0, OnAlarm);
+    }
+    else {
+        g_AlarmEnFlag = 0;
+        SwTimer_Stop(&sAlarmTimer);
+    }
+}
 
-    g_DispTimeCnt = 0;                                  // Will update in NFC Powered
+/** (Re)starts sHistoryTimer after g_TempPeriod changed. */
+static void StartHistory(void)
+{
+    /* Record temperature value every 5seconds, 1minutes or 5minutes */
+    static const uint16_t periods[4] = {0, 5, 60, 5*60};
 
-    while(g_AppStatus) {
-        /* Measurement Temperature */
-        /* Value used in App_TmeasCb */
-        TMeas_Measure(TSEN_10BITS, TMEAS_FORMAT_CELSIUS, false, 0);
-        while (Chip_TSen_ReadStatus(NSS_TSEN, NULL) & TSEN_STATUS_SENSOR_IN_OPERATION) {
-            ; /* Wait until the temperature has become available in sQuickMeasurement. */
-        }
+    if(periods[g_TempPeriod & 0x03] != 0)   SwTimer_Start(&sHistoryTimer, 1, periods[g_TempPeriod & 0x03], RecordHistory);
+    else                                    SwTimer_Stop(&sHistoryTimer);
+}
 
-        RTC_Convert2Date(&g_sRTCValue);
-        
-        /* Get LPC8N04 Power source */
-        /* g_LPC8N04PSTAT == 1  ====> Antenna powered */
-        /* g_LPC8N04PSTAT != 1  ====> Battery powered */
-        g_LPC8N04PSTAT = Chip_PMU_Switch_GetVNFC();
-
-        /* Initialize OLED panel */
-        if( (g_OLEDInitFlag == 0) && (g_nfcOn == true) && (g_LPC8N04PSTAT != 1) ) {
-            ssd1306_init();
-            g_OLEDInitFlag = 1;
+/**
+ * Seconds until the RTC must wake the IC from deep power down: for the next sample of the log, or for the alarm.
+ */
+static uint32_t SecondsToWake(void)
+{
+    uint32_t seconds = Logger_SecondsToSample();
+    uint32_t alarm;
+
+    if(g_AlarmEnFlag == 1) {
+        /* While awake, the timer holds the next alarm */
+        alarm = SwTimer_IsRunning(&sAlarmTimer) ? SwTimer_Remaining(&sAlarmTimer) : SecondsToAlarm();
+        if( (alarm > 0) && (alarm < seconds) ) {
+            seconds = alarm;
         }
+    }
+    return seconds;
+}
 
-        /* Update LED and OLED content */
-        if(g_DispTimeCnt != 0) {
-
-            /* Enable 6 LED or not */
-            /* need use g_TempUnitType as update parameter */
-            if(g_LPC8N04PSTAT != 1) {
-                if(g_TempUnitType == 0) {
-                    led_light_calc(0);
-                }
-                else {
-                    led_light_calc(1);
-                }
-            }
-
-            /* Temperature history */
-            Chip_EEPROM_Read(NSS_EEPROM, 0, g_TempRecord, 20);
+/**
+ * Tells whether the IC woke up from deep power down only to take a sample for the log: by the RTC, with no phone
+ * near and no alarm due.
+ */
+static bool IsSampleWake(void)
+{
+    if(Chip_PMU_PowerMode_GetDPDWakeupReason() != PMU_DPD_WAKEUPREASON_RTC) {
+        return false;
+    }
+    if(Chip_PMU_GetStatus() & PMU_STATUS_VDD_NFC) {
+        return false;
+    }
+    Chip_PMU_GetRetainedData(&g_AppStatus, 0, 1);
+    if((g_AppStatus&0xFF000000) != 0x5A000000) {
+        return false;
+    }
+    g_AlarmEnFlag = ((g_AppStatus>>23) & 0x01) ? 1 : 0;
+    g_AlarmNext   = (uint16_t)(g_AppStatus & 0x3FFF);
+    Chip_RTC_Init(NSS_RTC);
+    return !( (g_AlarmEnFlag == 1) && (SecondsToAlarm() == 0) );
+}
 
-            g_MainTickCnt++;                    // every main cycle need 1 Second
+/**
+ * Reads a rule of the ZON command at @a at: <MM>.<w>.<d>/<hhmm>.
+ */
+static void GetZoneRule(uint32_t at, ZONE_RULE_T *rule)
+{
+    rule->month    = (uint8_t)((nfcWriteMem[at]-0x30)*10 + (nfcWriteMem[at+1]-0x30));
+    rule->week     = (uint8_t)(nfcWriteMem[at+3]-0x30);
+    rule->weekday  = (uint8_t)(nfcWriteMem[at+5]-0x30);
+    rule->reserved = 0;
+    rule->minute   = (uint16_t)(((nfcWriteMem[at+7]-0x30)*10 + (nfcWriteMem[at+8]-0x30))*60
+                                + (nfcWriteMem[at+9]-0x30)*10 + (nfcWriteMem[at+10]-0x30));
+}
 
-            if(g_TempPeriod == 1) {
-                /* Record temperature value every 5seconds */
-                if( (g_MainTickCnt%5) == 1) {
-                    g_TempRecord[0] = g_TempRecord[1];
-                    g_TempRecord[1] = g_TempRecord[2];
-                    g_TempRecord[2] = g_TempRecord[3];
-                    g_TempRecord[3] = g_TempRecord[4];
-                    g_TempRecord[4] = g_TemperatureValue;
-                    Chip_EEPROM_Write(NSS_EEPROM, 0, g_TempRecord, 20);
-                }
+/**
+ * Looks for a command the phone wrote into the NFC shared memory, and executes it.
+ * @return true if a command was found.
+ */
+static bool HandleHostCommand(void)
+{
+    uint32_t i;
+
+    for(i=0; i<100; i++) {
+        if( (nfcWriteMem[i] == 'N') && (nfcWriteMem[i+1] == 'E') && (nfcWriteMem[i+2] == 'W') ) {
+            RTC_VALUE_T g_sRTCValueCal;
+            ALARM_T alarm;
+
+            g_sRTCValueCal.YEARS   = (nfcWriteMem[i+3] -0x30)*1000 + (nfcWriteMem[i+4] -0x30)*100 + (nfcWriteMem[i+5]-0x30)*10 + (nfcWriteMem[i+6]-0x30);
+            g_sRTCValueCal.MONTHS  = (nfcWriteMem[i+8] -0x30)*10   + (nfcWriteMem[i+9] -0x30);
+            g_sRTCValueCal.DAYS    = (nfcWriteMem[i+11]-0x30)*10   + (nfcWriteMem[i+12]-0x30);
+
+            g_sRTCValueCal.HOURS   = (nfcWriteMem[i+14]-0x30)*10   + (nfcWriteMem[i+15]-0x30);
+            g_sRTCValueCal.MINUTES = (nfcWriteMem[i+17]-0x30)*10   + (nfcWriteMem[i+18]-0x30);
+
+            g_sRTCValueCal.SECONDS = (nfcWriteMem[i+20]-0x30)*10 + (nfcWriteMem[i+21]-0x30);
+
+            /* The daily alarm of the phone app is slot 0 of the table, see ALM for the others */
+            alarm.flags            = (nfcWriteMem[i+22] == 'E') ? ALARM_ENABLED : 0;
+            alarm.days             = ALARM_EVERY_DAY;
+            alarm.hour             = (nfcWriteMem[i+24]-0x30)*10   + (nfcWriteMem[i+25]-0x30);
+            alarm.minute           = (nfcWriteMem[i+27]-0x30)*10   + (nfcWriteMem[i+28]-0x30);
+            Alarm_Set(0, &alarm);
+
+            if(nfcWriteMem[i+30] == '1')            g_TempPeriod = 1;
+            else if(nfcWriteMem[i+30] == '2')       g_TempPeriod = 2;
+            else                                    g_TempPeriod = 3;
+
+            if(nfcWriteMem[i+32] == 'F')            g_TempUnitType = 1;
+            else                                    g_TempUnitType = 0;
+
+            if(nfcWriteMem[i+35] == '0')            g_TempStep   = 0;
+            else if(nfcWriteMem[i+35] == '1')       g_TempStep   = 1;
+            else if(nfcWriteMem[i+35] == '2')       g_TempStep   = 2;
+            else if(nfcWriteMem[i+35] == '3')       g_TempStep   = 3;
+            else                                    g_TempStep   = 0;
+
+            if(nfcWriteMem[i+38] == '0')            g_TempBase   = 0;
+            else if(nfcWriteMem[i+38] == '1')       g_TempBase   = 1;
+            else if(nfcWriteMem[i+38] == '2')       g_TempBase   = 2;
+            else if(nfcWriteMem[i+38] == '3')       g_TempBase   = 3;
+            else if(nfcWriteMem[i+38] == '4')       g_TempBase   = 4;
+            else if(nfcWriteMem[i+38] == '5')       g_TempBase   = 5;
+            else if(nfcWriteMem[i+38] == '6')       g_TempBase   = 6;
+            else if(nfcWriteMem[i+38] == '7')       g_TempBase   = 7;
+            else if(nfcWriteMem[i+38] == '8')       g_TempBase   = 8;
+            else if(nfcWriteMem[i+38] == '9')       g_TempBase   = 9;
+            else                                    g_TempBase   = 0;
+
+            // Temperature LED display settings
+            // bit 31:28   27:24   23:20   19:16   15:12   11:8    7:3     3:0
+            //     HeaderH HeaderL Base_H  Base_L  Step_H  Step_L  TBD_H   TBD_L
+            g_TempSettings = 0x5A000000 | (g_TempBase << 16) | ( g_TempStep << 8);
+            Chip_PMU_SetRetainedData(&g_TempSettings, 1, 1);
+            SetLedThresholds();
+
+            uint32_t RTCSetTicks;
+            /* The phone gives local time, see ZON */
+            RTCSetTicks = Zone_ToUtc(RTC_Convert2Tick(&g_sRTCValueCal));
+
+            /* The running timers keep their distance to now; the alarm and the history follow the new settings */
+            uint32_t RTCNowTicks = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+            int32_t shift = (int32_t)(RTCSetTicks - RTCNowTicks);
+            Drift_Sync(RTCNowTicks, RTCSetTicks, (int)g_TemperatureValue);
+            SwTimer_Shift(shift);
+            Profile_Shift(shift);
+            Chip_RTC_Time_SetValue(NSS_RTC, RTCSetTicks);
+            StartAlarm(false);
+            StartHistory();
+            return true;
+        }
+        else if( (nfcWriteMem[i] == 'M') && (nfcWriteMem[i+1] == 'S') && (nfcWriteMem[i+2] == 'G') ) {
+            /* Text message, shown instead of the date; an empty one brings the date back */
+            if(TextScroll_Set((const uint8_t *)&nfcWriteMem[i+3], TEXTSCROLL_MAX_LENGTH) > 0) {
+                g_TextModeFlag = 1;
             }
-            if(g_TempPeriod == 2) {
-                /* Record temperature value every 1minutes */
-                if( (g_MainTickCnt%60) == 2) {
-                    g_TempRecord[0] = g_TempRecord[1];
-                    g_TempRecord[1] = g_TempRecord[2];
-                    g_TempRecord[2] = g_TempRecord[3];
-                    g_TempRecord[3] = g_TempRecord[4];
-                    g_TempRecord[4] = g_TemperatureValue;
-                    Chip_EEPROM_Write(NSS_EEPROM, 0, g_TempRecord, 20);
-                }
+            else {
+                g_TextModeFlag = 0;
             }
-            if(g_TempPeriod == 3) {
-                /* Record temperature value every 5minutes */
-                if( (g_MainTickCnt%300) == 3) {
-                    g_TempRecord[0] = g_TempRecord[1];
-                    g_TempRecord[1] = g_TempRecord[2];
-                    g_TempRecord[2] = g_TempRecord[3];
-                    g_TempRecord[3] = g_TempRecord[4];
-                    g_TempRecord[4] = g_TemperatureValue;
-                    Chip_EEPROM_Write(NSS_EEPROM, 0, g_TempRecord, 20);
-                }
+            if( (g_OLEDInitFlag == 1) && (g_LPC8N04PSTAT != 1) ) {
+                if(g_TextModeFlag == 1)     TextScroll_Start();
+                else                        TextScroll_Stop();
             }
+            return true;
+        }
+        else if( (nfcWriteMem[i] == 'A') && (nfcWriteMem[i+1] == 'L') && (nfcWriteMem[i+2] == 'M') ) {
+            /* One alarm of the table: ALM<slot><E|D><hh>:<mm> <7 times 0 or 1, Sunday first> <R|O>, O for once */
+            ALARM_T alarm;
+            uint32_t day;
+
+            alarm.flags  = (nfcWriteMem[i+4] == 'E') ? ALARM_ENABLED : 0;
+            alarm.hour   = (uint8_t)((nfcWriteMem[i+5]-0x30)*10 + (nfcWriteMem[i+6]-0x30));
+            alarm.minute = (uint8_t)((nfcWriteMem[i+8]-0x30)*10 + (nfcWriteMem[i+9]-0x30));
+            alarm.days   = 0;
+            for(day=0; day<7; day++) {
+                if(nfcWriteMem[i+11+day] == '1')    alarm.days |= (uint8_t)ALARM_DAY(day);
+            }
+            if(nfcWriteMem[i+19] == 'O')            alarm.flags |= ALARM_ONCE;
+            if( (alarm.hour < 24) && (alarm.minute < 60) ) {
+                Alarm_Set(nfcWriteMem[i+3]-0x30, &alarm);
+                StartAlarm(false);
+            }
+            return true;
+        }
+        else if( (nfcWriteMem[i] == 'Z') && (nfcWriteMem[i+1] == 'O') && (nfcWriteMem[i+2] == 'N') ) {
+            /* Time zone: ZON<+|-><hh><mm> <save mmm> <start MM.w.d/hhmm> <end MM.w.d/hhmm>, as the M rules of POSIX TZ.
+             * The RTC keeps UTC, so the phone sends this before NEW.
+             */
+            ZONE_T zone;
+
+            zone.offset = (int16_t)(((nfcWriteMem[i+4]-0x30)*10 + (nfcWriteMem[i+5]-0x30))*60
+                                    + (nfcWriteMem[i+6]-0x30)*10 + (nfcWriteMem[i+7]-0x30));
+            if(nfcWriteMem[i+3] == '-')             zone.offset = (int16_t)-zone.offset;
+            zone.save   = (int16_t)((nfcWriteMem[i+9]-0x30)*100 + (nfcWriteMem[i+10]-0x30)*10 + (nfcWriteMem[i+11]-0x30));
+            if(zone.save != 0) {
+                GetZoneRule(i+13, &zone.start);
+                GetZoneRule(i+25, &zone.end);
+            }
+            else {
+                memset(&zone.start, 0, sizeof(zone.start));
+                memset(&zone.end, 0, sizeof(zone.end));
+            }
+            if(Zone_Set(&zone)) {
+                StartAlarm(false);
+            }
+            return true;
+        }
+        else if( (nfcWriteMem[i] == 'P') && (nfcWriteMem[i+1] == 'R') && (nfcWriteMem[i+2] == 'F') ) {
+            /* Energy profile, added to the NDEF message for the rest of this wake, see profile.h */
+            sProfileRequested = true;
+            return true;
+        }
+        else if( (nfcWriteMem[i] == 'P') && (nfcWriteMem[i+1] == 'R') && (nfcWriteMem[i+2] == 'B') ) {
+            /* Cycle probes, added to the NDEF message for the rest of this wake, see probe.h; "PRBR" restarts them */
+            if(nfcWriteMem[i+3] == 'R') {
+                (void)Probe_GetResponse(&sProbeRecord[2], true);
+            }
+            sProbeRequested = true;
+            return true;
+        }
+        else {
+            // TODO: Nothing
+        }
+    }
 
-            /* Get RTC date and time value */
-            RTC_Convert2Date(&g_sRTCValue);
-            if( (g_OLEDInitFlag == 1) && (g_LPC8N04PSTAT != 1) ) {
-                // Clear OLED display buffer
-                memset(g_OLEDDispBuf[1], 0x00, 16);
+    return false;
+}
 
-                if(g_DispTimeFlag== 0) {
-                    if( (g_sRTCValue.HOURS<10) && (g_sRTCValue.MINUTES<10) ) {
-                        sprintf(g_OLEDDispBuf[1] , "0%d:0%d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    else if( (g_sRTCValue.HOURS<10) && (g_sRTCValue.MINUTES>=10) ) {
-                        sprintf(g_OLEDDispBuf[1] , "0%d:%d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    else if( (g_sRTCValue.HOURS>=10) && (g_sRTCValue.MINUTES<10) ) {
-                        sprintf(g_OLEDDispBuf[1] , "%d:0%d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    else {
-                        sprintf(g_OLEDDispBuf[1] , "%d:%d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    g_DispTimeFlag = 1;
-                }
-                else {
-                    if( (g_sRTCValue.HOURS<10) && (g_sRTCValue.MINUTES<10) ) {
-                        sprintf(g_OLEDDispBuf[1] , "0%d 0%d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    else if( (g_sRTCValue.HOURS<10) && (g_sRTCValue.MINUTES>=10) ) {
-                        sprintf(g_OLEDDispBuf[1] , "0%d %d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    else if( (g_sRTCValue.HOURS>=10) && (g_sRTCValue.MINUTES<10) ) {
-                        sprintf(g_OLEDDispBuf[1] , "%d 0%d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    else {
-                        sprintf(g_OLEDDispBuf[1] , "%d %d  ", g_sRTCValue.HOURS, g_sRTCValue.MINUTES);
-                    }
-                    g_DispTimeFlag = 0;
-                }
-                OLED_ShowTime(0,2,g_OLEDDispBuf[1]);
+/**
+ * Called for a new message, then by sHostTimer once a second until a command was found, the host timed out or the
+ * field is gone. The buzzer sounds meanwhile.
+ */
+static void PollHostCommand(void)
+{
+    if( HandleHostCommand() || (hostTicks >= hostTimeout) || (g_nfcOn == false) ) {
+        SwTimer_Stop(&sHostTimer);
 
-                memset(g_OLEDDispBuf[2], 0x00, 16);
-                if( (g_sRTCValue.MONTHS<10) && (g_sRTCValue.DAYS<10) ) {
-                    sprintf(g_OLEDDispBuf[3] , "   %d-0%d-0%d", g_sRTCValue.YEARS, g_sRTCValue.MONTHS, g_sRTCValue.DAYS);
-                }
-                else if( (g_sRTCValue.MONTHS<10) && (g_sRTCValue.DAYS>=10) ) {
-                    sprintf(g_OLEDDispBuf[3] , "   %d-0%d-%d",  g_sRTCValue.YEARS, g_sRTCValue.MONTHS, g_sRTCValue.DAYS);
-                }
-                else if( (g_sRTCValue.MONTHS>=10) && (g_sRTCValue.DAYS<10) ) {
-                    sprintf(g_OLEDDispBuf[3] , "   %d-%d-0%d",  g_sRTCValue.YEARS, g_sRTCValue.MONTHS, g_sRTCValue.DAYS);
-                }
-                else {
-                    sprintf(g_OLEDDispBuf[3] , "   %d-%d-%d",   g_sRTCValue.YEARS, g_sRTCValue.MONTHS, g_sRTCValue.DAYS);
-                }
-                OLED_ShowStr(0,6,g_OLEDDispBuf[3]);
+        /* delay a while, then mute buzzer */
+        Timer_Delay_ms(400);
+        /* beep when save data into RetainedData area */
+        if(g_LPC8N04PSTAT != 1)  buzzer_stop();
 
-                memset(g_OLEDDispBuf[0], 0x00, 16);
-                /* Display Temperature as Celsius */
-                if(g_TempUnitType == 0) {
-                    sprintf(g_OLEDDispBuf[0] , "%d.%doC" , g_TemperatureValue/10, g_TemperatureValue%10);
-                }
-                else {
-                    g_TemperatureoFValue = (g_TemperatureValue*18+3200)/10;
-                    /* Added a ' ' after 'F' to clear up oC before */
-                    sprintf(g_OLEDDispBuf[0] , "%d.%dF " , g_TemperatureoFValue/10, g_TemperatureoFValue%10);
-                }
+        StayAwake(WAKEUP_MINS*60);   // Set Wake up WAKEUP_MINS min
+    }
+    else {
+        hostTicks++;
+    }
+}
+
+/**
+ * The work of one second, once its temperature is known: display, history, NDEF record, alarm, and whether to stay
+ * awake.
+ */
+static void Second(void)
+{
+    GetLocalTime();
+
+    /* Get LPC8N04 Power source */
+    /* g_LPC8N04PSTAT == 1  ====> Antenna powered */
+    /* g_LPC8N04PSTAT != 1  ====> Battery powered */
+    g_LPC8N04PSTAT = Chip_PMU_Switch_GetVNFC();
+
+    /* Initialize OLED panel */
+    if( (g_OLEDInitFlag == 0) && (g_nfcOn == true) && (g_LPC8N04PSTAT != 1) ) {
+        DisplayOn();
+    }
+
+    /* Update LED and OLED content */
+    if(g_DispTimeCnt != 0) {
+
+        /* Enable 6 LED or not */
+        if(g_LPC8N04PSTAT != 1) {
+            ShowLeds();
+        }
+
+        /* Temperature history */
+        Chip_EEPROM_Read(NSS_EEPROM, 0, g_TempRecord, 20);
+
+        g_MainTickCnt++;                    // every main cycle need 1 Second
+
+        /* Get RTC date and time value */
+        GetLocalTime();
+        if( (g_OLEDInitFlag == 1) && (g_LPC8N04PSTAT != 1) ) {
+            CLOCKFACE_T face;
+
+            /* Render fast; the flush is sent by interrupt while the core sleeps */
+            Clock_Request(CLOCK_LEVEL_FAST);
+
+            face.hours   = g_sRTCValue.HOURS;
+            face.minutes = g_sRTCValue.MINUTES;
+            face.colon   = (g_DispTimeFlag == 0);
+            g_DispTimeFlag = !g_DispTimeFlag;
+            face.year    = g_sRTCValue.YEARS;
+            face.month   = g_sRTCValue.MONTHS;
+            face.day     = g_sRTCValue.DAYS;
+            face.showDate = (g_TextModeFlag == 0);
+            /* Display Temperature as Celsius */
+            if(g_TempUnitType == 0) {
+                face.temperature = (int)g_TemperatureValue;
+                face.fahrenheit  = false;
+            }
+            else {
+                g_TemperatureoFValue = (g_TemperatureValue*18+3200)/10;
+                face.temperature = (int)g_TemperatureoFValue;
+                face.fahrenheit  = true;
+            }
+            face.battery = (g_BatteryLow == 1) ? 2 : 0;
+            face.alarm   = (g_AlarmEnFlag == 1);
 
-                OLED_ShowStr(0,0,g_OLEDDispBuf[0]);
-                OLED_ShowBat(0);
+            /* Night and low battery dim the panel; it fades out during the last seconds before going off */
+            uint32_t now = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+            uint32_t end = g_RTCTicksBak + g_DispTimeCnt;
+            Brightness_Apply(g_sRTCValue.HOURS, (g_BatteryLow == 1), (end > now) ? (end - now) : 0);
 
-                if(g_AlarmEnFlag == 1)   OLED_ShowAlarm(1);
-                else                     OLED_ShowAlarm(0);
+            if( (g_MainTickCnt % VIEW_CYCLE_SECONDS) >= (VIEW_CYCLE_SECONDS - VIEW_GRAPH_SECONDS) ) {
+                int history[GRAPH_MAX_VALUES];
+                Graph_Show(history, GetHistory(history));
             }
+            else {
+                if(Graph_Hide()) {
+                    ClockFace_Invalidate();
+                }
+                /* Renders and sends only the cells that changed since the previous second */
+                ClockFace_Update(&face);
+            }
+            if(g_TextModeFlag == 1) {
+                TextScroll_Tick();
+            }
+            Clock_Release(CLOCK_LEVEL_FAST);
+        }
 
-            if(sTargetWritten == false) {
-                if(g_NFCDataUpdateFlag == 0) {
-                    g_NFCDataUpdateFlag = 1;
-                    bool success = true;
-                    /* Creat NDEF Message */
-                    NDEFT2T_CreateMessage(sNdefInstance, sData, sizeof(sData), false);
-                    g_recordInfo.shortRecord = true;
-                    g_recordInfo.pString = (uint8_t *)g_taglang;
-                    success &= NDEFT2T_CreateTextRecord(sNdefInstance, &g_recordInfo);
-                    if(g_TempRecord[0] > 2000) g_TempRecord[0] = 0;
-                    if(g_TempRecord[1] > 2000) g_TempRecord[1] = 0;
-                    if(g_TempRecord[2] > 2000) g_TempRecord[2] = 0;
-                    if(g_TempRecord[3] > 2000) g_TempRecord[3] = 0;
-                    if(g_TempRecord[4] > 2000) g_TempRecord[4] = 0;
-                    memset(g_TagDataBuf, 0x00, 128);
-                    sprintf(g_TagDataBuf, "TEMP0%5dTEMP1%5dTEMP2%5dTEMP3%5dTEMP4%5dTEMP5%5d\r\n", g_TemperatureValue, g_TempRecord[0], g_TempRecord[1], g_TempRecord[2], g_TempRecord[3], g_TempRecord[4]);
+        if(sTargetWritten == false) {
+            if(g_NFCDataUpdateFlag == 0) {
+                g_NFCDataUpdateFlag = 1;
+                bool success = true;
+                int length;
+                Clock_Request(CLOCK_LEVEL_FAST);
+                /* Creat NDEF Message */
+                NDEFT2T_CreateMessage(sNdefInstance, sData, sizeof(sData), false);
+                g_recordInfo.shortRecord = true;
+                g_recordInfo.pString = (uint8_t *)g_taglang;
+                success &= NDEFT2T_CreateTextRecord(sNdefInstance, &g_recordInfo);
+                if(g_TempRecord[0] > 2000) g_TempRecord[0] = 0;
+                if(g_TempRecord[1] > 2000) g_TempRecord[1] = 0;
+                if(g_TempRecord[2] > 2000) g_TempRecord[2] = 0;
+                if(g_TempRecord[3] > 2000) g_TempRecord[3] = 0;
+                if(g_TempRecord[4] > 2000) g_TempRecord[4] = 0;
+                PROBE_BEGIN(PROBE_NDEF_TEXT);
+                length = FormatTemperatures((char *)g_TagDataBuf);
+                PROBE_END(PROBE_NDEF_TEXT);
+                if (success) {
+                    success = NDEFT2T_WriteRecordPayload(sNdefInstance, (const void *)g_TagDataBuf, length);
+                    if (success) {
+                        NDEFT2T_CommitRecord(sNdefInstance);
+                    }
+                }
+                if (success && sProfileRequested) {
+                    success = NDEFT2T_CreateTextRecord(sNdefInstance, &g_recordInfo);
                     if (success) {
-                        success = NDEFT2T_WriteRecordPayload(sNdefInstance, g_TagDataBuf, (strlen(g_TagDataBuf)));
+                        success = NDEFT2T_WriteRecordPayload(sNdefInstance, sProfileText, Profile_Format(sProfileText));
                         if (success) {
                             NDEFT2T_CommitRecord(sNdefInstance);
                         }
                     }
-                    if (success) {
-                        NDEFT2T_CommitMessage(sNdefInstance);
-                    }
                 }
-                g_NFCDataUpdateFlag = 0;
-            }
-        }
+                if (success && sProbeRequested) {
+                    NDEFT2T_CREATE_RECORD_INFO_T probeInfo;
 
-        // Alarm enable and vibration motor when powered by external power source
-        if( (g_AlarmEnFlag == 1) && (g_LPC8N04PSTAT != 1) ) {
-            if( (g_sRTCValue.HOURS == g_AlarmHour) && (g_sRTCValue.MINUTES == g_AlarmMin) && (g_sRTCValue.SECONDS <= 20) ) {
-                /* Initialize OLED panel */
-                if( g_OLEDInitFlag == 0 ) {
-                    ssd1306_init();
-                    g_OLEDInitFlag = 1;
-                    g_RTCTicksBak = Chip_RTC_Time_GetValue(NSS_RTC);
-                    g_DispTimeCnt = 10;	// Wake up 10sec
-                    g_MainTickCnt = 0;
-
-                    buzzer_start();
-                    uint32_t i, j;
-                    for(i=0; i<50; i++)
-                        for(j=0; j<1000; j++);
-                    buzzer_stop();
+                    probeInfo.shortRecord = true;
+                    probeInfo.pString = sMime;
+                    success = NDEFT2T_CreateMimeRecord(sNdefInstance, &probeInfo);
+                    if (success) {
+                        /* As Msg_AddResponse would send it: the msg id, then 1 for an outgoing message */
+                        sProbeRecord[0] = APP_MSG_ID_GETPROFILE;
+                        sProbeRecord[1] = 1;
+                        success = NDEFT2T_WriteRecordPayload(sNdefInstance, sProbeRecord,
+                                                             2 + Probe_GetResponse(&sProbeRecord[2], false));
+                        if (success) {
+                            NDEFT2T_CommitRecord(sNdefInstance);
+                        }
+                    }
                 }
-                else {
-                    // Nothing
+                if (success) {
+                    Profile_Enter(PROFILE_REGION_NDEF);
+                    NDEFT2T_CommitMessage(sNdefInstance);
+                    Profile_Exit(PROFILE_REGION_NDEF);
                 }
+                Clock_Release(CLOCK_LEVEL_FAST);
             }
+            g_NFCDataUpdateFlag = 0;
         }
+    }
 
-        // Determine wakeup resource 
-        wakeupReason = Chip_PMU_PowerMode_GetDPDWakeupReason();
-        // Wakeup by RTC timer from deep power down mode
-        if(wakeupReason == PMU_DPD_WAKEUPREASON_RTC) {
-            uint32_t i, j;
-            Chip_GPIO_SetPinState(NSS_GPIO, 0, 0, 1);   // For LED
-            for(i = 0; i<200; i++)
-            for(j=0; j<1000; j++);
-            //g_AppStatus = 0;
-        }
+    // Wakeup by RTC timer from deep power down mode
+    if( (sWakeupReason == PMU_DPD_WAKEUPREASON_RTC) && (LedBar_GetLevel() == 0) ) {
+        LedBar_Show(1, LedDuty());                     // For LED
+    }
 
-        if(wakeupReason == PMU_DPD_WAKEUPREASON_NFCPOWER) {
-            uint32_t i,j;
-            nfcWriteMem = (uint32_t *)NSS_NFC->BUF;
+    /* nfc powered LPC8N04 */
+    if(g_nfcOn == true) {
+        StayAwake(3*60);   // Wake up 3 min
+    }
 
-            if(g_DispTimeCnt == 0) {
-                RTC_Convert2Date(&g_sRTCValue);
+    /* If DiapTimeCnt to 0, then jump out of while and enter low power mode */
+    if(g_DispTimeCnt == 0) {
+        g_AppStatus = 0;        // clear g_AppStatus to 0
+    }
+//  g_AppStatus = 1;            // TEST, if enable as 1, never enter low power modes.
+}
 
-                g_RTCTicksBak = Chip_RTC_Time_GetValue(NSS_RTC);
-                g_DispTimeCnt = WAKEUP_MINS*60;   // Wake up WAKEUP_MINS min
-                g_MainTickCnt = 0;
-            }
-            /* App required write */
-            if ( (sTargetWritten) ) {
-                sTargetWritten = false;
-                /* Safest is to just try to communicate. It will be stopped or restarted using the callbacks provided by the
-                 * NDEFT2T module. By using Timer_CheckHostTimeout in the while loop below, the while loop will be
-                 * stopped when the field has been removed.
-                 */
-                hostTimeout = FIRST_HOST_TIMEOUT;
-                hostTicks = 0;
-
-                Chip_TIMER32_0_Init();
-                Chip_TIMER_PrescaleSet(NSS_TIMER32_0, 1);
-                Chip_TIMER_Reset(NSS_TIMER32_0);
-                NVIC_EnableIRQ(CT32B0_IRQn);
-                Chip_TIMER_Enable(NSS_TIMER32_0);
-
-                /* Wait for a command. Send responses based on these commands. */
-                while (hostTicks < hostTimeout) {
-                    // Delay a while to get data correctly
-                    for(i = 0; i<200; i++)
-                        for(j=0; j<1000; j++);
-
-                    if(g_LPC8N04PSTAT != 1)   buzzer_start();
-
-                    for(i=0; i<100; i++) {
-                        if( (nfcWriteMem[i] == 'N') && (nfcWriteMem[i+1] == 'E') && (nfcWriteMem[i+2] == 'W') ) {
-                            RTC_VALUE_T g_sRTCValueCal;
-
-                            g_sRTCValueCal.YEARS   = (nfcWriteMem[i+3] -0x30)*1000 + (nfcWriteMem[i+4] -0x30)*100 + (nfcWriteMem[i+5]-0x30)*10 + (nfcWriteMem[i+6]-0x30);
-                            g_sRTCValueCal.MONTHS  = (nfcWriteMem[i+8] -0x30)*10   + (nfcWriteMem[i+9] -0x30);
-                            g_sRTCValueCal.DAYS    = (nfcWriteMem[i+11]-0x30)*10   + (nfcWriteMem[i+12]-0x30);
-
-                            g_sRTCValueCal.HOURS   = (nfcWriteMem[i+14]-0x30)*10   + (nfcWriteMem[i+15]-0x30);
-                            g_sRTCValueCal.MINUTES = (nfcWriteMem[i+17]-0x30)*10   + (nfcWriteMem[i+18]-0x30);
-
-                            g_sRTCValueCal.SECONDS = (nfcWriteMem[i+20]-0x30)*10 + (nfcWriteMem[i+21]-0x30);
-
-                            if(nfcWriteMem[i+22] == 'E') g_AlarmEnFlag = 1;
-                            else                         g_AlarmEnFlag = 0;
-
-                            g_AlarmHour            = (nfcWriteMem[i+24]-0x30)*10   + (nfcWriteMem[i+25]-0x30);
-                            g_AlarmMin             = (nfcWriteMem[i+27]-0x30)*10   + (nfcWriteMem[i+28]-0x30);
-
-                            if(nfcWriteMem[i+30] == '1')            g_TempPeriod = 1;
-                            else if(nfcWriteMem[i+30] == '2')       g_TempPeriod = 2;
-                            else                                    g_TempPeriod = 3;
-
-                            if(nfcWriteMem[i+32] == 'F')            g_TempUnitType = 1;
-                            else                                    g_TempUnitType = 0;
-
-                            if(nfcWriteMem[i+35] == '0')            g_TempStep   = 0;
-                            else if(nfcWriteMem[i+35] == '1')       g_TempStep   = 1;
-                            else if(nfcWriteMem[i+35] == '2')       g_TempStep   = 2;
-                            else if(nfcWriteMem[i+35] == '3')       g_TempStep   = 3;
-                            else                                    g_TempStep   = 0;
-
-                            if(nfcWriteMem[i+38] == '0')            g_TempBase   = 0;
-                            else if(nfcWriteMem[i+38] == '1')       g_TempBase   = 1;
-                            else if(nfcWriteMem[i+38] == '2')       g_TempBase   = 2;
-                            else if(nfcWriteMem[i+38] == '3')       g_TempBase   = 3;
-                            else if(nfcWriteMem[i+38] == '4')       g_TempBase   = 4;
-                            else if(nfcWriteMem[i+38] == '5')       g_TempBase   = 5;
-                            else if(nfcWriteMem[i+38] == '6')       g_TempBase   = 6;
-                            else if(nfcWriteMem[i+38] == '7')       g_TempBase   = 7;
-                            else if(nfcWriteMem[i+38] == '8')       g_TempBase   = 8;
-                            else if(nfcWriteMem[i+38] == '9')       g_TempBase   = 9;
-                            else                                    g_TempBase   = 0;
-
-                            // Temperature LED display settings
-                            // bit 31:28   27:24   23:20   19:16   15:12   11:8    7:3     3:0
-                            //     HeaderH HeaderL Base_H  Base_L  Step_H  Step_L  TBD_H   TBD_L
-                            g_TempSettings = 0x5A000000 | (g_TempBase << 16) | ( g_TempStep << 8);
-                            Chip_PMU_SetRetainedData(&g_TempSettings, 1, 1);
-
-                            uint32_t RTCSetTicks;
-                            RTCSetTicks = RTC_Convert2Tick(&g_sRTCValueCal);
-
-                            Chip_RTC_Time_SetValue(NSS_RTC, RTCSetTicks);
-                            i = 200;
-                            hostTicks = hostTimeout + 1;
-                        }
-                        else if( (nfcWriteMem[i] == 'M') && (nfcWriteMem[i+1] == 'S') && (nfcWriteMem[i+2] == 'G') ) {
-                            i = 200;
-                            hostTicks = hostTimeout + 1;
-                        }
-                        else {
-                            // TODO: Nothing
-                        }
-                    }
+/** sSecondTimer */
+static void OnSecond(void)
+{
+    Chip_WWDT_Feed(NSS_WWDT);
+    /* Value used in App_TmeasCb, which posts EVENT_TEMPERATURE. The rest of the second follows in OnTemperature. */
+    if(TMeas_Measure(TSEN_10BITS, TMEAS_FORMAT_CELSIUS, false, 0) == TMEAS_ERROR) {
+        Second();
+    }
+}
 
-                    if ( Timer_CheckMeasurementTimeout( ) ) {
-                        hostTicks++;
-                        Timer_StartMeasurementTimeout(1);
-                    }
+/** sAwakeTimer: the display window is over. */
+static void OnAwakeEnd(void)
+{
+    g_DispTimeCnt = 0;
+    g_AppStatus = 0;
+}
 
-                    if(g_nfcOn == false) {
-                        hostTicks = hostTimeout + 1;
-                    }
-                    else {
-                        // TODO:
-                    }
-                }
+/** sHistoryTimer */
+static void RecordHistory(void)
+{
+    Profile_Enter(PROFILE_REGION_EEPROM);
+    Chip_EEPROM_Read(NSS_EEPROM, 0, g_TempRecord, 20);
+    g_TempRecord[0] = g_TempRecord[1];
+    g_TempRecord[1] = g_TempRecord[2];
+    g_TempRecord[2] = g_TempRecord[3];
+    g_TempRecord[3] = g_TempRecord[4];
+    g_TempRecord[4] = g_TemperatureValue;
+    Chip_EEPROM_Write(NSS_EEPROM, 0, g_TempRecord, 20);
+    /* Programs the row now, rather than in the read of the next second */
+    Chip_EEPROM_Flush(NSS_EEPROM, true);
+    Profile_Exit(PROFILE_REGION_EEPROM);
+}
 
-                /* delay a while, then mute buzzer */
-                for(i=0; i<200; i++)
-                    for(j=0; j<1000; j++);
-                /* beep when save data into RetainedData area */
-                if(g_LPC8N04PSTAT != 1)  buzzer_stop();
+/** sLogTimer: the log continues while awake */
+static void LogSample(void)
+{
+    Profile_Enter(PROFILE_REGION_EEPROM);
+    Logger_Store((int)g_TemperatureValue);
+    Profile_Exit(PROFILE_REGION_EEPROM);
+}
 
-                /* get RTC tick value */
-                g_RTCTicksBak = Chip_RTC_Time_GetValue(NSS_RTC);
-                g_DispTimeCnt = WAKEUP_MINS*60;   // Set Wake up WAKEUP_MINS min
-            }
-        }
+/** sAlarmTimer: alarm enable and vibration motor when powered by external power source */
+static void OnAlarm(void)
+{
+    StartAlarm(true);
+    g_LPC8N04PSTAT = Chip_PMU_Switch_GetVNFC();
+    /* Initialize OLED panel */
+    if( (g_LPC8N04PSTAT != 1) && (g_OLEDInitFlag == 0) ) {
+        DisplayOn();
+        StayAwake(10);	// Wake up 10sec
+        g_MainTickCnt = 0;
+
+        buzzer_start();
+        Timer_Delay_ms(100);
+        buzzer_stop();
+    }
+}
 
-        /* nfc powered LPC8N04 */
-        if(g_nfcOn == true) {
-            g_RTCTicksBak = Chip_RTC_Time_GetValue(NSS_RTC);
-            g_DispTimeCnt = 3*60;   // Wake up 3 min
-        }
+/** EVENT_TICK: the RTC wake-up counter expired, a timer is due. */
+static void OnTick(const EVENT_T *event)
+{
+    SwTimer_Run();
+}
 
-        g_RTCTicks = Chip_RTC_Time_GetValue(NSS_RTC);
-        /* Check the Ticks is reach */
-        if(g_RTCTicks >= (g_RTCTicksBak + g_DispTimeCnt)) {
-            /* alive time reach */
-            g_DispTimeCnt = 0;
-            g_AppStatus = 0;
-        }
+/** EVENT_TEMPERATURE: g_TemperatureValue is up to date. */
+static void OnTemperature(const EVENT_T *event)
+{
+    Second();
+}
 
-        /* If DiapTimeCnt to 0, then jump out of while and enter low power mode */
-        if(g_DispTimeCnt == 0) {
-            g_AppStatus = 0;        // clear g_AppStatus to 0
-        }
-//      g_AppStatus = 1;            // TEST, if enable as 1, never enter low power modes.
+/** EVENT_NFC_FIELD: a phone came close, keep the display on. */
+static void OnNfcField(const EVENT_T *event)
+{
+    if(event->data) {
+        StayAwake(3*60);   // Wake up 3 min
+    }
+}
+
+/** EVENT_NFC_MESSAGE: the phone wrote a message, wait for its command. */
+static void OnNfcMessage(const EVENT_T *event)
+{
+    /* Safest is to just try to communicate. It will be stopped or restarted using the callbacks provided by the
+     * NDEFT2T module: PollHostCommand gives up when the field has been removed.
+     */
+    sTargetWritten = false;
+    hostTimeout = FIRST_HOST_TIMEOUT;
+    hostTicks = 0;
+    SwTimer_Start(&sHostTimer, 1, 1, PollHostCommand);
+    if(g_LPC8N04PSTAT != 1)   buzzer_start();
+    PollHostCommand();
+}
+
+/* -------------------------------------------------------------------------------- */
+int main(void)
+{
+    static const EVENT_HANDLER_T handlers[EVENT_TYPE_COUNT] = {
+        [EVENT_TICK]        = OnTick,
+        [EVENT_TEMPERATURE] = OnTemperature,
+        [EVENT_NFC_FIELD]   = OnNfcField,
+        [EVENT_NFC_MESSAGE] = OnNfcMessage,
+    };
+
+    /* Measure, store, sleep: a wake-up for the log alone skips Init and does not return */
+    if(IsSampleWake()) {
+        Logger_SampleAndSleep(SecondsToWake());
+    }
+
+    Init();
+
+    g_OLEDInitFlag = 0;
+
+    Chip_PMU_GetRetainedData(&g_AppStatus, 0, 1);
+
+    /* first power-up */
+    if((g_AppStatus&0xFF000000) != 0x5A000000) {
+        /* Initialize RTC and OLED panel */
+        uint32_t iRTCSetTicks;
+        RTC_VALUE_T i_sRTCValueCal;
+        /* Set RTC date as 2017-11-22 23-59-20 */
+        i_sRTCValueCal.YEARS   = 2017;
+        i_sRTCValueCal.MONTHS  = 11;
+        i_sRTCValueCal.DAYS    = 22;
+        i_sRTCValueCal.HOURS   = 23;
+        i_sRTCValueCal.MINUTES = 59;
+        i_sRTCValueCal.SECONDS = 20;
+        iRTCSetTicks = RTC_Convert2Tick(&i_sRTCValueCal);
+        Chip_RTC_Time_SetValue(NSS_RTC, iRTCSetTicks);
+    }
+
+    /* Is Alarm Function Enabled? */
+    if( ((g_AppStatus>>23) & 0x01) == 0x01 )  g_AlarmEnFlag  = 1;
+    else                                      g_AlarmEnFlag  = 0;
+    /* Temperature Unit oC or F */
+    if( ((g_AppStatus>>22) & 0x01) == 0x01 )  g_TempUnitType = 1;
+    else                                      g_TempUnitType = 0;
+    SetLedThresholds();
+    /* Temperature Sampling */
+    if( ((g_AppStatus>>20) & 0x03) != 0x00 )  g_TempPeriod   = (g_AppStatus>>20) & 0x03;
+    else                                      g_TempPeriod   = 2;
+    /* Need Display a text or not */
+    if( (((g_AppStatus>>19) & 0x01) == 0x01) && (TextScroll_Load() > 0) )  g_TextModeFlag = 1;
+    else                                                                    g_TextModeFlag = 0;
+
+    /* Get the next alarm; StartAlarm looks it up again in the table */
+    g_AlarmNext = (uint16_t)(g_AppStatus & 0x3FFF);
+
+    /* enter while loop */
+    g_AppStatus   = 1;                                  // Enter while() loop	
+    g_NFCDataUpdateFlag = 0;
+    /* Read Temperature Record first */
+    Chip_EEPROM_Read(NSS_EEPROM, 0, g_TempRecord, 20);
+
+    g_DispTimeCnt = 0;                                  // Will update in NFC Powered
+
+    /* Determine wakeup resource */
+    sWakeupReason = Chip_PMU_PowerMode_GetDPDWakeupReason();
+    nfcWriteMem = (uint32_t *)NSS_NFC->BUF;
+    if(sWakeupReason == PMU_DPD_WAKEUPREASON_NFCPOWER) {
+        GetLocalTime();
+        StayAwake(WAKEUP_MINS*60);   // Wake up WAKEUP_MINS min
+        g_MainTickCnt = 0;
+    }
+
+    /* The first second right away, then whenever a timer is due: each RTC_IRQHandler posts EVENT_TICK. The core
+     * sleeps whenever no event is pending.
+     */
+    Event_Init();
+    SwTimer_Start(&sSecondTimer, 0, 1, OnSecond);   // Set 1Seconds period and update lcd
+    StartHistory();
+    StartAlarm(false);
+    SwTimer_Start(&sLogTimer, Logger_SecondsToSample(), LOGGER_INTERVAL_SECONDS, LogSample);
+    OnTick(NULL);
+    while(g_AppStatus) {
+        Event_Dispatch(handlers);
     }
 
     // Save System Valuable Status
-    // bit 31:28   27:24   23:20   19:16   15:12   11:8    7:3     3:0
-    //     HeaderH HeaderL Mark_H  Mark_L  Hour_H  Hour_L  Mins_H  MinsL
+    // bit 31:24   23      22      21:20   19      18:14   13:0
+    //     Header  Alarm   Unit    Period  Text    -       Minute of the week of the next alarm
     g_AppStatus = 0x5A000000                        // Header 0x5A
                 | (g_AlarmEnFlag<<23)
                 | (g_TempUnitType<<22)
                 | ((g_TempPeriod&0x03)<<20)
                 | (g_TextModeFlag<<19)
-                | (g_AlarmHour<<8)
-                | (g_AlarmMin << 0);
+                | (g_AlarmNext & 0x3FFF);
     /* Save g_AppStatus in the PMU_BUF[0] */
     Chip_PMU_SetRetainedData(&g_AppStatus, 0, 1);
 
     /* enter low power */
     if( (g_OLEDInitFlag == 1) && (g_LPC8N04PSTAT != 1) ) {
-    	oled_lpw_enter();       // OLED enter low power mode or disable OLED power
-    	g_OLEDInitFlag = 0;     // clear oled initialize flag
+        DisplayOff();               // The supply goes with deep power down: cut it now
     }
 
     DeInit();                   // Does not return.
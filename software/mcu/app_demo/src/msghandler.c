@@ -18,6 +18,9 @@
 #include "tmeas/tmeas.h"
 #include "memory.h"
 #include "timer.h"
+#include "clock.h"
+#include "profile.h"
+#include "probe.h"
 #include "text.h"
 #include "msghandler.h"
 #include "msghandler_protocol.h"
@@ -28,6 +31,7 @@ static uint32_t GetMeasurementsHandler(uint8_t msgId, int len, const uint8_t* pP
 static uint32_t GetConfigHandler(uint8_t msgId, int len, const uint8_t* pPayload);
 static uint32_t SetConfigHandler(uint8_t msgId, int len, const uint8_t* pPayload);
 static uint32_t MeasureTemperatureHandler(uint8_t msgId, int len, const uint8_t* pPayload);
+static uint32_t GetProfileHandler(uint8_t msgId, int len, const uint8_t* pPayload);
 static bool ResponseCb(int responseLength, const uint8_t* responseData);
 
 /* ------------------------------------------------------------------------- */
@@ -45,7 +49,8 @@ uint8_t App_ResponseBuffer[MSG_RESPONSE_BUFFER_SIZE];
 MSG_CMD_HANDLER_T App_CmdHandler[MSG_APP_HANDLERS_COUNT] = {{APP_MSG_ID_GETMEASUREMENTS, GetMeasurementsHandler},
                                                             {APP_MSG_ID_GETCONFIG, GetConfigHandler},
                                                             {APP_MSG_ID_SETCONFIG, SetConfigHandler},
-                                                            {APP_MSG_ID_MEASURETEMPERATURE, MeasureTemperatureHandler}};
+                                                            {APP_MSG_ID_MEASURETEMPERATURE, MeasureTemperatureHandler},
+                                                            {APP_MSG_ID_GETPROFILE, GetProfileHandler}};
 
 /* ------------------------------------------------------------------------- */
 
@@ -77,7 +82,10 @@ static uint32_t GetMeasurementsHandler(uint8_t msgId, int len, const uint8_t * p
         /* Append with the determined number of measured values. */
         STORAGE_TYPE * data = (STORAGE_TYPE *)&sBuffer[sizeof(APP_MSG_RESPONSE_GETMEASUREMENTS_T)];
         if (Storage_Seek((int)response->offset)) {
+            /* Unpacking the samples is bound by the core */
+            Clock_Request(CLOCK_LEVEL_FAST);
             int count = Storage_Read(data, MAX_NR_OF_VALUES_IN_RESPONSE);
+            Clock_Release(CLOCK_LEVEL_FAST);
             errorCode = MSG_OK;
             response->count = (uint8_t)count;
             response->result = MSG_OK;
@@ -176,6 +184,22 @@ static uint32_t MeasureTemperatureHandler(uint8_t msgId, int len, const uint8_t*
     return errorCode;
 }
 
+static uint32_t GetProfileHandler(uint8_t msgId, int len, const uint8_t* pPayload)
+{
+    static uint8_t sBuffer[PROBE_RESPONSE_SIZE];
+
+    uint32_t errorCode;
+    if (len == sizeof(APP_MSG_CMD_GETPROFILE_T)) {
+        const APP_MSG_CMD_GETPROFILE_T * command = (const APP_MSG_CMD_GETPROFILE_T *)pPayload;
+        Msg_AddResponse(msgId, Probe_GetResponse(sBuffer, command->reset != 0), sBuffer);
+        errorCode = MSG_OK;
+    }
+    else {
+        errorCode = MSG_ERR_INVALID_COMMAND_SIZE;
+    }
+    return errorCode;
+}
+
 /* -------------------------------------------------------------------------------- */
 
 static bool ResponseCb(int responseLength, const uint8_t* responseData)
@@ -254,7 +278,9 @@ static bool ResponseCb(int responseLength, const uint8_t* responseData)
         }
 
         if (success) {
+            Profile_Enter(PROFILE_REGION_NDEF);
             NDEFT2T_CommitMessage(sNdefInstance);
+            Profile_Exit(PROFILE_REGION_NDEF);
         }
     }
 
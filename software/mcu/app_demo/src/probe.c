@@ -0,0 +1,77 @@
+/*
+ * probe.c
+ */
+#include <string.h>
+#include "board.h"
+#include "timer.h"
+#include "clock.h"
+#include "probe.h"
+#include "msghandler_protocol.h"
+
+/* Fails to compile when PROBE_RESPONSE_SIZE does not match the protocol */
+static char sTestResponseSize[(sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + (sizeof(APP_MSG_PROBE_T) * PROBE_COUNT)
+                              == PROBE_RESPONSE_SIZE) - 1] __attribute__((unused));
+
+/* Cycles per tick of the timer, per clock level */
+static const uint8_t sCyclesPerTick[CLOCK_LEVEL_COUNT] = {
+    CLOCK_IDLE_HZ / TIMER_TICK_HZ, CLOCK_NORMAL_HZ / TIMER_TICK_HZ, CLOCK_FAST_HZ / TIMER_TICK_HZ
+};
+
+static PROBE_STATS_T sStats[PROBE_COUNT];
+
+/* -------------------------------------------------------------------------------- */
+
+void Probe_Record(PROBE_ID_T id, uint32_t ticks)
+{
+    PROBE_STATS_T *stats = &sStats[id];
+    uint32_t cycles = ticks * sCyclesPerTick[Clock_GetLevel()];
+
+    if (!stats->count) {
+        stats->min = 0xFFFFFFFF;
+    }
+    stats->count++;
+    if (cycles < stats->min) {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max) {
+        stats->max = cycles;
+    }
+    stats->total = (stats->total > 0xFFFFFFFF - cycles) ? 0xFFFFFFFF : stats->total + cycles;
+}
+
+void Probe_GetStats(PROBE_STATS_T stats[PROBE_COUNT], bool reset)
+{
+    int n;
+
+    memcpy(stats, sStats, sizeof(sStats));
+    for (n = 0; n < PROBE_COUNT; n++) {
+        if (!stats[n].count) {
+            stats[n].min = 0xFFFFFFFF;
+        }
+    }
+    if (reset) {
+        memset(sStats, 0, sizeof(sStats));
+    }
+}
+
+int Probe_GetResponse(uint8_t *buffer, bool reset)
+{
+    APP_MSG_RESPONSE_GETPROFILE_T *response = (APP_MSG_RESPONSE_GETPROFILE_T *)buffer;
+    APP_MSG_PROBE_T *probe = (APP_MSG_PROBE_T *)&buffer[sizeof(APP_MSG_RESPONSE_GETPROFILE_T)];
+    PROBE_STATS_T stats[PROBE_COUNT];
+    int n;
+
+    response->result = MSG_OK;
+    response->count = PROBE ? PROBE_COUNT : 0;
+    memset(response->zero, 0, sizeof(response->zero));
+    Probe_GetStats(stats, reset);
+    for (n = 0; n < response->count; n++) {
+        probe[n].count = stats[n].count;
+        probe[n].min = stats[n].min;
+        probe[n].max = stats[n].max;
+        probe[n].total = stats[n].total;
+    }
+    return (int)(sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + (sizeof(APP_MSG_PROBE_T) * response->count));
+}
+
+// end file
@@ -0,0 +1,192 @@
+/*
+ * profile.c
+ *
+ * During the wake everything is counted in ticks of the timer; the table in EEPROM is only read and written by
+ * Profile_Save and Profile_Format.
+ */
+#include <string.h>
+#include "board.h"
+#include "tmeas/tmeas.h"
+#include "timer.h"
+#include "format.h"
+#include "logger.h"
+#include "main.h"
+#include "profile.h"
+
+#define TICKS_PER_UNIT      (PROFILE_UNIT_US * (TIMER_TICK_HZ / 1000000))
+
+/* Above this, a field of the table is about to overflow */
+#define PROFILE_FIELD_MAX   0x7FFFFFFFu
+
+/* Fails to compile when the table does not fit in its EEPROM row */
+static char sTestTableSize[(sizeof(PROFILE_TABLE_T) <= EE_PAGE_SIZE) - 1] __attribute__((unused));
+
+static const char sRegionLetter[PROFILE_REGION_COUNT] = {'A', 'S', 'D', 'E', 'N', 'T'};
+
+static uint32_t sStart[PROFILE_REGION_COUNT];
+static uint32_t sTicks[PROFILE_REGION_COUNT];
+static uint32_t sCount[PROFILE_REGION_COUNT];
+static int32_t sShift;
+static uint32_t sLedUnits;
+static uint32_t sLedTicks;
+
+#if PROFILE
+/* Halves the table when one of its fields would overflow by adding the totals of this wake */
+static void Fit(PROFILE_TABLE_T *table, uint32_t seconds, const uint32_t units[PROFILE_REGION_COUNT], uint32_t led)
+{
+    bool full = (table->seconds > PROFILE_FIELD_MAX - seconds) || (table->led > PROFILE_FIELD_MAX - led);
+    int n;
+
+    for (n = 0; n < PROFILE_REGION_COUNT; n++) {
+        full |= (table->total[n] > PROFILE_FIELD_MAX - units[n]);
+        full |= (table->count[n] > PROFILE_FIELD_MAX - sCount[n]);
+    }
+    if (full) {
+        table->seconds /= 2;
+        table->led /= 2;
+        for (n = 0; n < PROFILE_REGION_COUNT; n++) {
+            table->total[n] /= 2;
+            table->count[n] /= 2;
+        }
+    }
+}
+#endif
+
+/* -------------------------------------------------------------------------------- */
+
+void Profile_Init(void)
+{
+    int n;
+
+    for (n = 0; n < PROFILE_REGION_COUNT; n++) {
+        sTicks[n] = 0;
+        sCount[n] = 0;
+    }
+    sShift = 0;
+    sLedUnits = 0;
+    sLedTicks = 0;
+    sStart[PROFILE_REGION_AWAKE] = Timer_GetFreeRunning();
+}
+
+void Profile_Enter(PROFILE_REGION_T region)
+{
+#if PROFILE
+    sStart[region] = Timer_GetFreeRunning();
+#else
+    (void)region;
+#endif
+}
+
+void Profile_Exit(PROFILE_REGION_T region)
+{
+#if PROFILE
+    sTicks[region] += Timer_GetFreeRunning() - sStart[region];
+    sCount[region]++;
+#else
+    (void)region;
+#endif
+}
+
+void Profile_Add(PROFILE_REGION_T region, uint32_t ticks)
+{
+#if PROFILE
+    sTicks[region] += ticks;
+    sCount[region]++;
+#else
+    (void)region;
+    (void)ticks;
+#endif
+}
+
+void Profile_AddLed(uint32_t ticks)
+{
+#if PROFILE
+    sLedTicks += ticks % TICKS_PER_UNIT;
+    sLedUnits += ticks / TICKS_PER_UNIT + sLedTicks / TICKS_PER_UNIT;
+    sLedTicks %= TICKS_PER_UNIT;
+#else
+    (void)ticks;
+#endif
+}
+
+void Profile_Shift(int32_t seconds)
+{
+    sShift += seconds;
+}
+
+void Profile_Save(void)
+{
+#if PROFILE
+    PROFILE_TABLE_T table;
+    TMEAS_STATS_T stats;
+    uint32_t units[PROFILE_REGION_COUNT];
+    uint32_t led;
+    uint32_t now;
+    uint32_t seconds;
+    int n;
+
+    Profile_Exit(PROFILE_REGION_AWAKE);
+    for (n = TSEN_7BITS; n <= TSEN_12BITS; n++) {
+        TMeas_GetStats((TSEN_RESOLUTION_T)n, &stats, true);
+        sTicks[PROFILE_REGION_TSEN] += stats.latency;
+        sCount[PROFILE_REGION_TSEN] += stats.count;
+    }
+    for (n = 0; n < PROFILE_REGION_COUNT; n++) {
+        units[n] = (sTicks[n] + TICKS_PER_UNIT / 2) / TICKS_PER_UNIT;
+    }
+    led = sLedUnits + (sLedTicks + TICKS_PER_UNIT / 2) / TICKS_PER_UNIT;
+
+    now = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_PROFILE, &table, sizeof(table));
+    seconds = now - (uint32_t)sShift - table.rtc;
+    if ((table.header != PROFILE_HEADER) || ((int32_t)seconds < 0)) {
+        memset(&table, 0, sizeof(table));
+        table.header = PROFILE_HEADER;
+        seconds = 0;
+    }
+    Fit(&table, seconds, units, led);
+    table.seconds += seconds;
+    table.rtc = now;
+    for (n = 0; n < PROFILE_REGION_COUNT; n++) {
+        table.total[n] += units[n];
+        table.count[n] += sCount[n];
+    }
+    table.led += led;
+    Chip_EEPROM_Write(NSS_EEPROM, EE_OFFSET_PROFILE, &table, sizeof(table));
+    Chip_EEPROM_Flush(NSS_EEPROM, true);
+#endif
+}
+
+int Profile_Format(char *buffer)
+{
+    PROFILE_TABLE_T table;
+    char *p = buffer;
+    int n;
+
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_PROFILE, &table, sizeof(table));
+    if (table.header != PROFILE_HEADER) {
+        memset(&table, 0, sizeof(table));
+    }
+    *p++ = 'P';
+    *p++ = 'R';
+    *p++ = 'O';
+    *p++ = 'F';
+    p = Format_Uint(p, table.seconds, 0, ' ');
+    *p++ = ' ';
+    *p++ = 'L';
+    p = Format_Uint(p, Logger_GetLastWake(NULL, NULL, false), 0, ' ');
+    for (n = 0; n < PROFILE_REGION_COUNT; n++) {
+        *p++ = ' ';
+        *p++ = sRegionLetter[n];
+        p = Format_Uint(p, table.total[n], 0, ' ');
+        *p++ = '/';
+        p = Format_Uint(p, table.count[n], 0, ' ');
+    }
+    *p++ = ' ';
+    *p++ = 'B';
+    p = Format_Uint(p, table.led, 0, ' ');
+    *p = '\0';
+    return (int)(p - buffer);
+}
+
+// end file
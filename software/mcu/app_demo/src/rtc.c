@@ -36,65 +36,91 @@ uint8_t LEAP_Year_Calculate(uint32_t year)
     }
 }
 
+/* Days from 1968-03-01, the start of a 4 year cycle, to 1970-01-01, and to 2100-03-01, the first March 1st after a
+ * February 28th closing a cycle
+ */
+#define DAYS_1968_TO_1970   671
+#define DAYS_1970_TO_2100   47541
+#define NO_DAY              0xFFFFFFFF
+
+/* The date of the day that started at RTC time sMidnight, see RTC_Ticks2Date */
+static uint32_t sMidnight;
+static uint32_t sDay = NO_DAY;      // days since 1970-01-01
+static uint32_t sYear;
+static uint8_t  sMonth;
+static uint8_t  sDayOfMonth;
+static uint8_t  sWeekday;
+
+/*
+ * The civil date of day @a day since 1970-01-01, in constant time: H. Hinnant's days to civil, with years starting on
+ * March 1st so the leap day closes a year, over 4 year cycles rather than 400 year eras. All of 1970 - 2106 lies in
+ * one century, 2100 aside: that one is made a leap year, and its virtual February 29th skipped.
+ * Divisions by constants are multiplications and shifts, exact for the ranges of the operands: checked for every day
+ * by tools/rtcsim.
+ */
+static void Civil(uint32_t day)
+{
+    uint32_t d = day + DAYS_1968_TO_1970 + (day >= DAYS_1970_TO_2100);
+    uint32_t cycle = (d * 22967) >> 25;                     // d / 1461
+    uint32_t r = d - cycle * 1461;                          // day of the cycle
+    uint32_t year = (r * 1437) >> 19;                       // r / 365
+    uint32_t doy;
+    uint32_t mp;
+
+    if(year > 3) {
+        year = 3;                                           // the leap day
+    }
+    doy = r - year * 365;                                   // day of the year, from March 1st
+    mp = ((5 * doy + 2) * 857) >> 17;                       // month, from March: (5 * doy + 2) / 153
+    sDayOfMonth = (uint8_t)(doy - (((153 * mp + 2) * 1639) >> 13) + 1);     // (153 * mp + 2) / 5
+    sMonth = (uint8_t)((mp < 10) ? mp + 3 : mp - 9);
+    sYear = 1968 + 4 * cycle + year + (sMonth <= 2);
+    sWeekday = (uint8_t)(day + 4 - 7 * (((day + 4) * 74899) >> 19));       // 1970-01-01 was a Thursday
+}
+
 void RTC_Convert2Date(RTC_VALUE_T *rtc)
 {
-    uint32_t temp, temp1;
-    uint32_t day_cnt = 0;
-	uint32_t ticks;
-
-	ticks = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
-
-	temp = ticks / 86400;
-
-	if(day_cnt != temp) {
-		day_cnt = temp;
-		temp1   = 1970;
-		while(temp >= 365) {
-			if(LEAP_Year_Calculate(temp1)) {
-				if(temp >= 366) {
-					temp = temp - 366;
-				}
-				else {
-					temp1++;
-					break;
-				}
-			}
-			else {
-				temp = temp - 365;
-			}
-			temp1++;
-		}
-		rtc->YEARS = temp1; // Get Year
-
-		temp1 = 0;
-		while(temp >= 28) { // Beyond a month
-			if( (LEAP_Year_Calculate(rtc->YEARS)) && (temp1 == 1) ) {
-				if(temp >= 29) {
-					temp = temp - 29;
-				}
-				else {
-					break;
-				}
-			}
-			else {
-				if(temp > table_month[temp1]) {
-					temp = temp - table_month[temp1];
-				}
-				else {
-					break;
-				}
-			}
-			temp1++;
-		}
-		rtc->MONTHS = (uint8_t)(temp1 + 1);           // Get Month   Value
-		rtc->DAYS   = (uint8_t)(temp  + 1);           // Get Day     Value
-	}
+    RTC_Ticks2Date((uint32_t)Chip_RTC_Time_GetValue(NSS_RTC), rtc);
+}
 
-	temp = ticks % 86400;                  // Get seconds ticks
+void RTC_Ticks2Date(uint32_t ticks, RTC_VALUE_T *rtc)
+{
+    uint32_t seconds;
+    uint32_t hours;
+    uint32_t minutes;
+    uint32_t day;
+
+    PROBE_BEGIN(PROBE_RTC_DATE);
+    seconds = ticks - sMidnight;
+
+    /* Only a new day needs a new date: the next one follows from the cache, any other one takes a division. The RTC
+     * wraps in the middle of its last day, 2106-02-07.
+     */
+    if( (sDay == NO_DAY) || (ticks < sMidnight) || (seconds >= 86400) ) {
+        if( (sDay != NO_DAY) && (ticks >= sMidnight) && (seconds < 2 * 86400) ) {
+            day = sDay + 1;
+        }
+        else {
+            day = ticks / 86400;
+        }
+        sDay = day;
+        sMidnight = day * 86400;
+        seconds = ticks - sMidnight;
+        Civil(day);
+    }
 
-	rtc->SECONDS = (uint8_t)((temp%3600)%60);         // Get Seconds Value
-	rtc->MINUTES = (uint8_t)((temp%3600)/60%60);      // Get Minutes Value
-	rtc->HOURS   = (uint8_t)((temp/3600));            // Get Hours   Value
+    rtc->YEARS   = sYear;
+    rtc->MONTHS  = sMonth;
+    rtc->DAYS    = sDayOfMonth;
+    rtc->WEEKS   = sWeekday;                                // 0 is Sunday, as RTC_GetWeek
+
+    hours        = (seconds * 37283) >> 27;                 // seconds / 3600
+    seconds     -= hours * 3600;
+    minutes      = (seconds * 2185) >> 17;                  // seconds / 60
+    rtc->HOURS   = (uint8_t)hours;
+    rtc->MINUTES = (uint8_t)minutes;
+    rtc->SECONDS = (uint8_t)(seconds - minutes * 60);
+    PROBE_END(PROBE_RTC_DATE);
 }
 
 
@@ -10,11 +10,29 @@
 #include <string.h>
 #include "board.h"
 #include "stdint.h"
+#include "timer.h"
+#include "clock.h"
+#include "profile.h"
 #include "ssd1306.h"
+#include "fonts.h"
 
 // OLED driver SSD1306 i2c address
 #define SSD1306_ADDR        (0x3C)
 
+// Control byte preceding a command stream or a data stream in one I2C transaction
+#define SSD1306_CTRL_CMD    (0x00)
+#define SSD1306_CTRL_DATA   (0x40)
+// Control byte preceding a single command, after which another control byte follows
+#define SSD1306_CTRL_CMD1   (0x80)
+
+// Largest command stream sent in one transaction
+#define SSD1306_CMD_MAX     (31)
+
+/* Dirty columns closer together than this are merged into a single burst: re-addressing the panel costs a command
+ * transaction of 5 bytes plus a start/stop, which is more than resending a few unchanged bytes.
+ */
+#define SSD1306_SPAN_GAP    (6)
+
 #define OLED_PWR_LOW()		Chip_GPIO_SetPinState(NSS_GPIO, 0, 7, 0)
 #define OLED_PWR_HIGH()		Chip_GPIO_SetPinState(NSS_GPIO, 0, 7, 1)
 
@@ -26,416 +44,217 @@
 
 //#define I2C_SDA_Read()		Chip_GPIO_GetPinState(NSS_GPIO, 0, 0)
 
-// 24 * 2
-const uint8_t battery_full[] =
-{
-	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x7D,0x7D,0x7D,0x01,0x7D,0x7D,0x7D,0x7D,0x01,0x7D,0x7D,0x7D,0x7D,0x7D,0x01,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
-};
-
-#if 0
-/* If enabled, then flash not match */
-// 24 * 2
-const uint8_t battery_mid[] =
-{
-	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x01,0x01,0x01,0x01,0x7D,0x7D,0x7D,0x7D,0x01,0x7D,0x7D,0x7D,0x7D,0x7D,0x01,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
-};
-// 24 * 2
-const uint8_t battery_low[] =
-{
-	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x7D,0x7D,0x7D,0x7D,0x7D,0x01,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
-};
-// 24 * 2
-const uint8_t battery_nop[] =
-{
-	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
-};
+/* Shadow copy of the panel GDDRAM, one row per page. */
+static uint8_t  sFrame[SSD1306_PAGES][SSD1306_WIDTH];
+
+/* One bit per column and page, set when the shadow copy differs from the panel. */
+static uint32_t sDirty[SSD1306_PAGES][SSD1306_WIDTH / 32];
+
+/* Write position in the shadow copy, as set by OLED_SetPos */
+static uint8_t  sCurPage;
+static uint8_t  sCurCol;
+
+/* Ongoing flush: the span being sent, and where to continue looking for the next one */
+static volatile bool sFlushBusy;
+static uint8_t  sFlushPage;
+static uint8_t  sFlushCol;
+static uint8_t  sSpanPage;
+static uint8_t  sSpanFirst;
+static uint8_t  sSpanLast;
+
+/* A span is sent as one queued transaction of two segments: the addressing header, and the span taken directly from
+ * the shadow copy.
+ */
+static uint8_t     sSpanHeader[7];
+static I2C_XFER_T  sSpanSegs[2];
+static I2C_MXFER_T sSpanXfer;
+
+/* Pages the panel is scrolling by itself: their GDDRAM no longer matches the shadow copy, see OLED_ScrollStart */
+static bool     sScrolling;
+static uint8_t  sScrollFirst;
+static uint8_t  sScrollLast;
+
+/* Contrast and pre-charge the panel was last given; unknown until ssd1306_init has configured it */
+static bool     sBrightnessKnown;
+static uint8_t  sContrast;
+static uint8_t  sPrecharge;
+
+#if SSD1306_BUS_STATS
+static OLED_BUS_STATS_T sBusStats;
 #endif
 
-/* Alarm enable logo */
-const uint8_t logo_alarm_set[] =
-{
-	0x00,0xC0,0x36,0x0B,0x07,0x05,0x03,0xFA,0x03,0x05,0x07,0x0B,0x36,0xC0,0x00,0x00,
-	0x00,0x07,0x19,0x21,0x41,0x41,0x81,0x81,0x80,0x40,0x40,0x20,0x18,0x07,0x00,0x00
-};
+static void SpanDone(I2C_ID_T id, I2C_MXFER_T *pMXfer);
 
-/* Alarm disable logo */
-const uint8_t logo_alarm_clr[] =
+static void BusCount(int len)
 {
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
+#if SSD1306_BUS_STATS
+    sBusStats.transactions++;
+    sBusStats.bytes += (uint32_t)len + 1; /* address byte */
+#else
+    (void)len;
+#endif
+}
 
-/*************************** 16*16 Charactors Lib ***************************/
-const uint8_t F16x16[] =
+/* Sends @a len commands as a single command stream */
+static void WriteCmds(const uint8_t *cmds, uint8_t len)
 {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*" ",0*/
-
-0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x60,0x00,0x00,0x00,/*"!",1*/
-
-0x00,0x20,0x18,0x0C,0x20,0x18,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*""",2*/
-
-0x80,0x80,0xF0,0x80,0x80,0xF0,0x80,0x00,0x08,0x7F,0x08,0x08,0x7F,0x08,0x08,0x00,/*"#",3*/
-
-0x00,0xE0,0x10,0xF8,0x10,0x60,0x00,0x00,0x00,0x30,0x41,0xFF,0x42,0x3C,0x00,0x00,/*"$",4*/
-
-0xE0,0x10,0xE0,0x00,0xC0,0x30,0x00,0x00,0x01,0x42,0x39,0x06,0x3D,0x42,0x3C,0x00,/*"%",5*/
-
-0x00,0xE0,0x10,0x10,0xE0,0x00,0x00,0x00,0x3C,0x43,0x46,0x49,0x32,0x4E,0x42,0x20,/*"&",6*/
-
-0x20,0x2C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"'",7*/
-
-0x00,0x00,0x00,0xC0,0x30,0x08,0x04,0x00,0x00,0x00,0x00,0x0F,0x30,0x40,0x80,0x00,/*"(",8*/
-
-0x00,0x04,0x08,0x30,0xC0,0x00,0x00,0x00,0x00,0x80,0x40,0x30,0x0F,0x00,0x00,0x00,/*")",9*/
-
-0x80,0x80,0x00,0xE0,0x00,0x80,0x80,0x00,0x04,0x04,0x03,0x1F,0x03,0x04,0x04,0x00,/*"*",10*/
-
-0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x3F,0x02,0x02,0x02,0x00,/*"+",11*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0x00,0x00,0x00,0x00,0x00,/*",",12*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,/*"-",13*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,/*".",14*/
-
-0x00,0x00,0x00,0x00,0x00,0xC0,0x30,0x08,0x00,0xC0,0x30,0x0C,0x03,0x00,0x00,0x00,/*"/",15*/
-
-//0x00,0xC0,0x20,0x10,0x10,0x20,0xC0,0x00,0x00,0x1F,0x20,0x40,0x40,0x20,0x1F,0x00,/*"0",16*/
-0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x0F,0x10,0x20,0x20,0x10,0x0F,0x00,
-
-0x00,0x20,0x20,0xF0,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x7F,0x40,0x40,0x00,0x00,/*"1",17*/
-
-0x00,0xE0,0x10,0x10,0x10,0x10,0xE0,0x00,0x00,0x60,0x50,0x48,0x44,0x43,0x60,0x00,/*"2",18*/
-
-0x00,0x60,0x10,0x10,0x10,0x90,0x60,0x00,0x00,0x30,0x40,0x41,0x41,0x22,0x1C,0x00,/*"3",19*/
-
-0x00,0x00,0x80,0x40,0x20,0xF0,0x00,0x00,0x00,0x0E,0x09,0x48,0x48,0x7F,0x48,0x00,/*"4",20*/
-
-0x00,0xF0,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x33,0x42,0x41,0x41,0x22,0x1C,0x00,/*"5",21*/
-
-0x00,0xC0,0x20,0x10,0x10,0x30,0x00,0x00,0x00,0x1F,0x22,0x41,0x41,0x22,0x1C,0x00,/*"6",22*/
-
-0x00,0x70,0x10,0x10,0x90,0x70,0x10,0x00,0x00,0x00,0x00,0x7E,0x01,0x00,0x00,0x00,/*"7",23*/
-
-0x00,0xE0,0x10,0x10,0x10,0x10,0xE0,0x00,0x00,0x38,0x45,0x42,0x42,0x45,0x38,0x00,/*"8",24*/
-
-0x00,0xC0,0x20,0x10,0x10,0x20,0xC0,0x00,0x00,0x01,0x62,0x44,0x44,0x22,0x1F,0x00,/*"9",25*/
-
-0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x61,0x00,0x00,0x00,/*":",26*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0x00,0x00,0x00,/*";",27*/
-
-0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x00,0x00,0x02,0x05,0x08,0x10,0x20,0x40,0x00,/*"<",28*/
-
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x00,/*"=",29*/
-
-0x00,0x10,0x20,0x40,0x80,0x00,0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x05,0x02,0x00,/*">",30*/
-
-0x00,0xE0,0x90,0x10,0x10,0x10,0xE0,0x00,0x00,0x00,0x00,0x60,0x6C,0x02,0x01,0x00,/*"?",31*/
-
-0x80,0x60,0x90,0x50,0xD0,0x20,0xC0,0x00,0x0F,0x30,0x4F,0x48,0x47,0x28,0x17,0x00,/*"@",32*/
-
-0x00,0x00,0x80,0x70,0xC0,0x00,0x00,0x00,0x40,0x78,0x47,0x04,0x05,0x4E,0x70,0x40,/*"A",33*/
-
-0x10,0xF0,0x10,0x10,0x10,0xE0,0x00,0x00,0x40,0x7F,0x41,0x41,0x41,0x22,0x1C,0x00,/*"B",34*/
-
-0x80,0x60,0x10,0x10,0x10,0x10,0x70,0x00,0x0F,0x30,0x40,0x40,0x40,0x20,0x10,0x00,/*"C",35*/
-
-0x10,0xF0,0x10,0x10,0x10,0x20,0xC0,0x00,0x40,0x7F,0x40,0x40,0x40,0x20,0x1F,0x00,/*"D",36*/
-
-0x10,0xF0,0x10,0x10,0xD0,0x10,0x20,0x00,0x40,0x7F,0x41,0x41,0x47,0x40,0x30,0x00,/*"E",37*/
-
-0x10,0xF0,0x10,0x10,0xD0,0x10,0x20,0x00,0x40,0x7F,0x41,0x01,0x07,0x00,0x00,0x00,/*"F",38*/
-
-0x80,0x60,0x10,0x10,0x10,0x70,0x00,0x00,0x0F,0x30,0x40,0x40,0x44,0x3C,0x04,0x00,/*"G",39*/
+    uint8_t buf[1 + SSD1306_CMD_MAX];
 
-0x10,0xF0,0x10,0x00,0x00,0x10,0xF0,0x10,0x40,0x7F,0x42,0x02,0x02,0x42,0x7F,0x40,/*"H",40*/
-
-0x00,0x10,0x10,0xF0,0x10,0x10,0x00,0x00,0x00,0x40,0x40,0x7F,0x40,0x40,0x00,0x00,/*"I",41*/
-
-0x00,0x00,0x10,0x10,0xF0,0x10,0x10,0x00,0x80,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,/*"J",42*/
-
-0x10,0xF0,0x10,0x80,0x50,0x30,0x10,0x00,0x40,0x7F,0x41,0x03,0x4C,0x70,0x40,0x00,/*"K",43*/
-
-0x10,0xF0,0x10,0x00,0x00,0x00,0x00,0x00,0x40,0x7F,0x40,0x40,0x40,0x40,0x60,0x00,/*"L",44*/
-
-0x10,0xF0,0xF0,0x00,0xF0,0xF0,0x10,0x00,0x40,0x7F,0x01,0x7E,0x01,0x7F,0x40,0x00,/*"M",45*/
-
-0x10,0xF0,0x60,0x80,0x00,0x10,0xF0,0x10,0x40,0x7F,0x40,0x01,0x0E,0x30,0x7F,0x00,/*"N",46*/
-
-0xC0,0x20,0x10,0x10,0x10,0x20,0xC0,0x00,0x1F,0x20,0x40,0x40,0x40,0x20,0x1F,0x00,/*"O",47*/
-
-0x10,0xF0,0x10,0x10,0x10,0x10,0xE0,0x00,0x40,0x7F,0x42,0x02,0x02,0x02,0x01,0x00,/*"P",48*/
-
-0xC0,0x20,0x10,0x10,0x10,0x20,0xC0,0x00,0x1F,0x30,0x48,0x48,0x70,0xA0,0x9F,0x00,/*"Q",49*/
-
-0x10,0xF0,0x10,0x10,0x10,0x10,0xE0,0x00,0x40,0x7F,0x41,0x01,0x07,0x19,0x60,0x40,/*"R",50*/
-
-0x00,0xE0,0x10,0x10,0x10,0x10,0x70,0x00,0x00,0x70,0x41,0x42,0x42,0x44,0x38,0x00,/*"S",51*/
-
-0x30,0x10,0x10,0xF0,0x10,0x10,0x30,0x00,0x00,0x00,0x40,0x7F,0x40,0x00,0x00,0x00,/*"T",52*/
-
-0x10,0xF0,0x10,0x00,0x00,0x10,0xF0,0x10,0x00,0x3F,0x40,0x40,0x40,0x40,0x3F,0x00,/*"U",53*/
-
-0x10,0xF0,0x10,0x00,0x00,0x90,0x70,0x10,0x00,0x00,0x0F,0x70,0x1C,0x03,0x00,0x00,/*"V",54*/
-
-0xF0,0x10,0x00,0xF0,0x00,0x10,0xF0,0x00,0x07,0x78,0x0E,0x01,0x0E,0x78,0x07,0x00,/*"W",55*/
-
-0x10,0x30,0xD0,0x00,0x00,0xD0,0x30,0x10,0x40,0x60,0x58,0x07,0x07,0x58,0x60,0x40,/*"X",56*/
-
-0x10,0x70,0x90,0x00,0x90,0x70,0x10,0x00,0x00,0x00,0x41,0x7E,0x41,0x00,0x00,0x00,/*"Y",57*/
-
-0x20,0x10,0x10,0x10,0x90,0x70,0x10,0x00,0x40,0x70,0x4C,0x42,0x41,0x40,0x30,0x00,/*"Z",58*/
-
-0x00,0x00,0x00,0xFC,0x04,0x04,0x04,0x00,0x00,0x00,0x00,0xFF,0x80,0x80,0x80,0x00,/*"[",59*/
-
-0x00,0x18,0x60,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x70,0x80,0x00,/*"\",60*/
-
-0x00,0x04,0x04,0x04,0xFC,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0xFF,0x00,0x00,0x00,/*"]",61*/
-
-0x00,0x00,0x08,0x04,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"^",62*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"_",63*/
-
-0x00,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"`",64*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x49,0x45,0x45,0x45,0x7E,0x40,/*"a",65*/
-
-0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x22,0x41,0x41,0x22,0x1C,0x00,/*"b",66*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x22,0x41,0x41,0x41,0x22,0x00,/*"c",67*/
-
-0x00,0x00,0x00,0x00,0x00,0x10,0xF0,0x00,0x00,0x1C,0x22,0x41,0x41,0x21,0x7F,0x40,/*"d",68*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x45,0x45,0x45,0x45,0x26,0x00,/*"e",69*/
-
-0x00,0x00,0x00,0xE0,0x10,0x10,0x10,0x30,0x00,0x41,0x41,0x7F,0x41,0x41,0x01,0x00,/*"f",70*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x29,0x29,0x29,0x27,0xC1,0x00,/*"g",71*/
-
-0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7F,0x42,0x01,0x01,0x41,0x7E,0x40,/*"h",72*/
-
-0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x7F,0x40,0x40,0x00,0x00,/*"i",73*/
-
-0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x80,0x00,0x01,0x01,0xFF,0x00,0x00,/*"j",74*/
-
-0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7F,0x48,0x04,0x5B,0x61,0x41,0x00,/*"k",75*/
-
-0x00,0x10,0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x7F,0x40,0x40,0x00,0x00,/*"l",76*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x7F,0x41,0x01,0x7F,0x41,0x01,0x7E,/*"m",77*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x7F,0x42,0x01,0x01,0x41,0x7E,0x40,/*"n",78*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x41,0x41,0x41,0x41,0x3E,0x00,/*"o",79*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x42,0x41,0x41,0x22,0x1C,0x00,/*"p",80*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x22,0x41,0x41,0x41,0xFF,0x00,/*"q",81*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x7F,0x42,0x41,0x01,0x03,0x00,/*"r",82*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x49,0x49,0x49,0x49,0x33,0x00,/*"s",83*/
-
-0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x3F,0x41,0x41,0x00,0x00,/*"t",84*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3F,0x40,0x40,0x40,0x21,0x7F,0x40,/*"u",85*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x1D,0x60,0x10,0x0D,0x03,0x01,/*"v",86*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x61,0x18,0x07,0x18,0x61,0x1F,0x01,/*"w",87*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x63,0x5C,0x1D,0x63,0x41,0x00,/*"x",88*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x1D,0xE0,0x30,0x0D,0x03,0x01,/*"y",89*/
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x61,0x59,0x45,0x43,0x61,0x00,/*"z",90*/
-
-0x00,0x00,0x00,0x00,0x00,0xF8,0x04,0x04,0x00,0x00,0x00,0x00,0x01,0x7E,0x80,0x80,/*"{",91*/
-
-0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,/*"|",92*/
+    buf[0] = SSD1306_CTRL_CMD;
+    memcpy(&buf[1], cmds, len);
+    BusCount(len + 1);
+    Chip_I2C_MasterSend(I2C0, SSD1306_ADDR, buf, len + 1);
+}
 
-0x00,0x04,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x7E,0x01,0x00,0x00,0x00,/*"}",93*/
+static void WriteCmd(uint8_t cmd)
+{
+    WriteCmds(&cmd, 1);
+}
 
-0x00,0x0C,0x02,0x02,0x04,0x04,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"~",94*/
+/* Renders one byte into the shadow copy at the current position; nothing is sent until OLED_Flush */
+static void WriteDat(uint8_t data)
+{
+    uint8_t *cell = &sFrame[sCurPage][sCurCol];
 
-};
+    if (*cell != data) {
+        *cell = data;
+        sDirty[sCurPage][sCurCol >> 5] |= 1u << (sCurCol & 31);
+    }
+    /* Page addressing mode: the column pointer wraps around within the same page */
+    sCurCol = (uint8_t)((sCurCol + 1) & (SSD1306_WIDTH - 1));
+}
 
-/*************************** oC ***************************/
-const uint8_t logo_temp[] =
+static bool IsDirty(uint8_t page, uint8_t col)
 {
-	0x06,0x09,0x09,0xE6,0xF8,0x0C,0x04,0x02,0x02,0x02,0x02,0x02,0x04,0x1E,0x00,0x00,
-	0x00,0x00,0x00,0x07,0x1F,0x30,0x20,0x40,0x40,0x40,0x40,0x40,0x20,0x10,0x00,0x00/*"℃",0*/
-};
+    return (sDirty[page][col >> 5] & (1u << (col & 31))) != 0;
+}
 
-/*************************** 32*16 Charactors Lib ***************************/
-const uint8_t F32x16[] =
-{
-		/* 0x20 [ ] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		/* 0x21 [!] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-			0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x07,0xFC,0x00,0xC0,0x07,0xFF,0xE1,0xE0,
-			0x07,0xF0,0xC1,0xE0,0x00,0x00,0x30,0xC0,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
-			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x22 ["] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x20,0x00,0x00,0x03,0xC0,0x00,0x00,
-			0x07,0xC0,0x00,0x00,0x1F,0x30,0x00,0x00,0x1E,0x0C,0x00,0x00,0x1C,0x23,0x00,0x00,
-			0x01,0xC0,0xC0,0x00,0x07,0x80,0x30,0x00,0x1F,0x00,0x0C,0x00,0x1E,0x00,0x03,0x00,
-			0x1C,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x23 [#] */
-			0xC0,0x00,0x00,0x00,0x30,0x18,0x0C,0x00,0x0C,0x18,0x0C,0x00,0x03,0x18,0x0F,0xE0,
-			0x00,0xDF,0xFC,0x00,0x03,0xF8,0x0C,0x00,0x00,0x1C,0x0C,0x00,0x00,0x1B,0x0C,0x00,
-			0x00,0x18,0xCC,0x00,0x00,0x18,0x3C,0x00,0x00,0x18,0x0F,0xE0,0x00,0x1F,0xFF,0x00,
-			0x03,0xF8,0x0C,0xC0,0x00,0x18,0x0C,0x30,0x00,0x18,0x0C,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x24 [$] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x07,0x80,0x03,0x78,0x07,0xC0,
-			0x00,0xFC,0x06,0x40,0x01,0x3E,0x00,0x20,0x03,0x0F,0x00,0x20,0x02,0x03,0x80,0x20,
-			0x0F,0xFF,0xFF,0xFC,0x02,0x01,0xF0,0x20,0x02,0x00,0xEC,0x60,0x01,0x30,0x73,0x40,
-			0x01,0xF0,0x3F,0xC0,0x00,0xF0,0x1F,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x25 [%] */
-			0xC0,0xFE,0x00,0x00,0x31,0xFF,0x00,0x00,0x0F,0x01,0x80,0x00,0x03,0x00,0x80,0x60,
-			0x03,0xC1,0x81,0xC0,0x01,0xFF,0x07,0x00,0x00,0xFE,0x18,0x00,0x00,0x03,0xE0,0x00,
-			0x00,0x03,0xFF,0x00,0x00,0x0C,0xFF,0xC0,0x00,0x71,0x8C,0x60,0x01,0xC1,0x03,0x20,
-			0x03,0x01,0x80,0xE0,0x00,0x00,0xFF,0xF0,0x00,0x00,0x3F,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x26 [&] */
-			0xC0,0x00,0x1F,0x00,0x30,0x00,0x7F,0xC0,0x0C,0xFC,0xC0,0xC0,0x03,0xFF,0x80,0x60,
-			0x03,0xC3,0xE0,0x20,0x02,0x32,0x78,0x20,0x02,0x0E,0x1E,0x20,0x03,0xFF,0x07,0x40,
-			0x01,0xF0,0xC3,0x80,0x00,0x01,0x33,0xC0,0x00,0x01,0x1C,0x60,0x00,0x01,0xE3,0x20,
-			0x00,0x01,0x00,0xE0,0x00,0x01,0x00,0x70,0x00,0x00,0x01,0x8C,0x00,0x00,0x00,0x03,
-		/* 0x27 ['] */
-			0xC0,0x00,0x00,0x00,0x30,0x20,0x00,0x00,0x1C,0x60,0x00,0x00,0x1F,0x40,0x00,0x00,
-			0x1F,0xC0,0x00,0x00,0x0F,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,
-			0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
-			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x28 [(] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-			0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x07,0xF8,0x00,
-			0x00,0x3F,0xFF,0x00,0x00,0x78,0x37,0xC0,0x01,0xC0,0x0C,0xE0,0x03,0x00,0x03,0x30,
-			0x04,0x00,0x00,0xC8,0x08,0x00,0x00,0x34,0x10,0x00,0x00,0x0E,0x00,0x00,0x00,0x03,
-		/* 0x29 [)] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x02,0x0C,0x00,0x00,0x04,0x07,0x00,0x00,0x08,
-			0x03,0xC0,0x00,0x30,0x01,0xF0,0x00,0xE0,0x00,0x7C,0x07,0xC0,0x00,0x3F,0xFF,0x00,
-			0x00,0x07,0xF8,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
-			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x2A [*] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x0C,0x18,0x00,0x03,0x0E,0x38,0x00,
-			0x00,0xCE,0x38,0x00,0x00,0x36,0x30,0x00,0x00,0x0F,0x60,0x00,0x00,0x63,0x43,0x80,
-			0x00,0xFF,0xFF,0x80,0x00,0x61,0x73,0x00,0x00,0x03,0x6C,0x00,0x00,0x06,0x33,0x00,
-			0x00,0x0E,0x38,0xC0,0x00,0x0E,0x38,0x30,0x00,0x0C,0x18,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x2B [+] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x80,0x00,0x03,0x00,0x80,0x00,
-			0x00,0xC0,0x80,0x00,0x00,0x30,0x80,0x00,0x00,0x0C,0x80,0x00,0x00,0x03,0x80,0x00,
-			0x00,0x7F,0xFF,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,0x83,0x00,
-			0x00,0x00,0x80,0xC0,0x00,0x00,0x80,0x30,0x00,0x00,0x80,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x2C [,] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x01,0x0C,0x00,0x00,0xE3,0x03,0x00,0x00,0xE2,
-			0x00,0xC0,0x00,0xFC,0x00,0x30,0x00,0x78,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,
-			0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
-			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x2D [-] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x80,0x00,0x0C,0x00,0x80,0x00,0x03,0x00,0x80,0x00,
-			0x00,0xC0,0x80,0x00,0x00,0x30,0x80,0x00,0x00,0x0C,0x80,0x00,0x00,0x03,0x80,0x00,
-			0x00,0x00,0xC0,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,0x83,0x00,
-			0x00,0x00,0x80,0xC0,0x00,0x00,0x80,0x30,0x00,0x00,0x80,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x2E [.] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x03,0x00,0x01,0xE0,
-			0x00,0xC0,0x01,0xE0,0x00,0x30,0x00,0xC0,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,
-			0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
-			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x2F [/] */
-			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x0C,0x0C,0x00,0x00,0x38,0x03,0x00,0x00,0xE0,
-			0x00,0xC0,0x03,0x80,0x00,0x30,0x0E,0x00,0x00,0x0C,0x38,0x00,0x00,0x03,0xE0,0x00,
-			0x00,0x03,0xC0,0x00,0x00,0x0E,0x30,0x00,0x00,0x38,0x0C,0x00,0x00,0xE0,0x03,0x00,
-			0x03,0x80,0x00,0xC0,0x0E,0x00,0x00,0x30,0x18,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
-		/* 0x30 [0] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0xE0,0xFC,0x1E,0x03,0x01,0x00,0x00,0x00,0x01,0x03,0x0E,0xFC,0xE0,0x00,
-			0x00,0x00,0x3F,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,
-			0x00,0x00,0x00,0x01,0x03,0x06,0x0C,0x08,0x08,0x08,0x0C,0x06,0x03,0x01,0x00,0x00,/*"0",0*/
-		/* 0x31 [1] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x01,0x01,0x01,0x01,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x04,0x04,0x04,0x06,0x07,0x07,0x06,0x04,0x04,0x04,0x00,0x00,0x00,/*"1",1*/
-		/* 0x32 [2] */
-			0x00,0x00,0x00,0x00,0x80,0x40,0x40,0x40,0x40,0x40,0xC0,0x80,0x80,0x00,0x00,0x00,
-			0x00,0x00,0x1E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x7F,0x3E,0x00,0x00,
-			0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01,0x00,0x00,0xE0,0x00,0x00,
-			0x00,0x00,0x07,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x07,0x01,0x00,0x00,/*"2",2*/
-		/* 0x33 [3] */
-			0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x40,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x0F,0x0F,0x00,0x00,0x80,0x80,0x80,0xC0,0x61,0x3F,0x1E,0x00,0x00,0x00,
-			0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0xFE,0x78,0x00,0x00,
-			0x00,0x00,0x01,0x03,0x02,0x04,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,0x00,/*"3",3*/
-		/* 0x34 [4] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x80,0x60,0x30,0x0C,0x02,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-			0x00,0x10,0x1C,0x12,0x11,0x10,0x10,0x10,0x10,0xFF,0xFF,0xFF,0x10,0x10,0x10,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x0F,0x0F,0x0F,0x08,0x08,0x08,0x00,/*"4",4*/
-		/* 0x35 [5] */
-			0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,
-			0x00,0x00,0x00,0xF8,0x87,0x40,0x20,0x20,0x20,0x20,0x60,0xC0,0x80,0x00,0x00,0x00,
-			0x00,0x00,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x7E,0x00,0x00,
-			0x00,0x00,0x01,0x02,0x04,0x04,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,0x00,/*"5",5*/
-		/* 0x36 [6] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0x40,0x40,0x40,0x40,0x80,0x00,0x00,0x00,
-			0x00,0x00,0xE0,0xFC,0x0E,0x81,0x80,0x40,0x40,0x40,0x40,0xC0,0x83,0x03,0x00,0x00,
-			0x00,0x00,0x3F,0xFF,0xC3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x7E,0x00,
-			0x00,0x00,0x00,0x00,0x01,0x03,0x06,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,/*"6",6*/
-		/* 0x37 [7] */
-			0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,
-			0x00,0x00,0x0F,0x03,0x01,0x00,0x00,0x00,0x80,0x60,0x18,0x06,0x01,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"7",7*/
-		/* 0x38 [8] */
-			0x00,0x00,0x00,0x00,0x80,0xC0,0x40,0x40,0x40,0x40,0xC0,0x80,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x1E,0x3F,0x71,0xE0,0xC0,0x80,0x80,0x80,0x80,0x61,0x3F,0x1E,0x00,0x00,
-			0x00,0xF8,0xFC,0x06,0x03,0x01,0x00,0x01,0x01,0x03,0x07,0x0E,0xFC,0xF8,0x00,0x00,
-			0x00,0x00,0x01,0x03,0x02,0x04,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,0x00,/*"8",8*/
-		/* 0x39 [9] */
-			0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x40,0x40,0x80,0x00,0x00,0x00,0x00,0x00,
-			0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xFE,0xF8,0x00,0x00,
-			0x00,0x00,0x81,0x83,0x06,0x04,0x04,0x04,0x04,0x02,0x83,0xF1,0x7F,0x0F,0x00,0x00,
-			0x00,0x00,0x03,0x03,0x04,0x04,0x04,0x04,0x06,0x03,0x01,0x00,0x00,0x00,0x00,0x00,/*"9",9*/
-		/* 0x3A [:] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x1E,0x1E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x78,0x78,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*":",0*/
-		/* 0x3B [;] */
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-			0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*";",0*/
-};
+/* Sets or clears the dirty bits of the columns @a first up to and including @a last of one page */
+static void MarkSpan(uint8_t page, uint8_t first, uint8_t last, bool dirty)
+{
+    uint8_t col;
 
+    for (col = first; col <= last; col++) {
+        if (dirty) {
+            sDirty[page][col >> 5] |= 1u << (col & 31);
+        }
+        else {
+            sDirty[page][col >> 5] &= ~(1u << (col & 31));
+        }
+    }
+}
 
-static void WriteCmd(uint8_t cmd)
+/* Finds the next dirty span from the flush position onwards, and marks it clean. */
+static bool NextSpan(void)
 {
-    uint8_t g_I2CTxBuf[4];
-	g_I2CTxBuf[0] = 0x00;
-	g_I2CTxBuf[1] = cmd;
-
-    Chip_I2C_MasterSend(I2C0, SSD1306_ADDR, g_I2CTxBuf, 2);
+    uint8_t col;
+
+    while (sFlushPage < SSD1306_PAGES) {
+        if (sScrolling && (sFlushPage >= sScrollFirst) && (sFlushPage <= sScrollLast)) {
+            /* Writing to GDDRAM that is being scrolled lands at an unknown column: keep it dirty until the stop */
+            sFlushPage++;
+            sFlushCol = 0;
+            continue;
+        }
+        col = sFlushCol;
+        while (col < SSD1306_WIDTH) {
+            if (!sDirty[sFlushPage][col >> 5]) {
+                col = (uint8_t)((col | 31) + 1);
+                continue;
+            }
+            if (!IsDirty(sFlushPage, col)) {
+                col++;
+                continue;
+            }
+            sSpanPage = sFlushPage;
+            sSpanFirst = col;
+            sSpanLast = col;
+            for (col++; (col < SSD1306_WIDTH) && (col - sSpanLast <= SSD1306_SPAN_GAP); col++) {
+                if (IsDirty(sFlushPage, col)) {
+                    sSpanLast = col;
+                }
+            }
+            MarkSpan(sSpanPage, sSpanFirst, sSpanLast, false);
+            sFlushCol = (uint8_t)(sSpanLast + 1);
+            return true;
+        }
+        sFlushPage++;
+        sFlushCol = 0;
+    }
+    return false;
 }
 
-static void WriteDat(uint8_t data)
+/* Queues the span found by NextSpan: one transaction addressing the page and column, followed by the data burst */
+static void SubmitSpan(void)
 {
-    uint8_t g_I2CTxBuf[4];
-	g_I2CTxBuf[0] = 0x40;
-	g_I2CTxBuf[1] = data;
+    sSpanHeader[0] = SSD1306_CTRL_CMD1;
+    sSpanHeader[1] = (uint8_t)(0xB0 | sSpanPage);
+    sSpanHeader[2] = SSD1306_CTRL_CMD1;
+    sSpanHeader[3] = (uint8_t)(0x10 | (sSpanFirst >> 4));
+    sSpanHeader[4] = SSD1306_CTRL_CMD1;
+    sSpanHeader[5] = (uint8_t)(sSpanFirst & 0x0F);
+    sSpanHeader[6] = SSD1306_CTRL_DATA;
+
+    sSpanSegs[0].slaveAddr = SSD1306_ADDR;
+    sSpanSegs[0].txBuff = sSpanHeader;
+    sSpanSegs[0].txSz = sizeof(sSpanHeader);
+    sSpanSegs[0].rxSz = 0;
+    sSpanSegs[1].slaveAddr = SSD1306_ADDR;
+    sSpanSegs[1].txBuff = &sFrame[sSpanPage][sSpanFirst];
+    sSpanSegs[1].txSz = sSpanLast - sSpanFirst + 1;
+    sSpanSegs[1].rxSz = 0;
+
+    sSpanXfer.pXfer = sSpanSegs;
+    sSpanXfer.segCount = 2;
+    sSpanXfer.cb = SpanDone;
+
+    BusCount(sSpanSegs[0].txSz + sSpanSegs[1].txSz);
+    Chip_I2C_MasterSubmit(I2C0, &sSpanXfer);
+}
 
-    Chip_I2C_MasterSend(I2C0, SSD1306_ADDR, g_I2CTxBuf, 2);
+/* Called under interrupt when a span is sent: continues with the next one until the shadow copy is clean. */
+static void SpanDone(I2C_ID_T id, I2C_MXFER_T *pMXfer)
+{
+    (void)id;
+    if (pMXfer->status != I2C_STATUS_DONE) {
+        /* Leave the rest for the next flush; this span must be sent again. */
+        MarkSpan(sSpanPage, sSpanFirst, sSpanLast, true);
+        sFlushBusy = false;
+        Profile_Exit(PROFILE_REGION_DISPLAY);
+    }
+    else if (NextSpan()) {
+        SubmitSpan();
+    }
+    else {
+        sFlushBusy = false;
+        Profile_Exit(PROFILE_REGION_DISPLAY);
+    }
 }
 
+/* Cold start configuration, sent by ssd1306_init */
+static const uint8_t sInitCmds[] =
+{
+    0xAE,       // display off
+    0x20, 0x10, // Set Memory Addressing Mode: 00,Horizontal;01,Vertical;10,Page Addressing Mode (RESET);11,Invalid
+    0xB0,       // Set Page Start Address for Page Addressing Mode,0-7
+    0xC8,       // Set COM Output Scan Direction
+    0x00,       // set low column address
+    0x10,       // set high column address
+    0x40,       // set start line address
+    0x81, OLED_CONTRAST_INIT,   // set contrast control register, 0x00~0xff
+    0xA1,       // set segment re-map 0 to 127
+    0xA6,       // set normal display
+    0xA8, 0x3F, // set multiplex ratio(1 to 64)
+    0xA4,       // 0xa4,Output follows RAM content;0xa5,Output ignores RAM content
+    0xD3, 0x00, // set display offset, not offset
+    0xD5, 0xF0, // set display clock divide ratio/oscillator frequency
+    0xD9, OLED_PRECHARGE_INIT,  // set pre-charge period
+    0xDA, 0x12, // set com pins hardware configuration
+    0xDB, 0x20, // set vcomh, 0x20,0.77xVcc
+    0x8D, 0x14, // set DC-DC enable
+    0xAF,       // turn on oled panel
+};
+
 void I2C0_IRQHandler(void)
 {
 	Chip_I2C_MasterStateHandler(I2C0);
@@ -443,9 +262,7 @@ void I2C0_IRQHandler(void)
 
 void ssd1306_pin_init(void)
 {
-    // OLED PWR
-    OLED_PWR_LOW();
-
+    // OLED PWR, state is left unchanged
     Chip_IOCON_SetPinConfig(NSS_IOCON, 7, IOCON_FUNC_0 | IOCON_RMODE_PULLUP);
     Chip_GPIO_SetPinDIROutput(NSS_GPIO, 0, 7);
 
@@ -454,76 +271,179 @@ void ssd1306_pin_init(void)
     Chip_SysCon_Peripheral_DeassertReset(SYSCON_PERIPHERAL_RESET_I2C0);
 
     Chip_I2C_Init(I2C0);
-    Chip_I2C_SetClockRate(I2C0, 250000);
+    Clock_SetI2CRate(250000);
     /** Initialize the Event Handler and enable the I2C interrupt. */
-    Chip_I2C_SetMasterEventHandler(I2C0, Chip_I2C_EventHandler);
+    Chip_I2C_SetMasterEventHandler(I2C0, Chip_I2C_EventHandlerSleep);
 
     NVIC_EnableIRQ(I2C0_IRQn);
 }
 
 void ssd1306_init(void)
 {
+    OLED_PWR_LOW();
 	ssd1306_pin_init();
-//  DelayMs(100);
     OLED_PWR_HIGH();
-	uint32_t i, j;
-	for(i = 0; i<100; i++)
-		for(j=0; j<100; j++);
-	
-	WriteCmd(0xAE); //display off
-	WriteCmd(0x20);	//Set Memory Addressing Mode	
-	WriteCmd(0x10);	//00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
-	WriteCmd(0xb0);	//Set Page Start Address for Page Addressing Mode,0-7
-	WriteCmd(0xc8);	//Set COM Output Scan Direction
-	WriteCmd(0x00); //--set low column address
-	WriteCmd(0x10); //--set high column address
-	WriteCmd(0x40); //--set start line address
-	WriteCmd(0x81); //--set contrast control register
-	WriteCmd(0xff); // 0x00~0xff
-	WriteCmd(0xa1); //--set segment re-map 0 to 127
-	WriteCmd(0xa6); //--set normal display
-	WriteCmd(0xa8); //--set multiplex ratio(1 to 64)
-	WriteCmd(0x3F); //
-	WriteCmd(0xa4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
-	WriteCmd(0xd3); //-set display offset
-	WriteCmd(0x00); // -not offset
-	WriteCmd(0xd5); // --set display clock divide ratio/oscillator frequency
-	WriteCmd(0xf0); // --set divide ratio
-	WriteCmd(0xd9); // --set pre-charge period
-	WriteCmd(0x22); //
-	WriteCmd(0xda); // --set com pins hardware configuration
-	WriteCmd(0x12);
-	WriteCmd(0xdb); // --set vcomh
-	WriteCmd(0x20); // 0x20,0.77xVcc
-	WriteCmd(0x8d); // --set DC-DC enable
-	WriteCmd(0x14); //
-	WriteCmd(0xaf); // --turn on oled panel
-    
+    Timer_Delay_ms(20);                 // Supply of the panel settles
+
+    /* Complete configuration as one command stream */
+    WriteCmds(sInitCmds, sizeof(sInitCmds));
+    sScrolling = false;
+    sBrightnessKnown = true;
+    sContrast = OLED_CONTRAST_INIT;
+    sPrecharge = OLED_PRECHARGE_INIT;
+
+    /* The panel RAM content is undefined after power-up: the next flush must send the complete frame. */
     OLED_Fill(0x00);
+    OLED_Invalidate();
 }
 
 void OLED_Fill(uint8_t dat)
 {
-	uint16_t i;
+    uint16_t i;
 
     uint8_t m;
     for(m=0;m<8;m++) {
-        WriteCmd((uint8_t)(0xb0+m));		// page0-page1
-		WriteCmd(0x00);			// low column start address
-        WriteCmd(0x10);			// high column start address
+        OLED_SetPos(0, m);
         for(i=0; i<128; i++) {
-        	WriteDat(dat);
+            WriteDat(dat);
         }
-	}
+    }
+}
+
+void OLED_ClearPages(uint8_t first, uint8_t last)
+{
+    uint8_t page;
+    uint8_t col;
+
+    OLED_WaitFlush();
+    for (page = first; (page <= last) && (page < SSD1306_PAGES); page++) {
+        for (col = 0; col < SSD1306_WIDTH; col++) {
+            if (sFrame[page][col]) {
+                sFrame[page][col] = 0;
+                sDirty[page][col >> 5] |= 1u << (col & 31);
+            }
+        }
+    }
+}
+
+void OLED_DrawPixel(uint8_t x, uint8_t y)
+{
+    uint8_t *cell;
+    uint8_t bit;
+
+    if ((x >= SSD1306_WIDTH) || (y >= SSD1306_PAGES * 8)) {
+        return;
+    }
+    OLED_WaitFlush();
+    cell = &sFrame[y >> 3][x];
+    bit = (uint8_t)(1u << (y & 7));
+    if (!(*cell & bit)) {
+        *cell |= bit;
+        sDirty[y >> 3][x >> 5] |= 1u << (x & 31);
+    }
+}
+
+void OLED_WriteColumn(uint8_t x, uint8_t page, uint8_t data)
+{
+    if ((x >= SSD1306_WIDTH) || (page >= SSD1306_PAGES)) {
+        return;
+    }
+    OLED_WaitFlush();
+    sCurPage = page;
+    sCurCol = x;
+    WriteDat(data);
+}
+
+void OLED_Invalidate(void)
+{
+    memset(sDirty, 0xFF, sizeof(sDirty));
+}
+
+void OLED_Flush(void)
+{
+    OLED_WaitFlush();
+    sFlushPage = 0;
+    sFlushCol = 0;
+    if (NextSpan()) {
+        Profile_Enter(PROFILE_REGION_DISPLAY);
+        sFlushBusy = true;
+        SubmitSpan();
+    }
+}
+
+bool OLED_IsFlushing(void)
+{
+    return sFlushBusy;
+}
+
+void OLED_WaitFlush(void)
+{
+    /* Same masked check-then-sleep as Chip_I2C_EventHandlerSleep: the last span completing in between cannot be missed */
+    __disable_irq();
+    while (sFlushBusy) {
+        Chip_PMU_PowerMode_EnterSleep();
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
 }
 
+#if SSD1306_BUS_STATS
+void OLED_GetBusStats(OLED_BUS_STATS_T *stats, bool reset)
+{
+    *stats = sBusStats;
+    if (reset) {
+        memset(&sBusStats, 0, sizeof(sBusStats));
+    }
+}
+#endif
+
 void OLED_SetPos(uint8_t x, uint8_t y)
-{ 
-	WriteCmd((uint8_t)(0xb0+y));
-	WriteCmd((uint8_t)(((x&0xf0)>>4)|0x10));
-	WriteCmd((uint8_t)((x&0x0f)|0x01));
+{
+    /* The shadow copy is read by an ongoing flush: it can only be changed afterwards. */
+    OLED_WaitFlush();
+    /* Same column as the former direct addressing, which always sent the low column nibble with bit 0 set */
+    sCurPage = (uint8_t)(y & (SSD1306_PAGES - 1));
+    sCurCol  = (uint8_t)((x | 0x01) & (SSD1306_WIDTH - 1));
+}
+
+
+void OLED_ScrollStart(uint8_t firstPage, uint8_t lastPage, OLED_SCROLL_T dir, uint8_t interval)
+{
+    uint8_t cmds[] = {
+        0x2E,                       // deactivate scroll, required before changing its setup
+        (uint8_t)dir, 0x00,         // horizontal scroll setup, dummy byte
+        firstPage, interval, lastPage,
+        0x00, 0xFF,                 // dummy bytes
+        0x2F                        // activate scroll
+    };
+
+    /* Whatever was dirty in these pages must have reached the panel before it starts moving */
+    OLED_WaitFlush();
+    sScrollFirst = firstPage;
+    sScrollLast = lastPage;
+    sScrolling = true;
+    WriteCmds(cmds, sizeof(cmds));
+}
+
+void OLED_ScrollStop(void)
+{
+    uint8_t page;
+
+    if (sScrolling) {
+        WriteCmd(0x2E);
+        sScrolling = false;
+        /* The scrolled pages were rotated by an unknown number of columns: they must be sent again */
+        for (page = sScrollFirst; page <= sScrollLast; page++) {
+            MarkSpan(page, 0, SSD1306_WIDTH - 1, true);
+        }
+    }
 }
 
+bool OLED_IsScrolling(void)
+{
+    return sScrolling;
+}
 
 void OLED_Enable(void)
 {
@@ -539,87 +459,57 @@ void OLED_Disable(void)
 	WriteCmd(0XAE);
 }
 
-void OLED_ShowCN(uint8_t x, uint8_t y, uint8_t N)
+/* Decodes a compressed glyph or icon straight into the shadow copy, page by page */
+static void DrawStream(uint8_t x, uint8_t y, const uint8_t *src, uint8_t width, uint8_t pages)
 {
-	uint8_t wm=0;
-	uint32_t  adder=16*N;
-	OLED_SetPos(x, y);
-	for(wm = 0;wm < 8;wm++) {
-		WriteDat(F16x16[adder]);
-		adder += 1;
-	}
-	OLED_SetPos(x, y + 1);
-	for(wm = 0;wm < 8;wm++) {
-		WriteDat(F16x16[adder]);
-		adder += 1;
-	}
+    FONT_STREAM_T stream = {src, 0, 0, false};
+    uint8_t page;
+    uint8_t col;
+
+    for (page = 0; page < pages; page++) {
+        OLED_SetPos(x, (uint8_t)(y + page));
+        for (col = 0; col < width; col++) {
+            WriteDat(Font_StreamNext(&stream));
+        }
+    }
 }
 
-void OLED_ShowTempUnit(uint8_t x, uint8_t y)
+/* Draws character @a c of @a font; characters left out by fontc.py are drawn as the first glyph, a space */
+static void DrawGlyph(const FONT_T *font, uint8_t x, uint8_t y, char c)
 {
-	uint8_t   wm=0;
-	uint32_t  adder=0;
-	OLED_SetPos(x, y);
-	for(wm = 0;wm < 16;wm++) {
-		WriteDat(logo_temp[adder]);
-		adder += 1;
-	}
-	OLED_SetPos(x, y + 1);
-	for(wm = 0;wm < 16;wm++) {
-		WriteDat(logo_temp[adder]);
-		adder += 1;
-	}
+    const char *p = strchr(font->pChars, c);
+    uint8_t index = (uint8_t)((p && c) ? p - font->pChars : 0);
+
+    DrawStream(x, y, &font->pData[font->pOffset[index]], font->width, font->pages);
 }
 
-void OLED_ShowFONT32(uint8_t x, uint8_t y, uint8_t N)
+static void DrawBitmap(uint8_t x, uint8_t y, const BITMAP_T *bmp)
 {
-	uint8_t wm=0;
-	uint32_t adder=32*2*N;
+    DrawStream(x, y, bmp->pData, bmp->width, bmp->pages);
+}
 
-	OLED_SetPos(x, y);
-	for(wm = 0;wm < 16;wm++) {
-		WriteDat(F32x16[adder]);
-		adder += 1;
-	}
+void OLED_ShowCN(uint8_t x, uint8_t y, uint8_t N)
+{
+	DrawGlyph(&Font8x16, x, y, (char)(N + 32));
+}
 
-	OLED_SetPos(x, y + 1);
-	for(wm = 0;wm < 16;wm++) {
-		WriteDat(F32x16[adder]);
-		adder += 1;
-	}
-	OLED_SetPos(x, y + 2);
-	for(wm = 0;wm < 16;wm++) {
-		WriteDat(F32x16[adder]);
-		adder += 1;
-	}
-	OLED_SetPos(x, y + 3);
-	for(wm = 0;wm < 16;wm++) {
-		WriteDat(F32x16[adder]);
-		adder += 1;
-	}
+void OLED_ShowFONT32(uint8_t x, uint8_t y, uint8_t N)
+{
+	DrawGlyph(&Font16x32, x, y, (char)(N + 32));
 }
 
 void OLED_ShowStr(uint8_t x, uint8_t y, uint8_t *str)
 {
 	uint8_t c = 0, j = 0;
     while(str[j] != '\0') {
-    	/* Determine it is a temperature string or not */
-    	if( (str[j] != 'o') && (str[j+1] != 'C') ) {
-			c = str[j] - 32;
-			if(x > 126) {
-				x  = 0;
-				y += 2;
-			}
-			OLED_ShowCN(x, y, c);
-			x += 8;
-			j++;
-    	}
-    	else {
-    		OLED_ShowTempUnit(x, y);
-			x += 16;
-			j++;
-			j++;
-    	}
+		c = str[j] - 32;
+		if(x > 126) {
+			x  = 0;
+			y += 2;
+		}
+		OLED_ShowCN(x, y, c);
+		x += 8;
+		j++;
     }
 }
 
@@ -645,13 +535,15 @@ void OLED_DrawBMP(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t BMP[])
 
 void OLED_ShowBat(uint8_t data)
 {
-	if(data == 0) 	OLED_DrawBMP(104,  0, 128,  2, (uint8_t *)battery_full);
+	static const BITMAP_T * const battery[] = {&Bmp_BatteryFull, &Bmp_BatteryMid, &Bmp_BatteryLow, &Bmp_BatteryEmpty};
+
+	if(data < sizeof(battery) / sizeof(battery[0])) 	DrawBitmap(104, 0, battery[data]);
 }
 
 void OLED_ShowAlarm(uint8_t data)
 {
-	if(data == 0) 	OLED_DrawBMP(60,  0, 76,  2, (uint8_t *)logo_alarm_clr);
-	if(data == 1) 	OLED_DrawBMP(60,  0, 76,  2, (uint8_t *)logo_alarm_set);
+	if(data == 0) 	DrawBitmap(60, 0, &Bmp_AlarmClr);
+	if(data == 1) 	DrawBitmap(60, 0, &Bmp_AlarmSet);
 }
 
 void OLED_ShowTime(uint8_t x, uint8_t y, uint8_t *str)
@@ -670,18 +562,30 @@ void OLED_ShowTime(uint8_t x, uint8_t y, uint8_t *str)
     }
 }
 
-// OLED enter low power mode
-void oled_lpw_enter(void)
+void OLED_SetBrightness(uint8_t contrast, uint8_t precharge)
 {
-//	WriteCmd(0xAE); //display off
-//	WriteCmd(0xA5);
-	OLED_PWR_LOW();
+    uint8_t cmds[4];
+
+    if (sBrightnessKnown && (contrast == sContrast) && (precharge == sPrecharge)) {
+        return;
+    }
+    cmds[0] = 0x81;
+    cmds[1] = contrast;
+    cmds[2] = 0xD9;
+    cmds[3] = precharge;
+    OLED_WaitFlush();
+    WriteCmds(cmds, sizeof(cmds));
+    sBrightnessKnown = true;
+    sContrast = contrast;
+    sPrecharge = precharge;
 }
-// OLED exit low power mode
-void oled_lpw_exit(void)
+
+// OLED enter low power mode
+void oled_lpw_enter(void)
 {
-//	WriteCmd(0xA4);
-//	WriteCmd(0xAF); //--turn on oled panel
+    OLED_WaitFlush();
+    OLED_PWR_LOW();
+    sBrightnessKnown = false;
 }
 
 // end file
@@ -0,0 +1,155 @@
+/*
+ * swtimer.c
+ *
+ * The list is searched linearly: only a handful of timers exist.
+ */
+#include "board.h"
+#include "timer.h"
+#include "swtimer.h"
+
+/* Running timers, nearest deadline first */
+static SWTIMER_T *sHead;
+
+/* Deadline the wake-up counter was programmed for, valid when sProgrammed */
+static uint32_t sProgrammedDeadline;
+static bool sProgrammed;
+
+/* The wake-up counter may be counting: it can be left running from before deep power down, and RTC_IRQHandler
+ * restarts it on each expiry.
+ */
+static bool sArmed = true;
+
+static uint32_t Now(void)
+{
+    return (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+}
+
+/* Deadlines are compared by difference, so the order holds when the RTC wraps */
+static void Insert(SWTIMER_T *timer)
+{
+    SWTIMER_T **link = &sHead;
+
+    while (*link && ((int32_t)((*link)->deadline - timer->deadline) <= 0)) {
+        link = &(*link)->pNext;
+    }
+    timer->pNext = *link;
+    *link = timer;
+    timer->running = true;
+}
+
+static void Remove(SWTIMER_T *timer)
+{
+    SWTIMER_T **link = &sHead;
+
+    while (*link && (*link != timer)) {
+        link = &(*link)->pNext;
+    }
+    if (*link) {
+        *link = timer->pNext;
+    }
+    timer->pNext = NULL;
+    timer->running = false;
+}
+
+/* Programs the wake-up counter for the head of the list, if that changed */
+static void Program(uint32_t now)
+{
+    int32_t seconds;
+
+    if (!sHead) {
+        if (sArmed) {
+            Timer_StopMeasurementTimeout();
+            sArmed = false;
+        }
+        sProgrammed = false;
+        return;
+    }
+    if (sProgrammed && (sProgrammedDeadline == sHead->deadline)) {
+        return;
+    }
+    seconds = (int32_t)(sHead->deadline - now);
+    if (seconds < 1) {
+        /* Due already: the earliest wake-up possible. The next SwTimer_Run handles it. */
+        seconds = 1;
+    }
+    if (seconds > SWTIMER_MAX_SECONDS) {
+        /* Too far: wake up in between, to program the rest */
+        seconds = SWTIMER_MAX_SECONDS;
+    }
+    Timer_StartMeasurementTimeout(seconds);
+    sArmed = true;
+    sProgrammedDeadline = now + (uint32_t)seconds;
+    sProgrammed = (sProgrammedDeadline == sHead->deadline);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void SwTimer_Start(SWTIMER_T *timer, uint32_t seconds, uint32_t period, SWTIMER_CB_T cb)
+{
+    uint32_t now = Now();
+
+    if (timer->running) {
+        Remove(timer);
+    }
+    timer->deadline = now + seconds;
+    timer->period = period;
+    timer->cb = cb;
+    Insert(timer);
+    Program(now);
+}
+
+void SwTimer_Stop(SWTIMER_T *timer)
+{
+    if (timer->running) {
+        Remove(timer);
+        Program(Now());
+    }
+}
+
+bool SwTimer_IsRunning(const SWTIMER_T *timer)
+{
+    return timer->running;
+}
+
+uint32_t SwTimer_Remaining(const SWTIMER_T *timer)
+{
+    int32_t seconds = (int32_t)(timer->deadline - Now());
+
+    return (timer->running && (seconds > 0)) ? (uint32_t)seconds : 0;
+}
+
+void SwTimer_Shift(int32_t delta)
+{
+    SWTIMER_T *timer;
+
+    for (timer = sHead; timer; timer = timer->pNext) {
+        timer->deadline += (uint32_t)delta;
+    }
+    /* The wake-up counter counts relative to when it was started: it still fires at the right moment */
+    sProgrammedDeadline += (uint32_t)delta;
+}
+
+void SwTimer_Run(void)
+{
+    uint32_t now = Now();
+    SWTIMER_T *timer;
+
+    /* Whatever was programmed, it fired or is overruled below */
+    sProgrammed = false;
+    while (sHead && ((int32_t)(sHead->deadline - now) <= 0)) {
+        timer = sHead;
+        Remove(timer);
+        if (timer->period) {
+            do {
+                timer->deadline += timer->period;
+            } while ((int32_t)(timer->deadline - now) <= 0);
+            Insert(timer);
+        }
+        timer->cb();
+        /* A callback may take a while */
+        now = Now();
+    }
+    Program(now);
+}
+
+// end file
@@ -13,6 +13,7 @@
 
 #include <string.h>
 #include "storage/storage.h"
+#include "format.h"
 #include "text.h"
 
 /* ------------------------------------------------------------------------- */
@@ -38,7 +39,6 @@
 
 #define CURRENT_POS (ALERT_POS + ALERT_LENGTH + 1 + 1) /**< Start position in #gAppStrText for the temperature value. */
 #define CURRENT_TEMPERATURE_POS (ALERT_POS + ALERT_LENGTH + 1 + 1 + 21) /**< Start position in #gAppStrText for the temperature value. */
-#define CURRENT_TEMPERATURE_STRING_DECIMAL_POINT_POS 3
 #define CURRENT_LENGTH 27 /**< Excluding the NUL byte */
 
 #if TEXT_STATUS_LENGTH != (STATUS_LENGTH + 1 + ALERT_LENGTH + 1 + 1 + CURRENT_LENGTH + 1)
@@ -64,30 +64,8 @@ static void Temperature2String(int temperature, char * string);
  */
 static void Temperature2String(int temperature, char * string)
 {
-    int pos;
-    bool positive = true;
-
-    memset(string, ' ', TEMPERATURE_STRING_BUFFER_SIZE);
+    Format_Tenths(string, temperature, TEMPERATURE_STRING_BUFFER_SIZE - 1);
     string[TEMPERATURE_STRING_BUFFER_SIZE - 1] = 'C';
-
-    if (temperature < 0) {
-        positive = false;
-        temperature *= -1;
-    }
-    pos = CURRENT_TEMPERATURE_STRING_DECIMAL_POINT_POS + 1;
-    while (temperature || (pos >= CURRENT_TEMPERATURE_STRING_DECIMAL_POINT_POS - 1)) {
-        if (pos == CURRENT_TEMPERATURE_STRING_DECIMAL_POINT_POS) {
-            string[pos] = '.';
-        }
-        else {
-            string[pos] = (uint8_t)('0' + (temperature % 10));
-            temperature /= 10;
-        }
-        pos--;
-    }
-    if (!positive) {
-        string[pos] = '-';
-    }
 }
 
 /* ------------------------------------------------------------------------- */
@@ -103,13 +81,7 @@ void Text_SetState(int temperature, bool valid, int minimum, int maximum)
 
     int count = Storage_GetCount();
     if (count) {
-        int pos = STATUS_COUNT_POS;
-        int x = count;
-        while (x) {
-            sStatus[pos] = (uint8_t)('0' + (x % 10));
-            pos--;
-            x /= 10;
-        }
+        Format_Uint(&sStatus[STATUS_POS], (uint32_t)count, STATUS_COUNT_POS - STATUS_POS + 1, ' ');
 
         Temperature2String(minimum, &sStatus[STATUS_MINIMUM_POS]);
         Temperature2String(maximum, &sStatus[STATUS_MAXIMUM_POS]);
@@ -0,0 +1,118 @@
+/*
+ * textscroll.c
+ *
+ * The message line takes pages 6-7, where the clock face draws the date, and holds 16 characters of 8x16.
+ * Each screen costs one full write of these two pages plus the scroll setup: about 290 bytes on the bus. A message
+ * that fits on one screen is sent once and then costs nothing.
+ */
+#include <string.h>
+#include "board.h"
+#include "ssd1306.h"
+#include "textscroll.h"
+
+#define LINE_Y              6
+#define LINE_CHARS          (SSD1306_WIDTH / 8)
+
+/* One column every 5 frames. With the oscillator and timing set by ssd1306_init (0xD5 0xF0, 0xD9 0x22, 64 MUX) the
+ * panel runs at roughly 160 frames per second: the 128 columns of a screen come around once in about 4 seconds.
+ */
+#define SCROLL_INTERVAL     OLED_SCROLL_FRAMES_5
+#define SCREEN_SECONDS      4
+
+static char     sText[EE_TEXT_SIZE];
+static int      sLength;
+static int      sScreen;        // Index of the first character on the panel
+static uint8_t  sSeconds;       // Seconds the current screen is shown
+static bool     sActive;
+
+/* Draws LINE_CHARS characters from @a first into the RAM copy, padded with spaces */
+static void DrawScreen(int first)
+{
+    uint8_t i;
+    char c;
+
+    for (i = 0; i < LINE_CHARS; i++) {
+        c = (first + i < sLength) ? sText[first + i] : ' ';
+        /* The font only holds upper case */
+        if ((c >= 'a') && (c <= 'z')) {
+            c = (char)(c - 'a' + 'A');
+        }
+        OLED_ShowCN((uint8_t)(i * 8), LINE_Y, (uint8_t)(c - 32));
+    }
+}
+
+int TextScroll_Set(const uint8_t *text, int max)
+{
+    char stored[EE_TEXT_SIZE];
+    int len = 0;
+
+    if (max > TEXTSCROLL_MAX_LENGTH) {
+        max = TEXTSCROLL_MAX_LENGTH;
+    }
+    memset(sText, 0, sizeof(sText));
+    while ((len < max) && (text[len] >= 0x20) && (text[len] < 0x7F)) {
+        sText[len] = (char)text[len];
+        len++;
+    }
+    sLength = len;
+
+    /* Spare the EEPROM when the phone sends the same message again */
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_TEXT, stored, EE_TEXT_SIZE);
+    if (memcmp(stored, sText, EE_TEXT_SIZE) != 0) {
+        Chip_EEPROM_Write(NSS_EEPROM, EE_OFFSET_TEXT, sText, EE_TEXT_SIZE);
+        Chip_EEPROM_Flush(NSS_EEPROM, true);
+    }
+    return len;
+}
+
+int TextScroll_Load(void)
+{
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_TEXT, sText, EE_TEXT_SIZE);
+    sText[EE_TEXT_SIZE - 1] = '\0';
+    for (sLength = 0; (sText[sLength] >= 0x20) && (sText[sLength] < 0x7F); sLength++) {
+        ; /* An erased or never written row reads as non printable */
+    }
+    sText[sLength] = '\0';
+    return sLength;
+}
+
+void TextScroll_Start(void)
+{
+    OLED_ScrollStop();
+    sScreen = 0;
+    sSeconds = 0;
+    DrawScreen(sScreen);
+    OLED_Flush();
+    OLED_ScrollStart(LINE_Y, LINE_Y + 1, OLED_SCROLL_LEFT, SCROLL_INTERVAL);
+    sActive = true;
+}
+
+void TextScroll_Tick(void)
+{
+    if (!sActive || (sLength <= LINE_CHARS) || (++sSeconds < SCREEN_SECONDS)) {
+        return;
+    }
+    sSeconds = 0;
+    sScreen += LINE_CHARS;
+    if (sScreen >= sLength) {
+        sScreen = 0;
+    }
+    /* The screen just shown is back at its start position: replace it as a whole */
+    OLED_ScrollStop();
+    DrawScreen(sScreen);
+    OLED_Flush();
+    OLED_ScrollStart(LINE_Y, LINE_Y + 1, OLED_SCROLL_LEFT, SCROLL_INTERVAL);
+}
+
+void TextScroll_Stop(void)
+{
+    uint8_t i;
+
+    OLED_ScrollStop();
+    if (sActive) {
+        for (i = 0; i < LINE_CHARS; i++) {
+            OLED_ShowCN((uint8_t)(i * 8), LINE_Y, 0);
+        }
+        sActive = false;
+    }
+}
@@ -13,6 +13,7 @@
 
 #include "chip.h"
 #include "timer.h"
+#include "event.h"
 
 /**
  * @c false when the timer is stopped or when the RTC_IRQn interrupt wasn't fired after being started (again).
@@ -20,6 +21,40 @@
  */
 static volatile bool sMeasurementTimeoutInterruptFired = false;
 
+/** @c true between Timer_StartFreeRunning and Timer_StopFreeRunning: the 32-bit timer is clocked. */
+static bool sFreeRunning = false;
+
+/** Prescaler for the current system clock, see Timer_SetClock */
+static uint32_t sPrescale = 0;
+static bool sPrescaleKnown = false;
+
+/** Match register of the 32-bit timer that ends a delay */
+#define DELAY_MATCH 0
+
+/** Set by CT32B0_IRQHandler when the delay expired. */
+static volatile bool sDelayExpired = false;
+
+/** Match register of the 32-bit timer that calls the callback of Timer_StartCallback */
+#define CALLBACK_MATCH 1
+
+/** A deadline closer to the count than this may pass before its match register is set: it is moved */
+#define CALLBACK_MARGIN_TICKS 20
+
+static TIMER_CALLBACK_T sCallback = NULL;
+static uint32_t sCallbackDeadline;
+
+/* Sets the match register @a ticks after the previous deadline, or just after now when that passed already */
+static void ScheduleCallback(uint32_t ticks)
+{
+    uint32_t now = Chip_TIMER_ReadCount(NSS_TIMER32_0);
+
+    sCallbackDeadline += ticks;
+    if ((int32_t)(sCallbackDeadline - now) < CALLBACK_MARGIN_TICKS) {
+        sCallbackDeadline = now + CALLBACK_MARGIN_TICKS;
+    }
+    Chip_TIMER_SetMatch(NSS_TIMER32_0, CALLBACK_MATCH, sCallbackDeadline);
+}
+
 /* -------------------------------------------------------------------------------- */
 
 void RTC_IRQHandler(void)
@@ -40,6 +75,28 @@ void RTC_IRQHandler(void)
          */
         Chip_RTC_Wakeup_SetReload(NSS_RTC, 1); /* Any small value will do. */
         sMeasurementTimeoutInterruptFired = true;
+        Event_Post(EVENT_TICK, 0);
+    }
+}
+
+void CT32B0_IRQHandler(void)
+{
+    if (Chip_TIMER_MatchPending(NSS_TIMER32_0, DELAY_MATCH)) {
+        Chip_TIMER_ClearMatch(NSS_TIMER32_0, DELAY_MATCH);
+        Chip_TIMER_MatchDisableInt(NSS_TIMER32_0, DELAY_MATCH);
+        sDelayExpired = true;
+    }
+    if (Chip_TIMER_MatchPending(NSS_TIMER32_0, CALLBACK_MATCH)) {
+        uint32_t ticks = sCallback ? sCallback() : 0;
+
+        Chip_TIMER_ClearMatch(NSS_TIMER32_0, CALLBACK_MATCH);
+        if (ticks) {
+            ScheduleCallback(ticks);
+        }
+        else {
+            Chip_TIMER_MatchDisableInt(NSS_TIMER32_0, CALLBACK_MATCH);
+            sCallback = NULL;
+        }
     }
 }
 
@@ -92,4 +149,117 @@ bool Timer_CheckMeasurementTimeout(void)
     return sMeasurementTimeoutInterruptFired;
 }
 
+/* -------------------------------------------------------------------------------- */
+
+void Timer_StartFreeRunning(void)
+{
+    if (!sPrescaleKnown) {
+        /* Before the clock governor took over: the clock set by ResetISR */
+        sPrescale = (uint32_t)Chip_Clock_System_GetClockFreq() / TIMER_TICK_HZ - 1;
+        sPrescaleKnown = true;
+    }
+    Chip_TIMER32_0_Init();
+    Chip_TIMER_PrescaleSet(NSS_TIMER32_0, sPrescale);
+    Chip_TIMER_Reset(NSS_TIMER32_0);
+    Chip_TIMER_Enable(NSS_TIMER32_0);
+    sFreeRunning = true;
+}
+
+void Timer_StopFreeRunning(void)
+{
+    sFreeRunning = false;
+    Chip_TIMER_Disable(NSS_TIMER32_0);
+    Chip_TIMER32_0_DeInit();
+}
+
+uint32_t Timer_GetFreeRunning(void)
+{
+    /* The registers of an unclocked timer can not be read */
+    return sFreeRunning ? Chip_TIMER_ReadCount(NSS_TIMER32_0) : 0;
+}
+
+void Timer_SetClock(uint32_t frequency)
+{
+    sPrescale = frequency / TIMER_TICK_HZ - 1;
+    sPrescaleKnown = true;
+    if (sFreeRunning) {
+        /* Takes effect at the next tick: the one running is a little off */
+        Chip_TIMER_PrescaleSet(NSS_TIMER32_0, sPrescale);
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/* Sleeps until the 32-bit timer advanced @a ticks */
+static void Delay(uint32_t ticks)
+{
+    bool stop = !sFreeRunning;
+    uint32_t start;
+
+    if (stop) {
+        Timer_StartFreeRunning();
+    }
+    start = Chip_TIMER_ReadCount(NSS_TIMER32_0);
+    sDelayExpired = false;
+    Chip_TIMER_SetMatch(NSS_TIMER32_0, DELAY_MATCH, start + ticks);
+    Chip_TIMER_ClearMatch(NSS_TIMER32_0, DELAY_MATCH);
+    NVIC_EnableIRQ(CT32B0_IRQn);
+
+    /* The count is checked too: a short delay may have passed its match before the interrupt was enabled. With the
+     * interrupts masked, an interrupt between the check and the sleep still ends the sleep. The match control register
+     * is shared with the callback, and only changed masked.
+     */
+    __disable_irq();
+    Chip_TIMER_MatchEnableInt(NSS_TIMER32_0, DELAY_MATCH);
+    while (!sDelayExpired && (Chip_TIMER_ReadCount(NSS_TIMER32_0) - start < ticks)) {
+        Chip_PMU_PowerMode_EnterSleep();
+        __enable_irq();
+        __disable_irq();
+    }
+    Chip_TIMER_MatchDisableInt(NSS_TIMER32_0, DELAY_MATCH);
+    __enable_irq();
+
+    if (stop) {
+        Timer_StopFreeRunning();
+    }
+}
+
+void Timer_Delay_us(uint32_t us)
+{
+    Delay(us * (TIMER_TICK_HZ / 1000000));
+}
+
+void Timer_Delay_ms(uint32_t ms)
+{
+    Delay(ms * (TIMER_TICK_HZ / 1000));
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Timer_StartCallback(uint32_t ticks, TIMER_CALLBACK_T callback)
+{
+    __disable_irq();
+    sCallback = callback;
+    sCallbackDeadline = Chip_TIMER_ReadCount(NSS_TIMER32_0);
+    ScheduleCallback(ticks);
+    Chip_TIMER_ClearMatch(NSS_TIMER32_0, CALLBACK_MATCH);
+    Chip_TIMER_MatchEnableInt(NSS_TIMER32_0, CALLBACK_MATCH);
+    __enable_irq();
+    NVIC_EnableIRQ(CT32B0_IRQn);
+}
+
+void Timer_StopCallback(void)
+{
+    if (!sFreeRunning) {
+        /* The registers of an unclocked timer can not be written; it does not call anyway */
+        sCallback = NULL;
+        return;
+    }
+    __disable_irq();
+    Chip_TIMER_MatchDisableInt(NSS_TIMER32_0, CALLBACK_MATCH);
+    Chip_TIMER_ClearMatch(NSS_TIMER32_0, CALLBACK_MATCH);
+    sCallback = NULL;
+    __enable_irq();
+}
+
 // end file
@@ -0,0 +1,163 @@
+/*
+ * zone.c
+ *
+ * The span of UTC times with one offset is cached in sFrom - sUntil; it is emptied whenever the zone changes.
+ */
+#include <string.h>
+#include "board.h"
+#include "main.h"
+#include "zone.h"
+
+#define DAY_SECONDS         (24 * 60 * 60)
+#define LAST_TICK           0xFFFFFFFF
+
+/** Marks a zone written by this firmware */
+#define ZONE_HEADER         0x5A4F4E01
+
+typedef struct ZONE_RECORD_S {
+    uint32_t header;                /*!< ZONE_HEADER */
+    ZONE_T zone;
+} ZONE_RECORD_T;
+
+/* Fails to compile when the record does not fit in its EEPROM row */
+static char sTestRecordSize[(sizeof(ZONE_RECORD_T) <= EE_PAGE_SIZE) - 1] __attribute__((unused));
+
+static ZONE_RECORD_T sRecord;
+
+/* Zone_ToLocal adds sOffset to the UTC times from sFrom up to, not including, sUntil */
+static uint32_t sFrom;
+static uint32_t sUntil;
+static int32_t sOffset;
+
+/* Days from 1970-01-01 to the first day of @a month of @a year: H. Hinnant's days from civil, for years from 1 on */
+static int32_t DaysFromCivil(int32_t year, int32_t month)
+{
+    int32_t y = year - (month <= 2);
+    int32_t era = y / 400;
+    int32_t yoe = y - era * 400;
+    int32_t doy = (153 * ((month + 9) % 12) + 2) / 5;
+
+    return era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+}
+
+/* The UTC time of @a rule in @a year, when the local time before it is @a before seconds ahead of UTC */
+static int64_t Transition(const ZONE_RULE_T *rule, int32_t year, int32_t before)
+{
+    int32_t first = DaysFromCivil(year, rule->month);
+    int32_t weekday = ((first % 7) + 11) % 7;               // 1970-01-01 was a Thursday
+    int32_t day = first + (rule->weekday + 7 - weekday) % 7 + 7 * (rule->week - 1);
+
+    if ((rule->week == ZONE_LAST_WEEK)
+            && (day >= DaysFromCivil(year + (rule->month == 12), (rule->month % 12) + 1))) {
+        day -= 7;
+    }
+    return (int64_t)day * DAY_SECONDS + (int64_t)rule->minute * 60 - before;
+}
+
+/* Fills in sFrom, sUntil and sOffset for @a utc */
+static void Find(uint32_t utc)
+{
+    int32_t standard = sRecord.zone.offset * 60;
+    int32_t daylight = standard + sRecord.zone.save * 60;
+    int64_t from = INT64_MIN;
+    int64_t until = (int64_t)LAST_TICK + 1;
+    int64_t time;
+    int32_t year;
+    int32_t y;
+    int n;
+
+    sOffset = standard;
+    if (sRecord.zone.save) {
+        year = 1970 + (int32_t)(utc / (365 * DAY_SECONDS));
+        while ((int64_t)DaysFromCivil(year, 1) * DAY_SECONDS > utc) {
+            year--;
+        }
+        /* A transition of the year before may still be the last one, one of the year after the next one */
+        for (y = year - 1; y <= year + 1; y++) {
+            for (n = 0; n < 2; n++) {
+                if (n == 0) {
+                    time = Transition(&sRecord.zone.start, y, standard);
+                }
+                else {
+                    time = Transition(&sRecord.zone.end, y, daylight);
+                }
+                if ((time <= utc) && (time >= from)) {
+                    from = time;
+                    sOffset = n ? standard : daylight;
+                }
+                else if ((time > utc) && (time < until)) {
+                    until = time;
+                }
+            }
+        }
+    }
+    sFrom = (from < 0) ? 0 : (uint32_t)from;
+    sUntil = (until > LAST_TICK) ? LAST_TICK : (uint32_t)until;
+}
+
+static int32_t OffsetAt(uint32_t utc)
+{
+    if ((utc < sFrom) || (utc >= sUntil)) {
+        Find(utc);
+    }
+    return sOffset;
+}
+
+static bool IsValid(const ZONE_RULE_T *rule)
+{
+    return (rule->month >= 1) && (rule->month <= 12) && (rule->week >= 1) && (rule->week <= ZONE_LAST_WEEK)
+            && (rule->weekday <= 6) && (rule->minute <= 48 * 60);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Zone_Load(void)
+{
+    Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_ZONE, &sRecord, sizeof(sRecord));
+    if (sRecord.header != ZONE_HEADER) {
+        memset(&sRecord, 0, sizeof(sRecord));
+    }
+    sFrom = LAST_TICK;
+    sUntil = 0;
+}
+
+bool Zone_Set(const ZONE_T *zone)
+{
+    if ((zone->offset < ZONE_MIN_OFFSET) || (zone->offset > ZONE_MAX_OFFSET) || (zone->save < 0)
+            || (zone->save > ZONE_MAX_SAVE) || (zone->save && (!IsValid(&zone->start) || !IsValid(&zone->end)))) {
+        return false;
+    }
+    if ((sRecord.header != ZONE_HEADER) || memcmp(&sRecord.zone, zone, sizeof(ZONE_T))) {
+        sRecord.header = ZONE_HEADER;
+        sRecord.zone = *zone;
+        Chip_EEPROM_Write(NSS_EEPROM, EE_OFFSET_ZONE, &sRecord, sizeof(sRecord));
+    }
+    sFrom = LAST_TICK;
+    sUntil = 0;
+    return true;
+}
+
+void Zone_Get(ZONE_T *zone)
+{
+    *zone = sRecord.zone;
+}
+
+uint32_t Zone_ToLocal(uint32_t utc)
+{
+    return utc + (uint32_t)OffsetAt(utc);
+}
+
+uint32_t Zone_ToUtc(uint32_t local)
+{
+    int32_t standard = sRecord.zone.offset * 60;
+    int32_t daylight = standard + sRecord.zone.save * 60;
+    uint32_t utc = local - (uint32_t)daylight;
+
+    /* Daylight time first: of a local time that occurs twice, that is the first one */
+    if (OffsetAt(utc) == daylight) {
+        return utc;
+    }
+    return local - (uint32_t)standard;
+}
+
+// end file
@@ -65,6 +65,17 @@
  *          - #Chip_I2C_MasterCmdRead
  *          .
  *      .
+ *  <b> For queued (non-blocking) I2C Master transfers: </b>
+ *      -# Enable the I2C interrupt in NVIC using #NVIC_EnableIRQ and call #Chip_I2C_MasterStateHandler from the
+ *          I2C interrupt handler.
+ *      -# Fill in one or more #I2C_XFER_T structures, one per segment, and a #I2C_MXFER_T descriptor referring to them.
+ *      -# Use #Chip_I2C_MasterSubmit to queue the descriptor. The call returns immediately; the callback in the
+ *          descriptor is invoked under interrupt once all its segments are done or one of them failed.
+ *      -# The core can sleep in the mean time. #Chip_I2C_IsMasterIdle tells whether the queue has drained.
+ *      .
+ *  The blocking Master transfer APIs queue their transfer as well: they wait behind any transfer submitted earlier.
+ *  #Chip_I2C_EventHandlerSleep can be set as event handler to sleep instead of spin while they wait.
+ *
  *  <b> For I2C Slave transfers: </b>
  *      -# Fill in #I2C_XFER_T structure for the slave transfer.
  *      -# Use the #Chip_I2C_SlaveSetup to setup the I2C slave.
@@ -199,6 +210,30 @@ typedef enum {
  * */
 typedef void (*I2C_EVENTHANDLER_T)(I2C_ID_T, I2C_EVENT_T);
 
+struct I2C_MXFER_S;
+
+/** Completion callback of a queued master transfer. Called under interrupt.
+ *  Use this prototype for #I2C_MXFER_T.cb.
+ */
+typedef void (*I2C_MXFER_CB_T)(I2C_ID_T, struct I2C_MXFER_S *);
+
+/** Descriptor of a queued master transfer. See #Chip_I2C_MasterSubmit.
+ *  The descriptor, the segments and their buffers are owned by the caller and must stay valid and unchanged until the
+ *  callback has been called.
+ */
+typedef struct I2C_MXFER_S {
+    I2C_XFER_T *pXfer; /*!< Array of @c segCount segments. Each segment is handled as by #Chip_I2C_MasterTransfer.
+     A segment that only transmits and that is followed by a segment for the same slave does not end the transfer: the
+     bytes of the next segment are appended without a stop or repeated start condition in between. This allows sending
+     a header and a payload from two separate buffers in one I2C transaction. */
+    uint8_t segCount; /*!< Number of segments in @c pXfer, at least 1 */
+    I2C_STATUS_T status; /*!< Status of the complete transfer: #I2C_STATUS_BUSY while queued or ongoing, else the
+     status of the last handled segment. Read only for user. */
+    I2C_MXFER_CB_T cb; /*!< Called once the transfer is done or failed. May be @c NULL */
+    void *context; /*!< Not used by the driver */
+    struct I2C_MXFER_S *pNext; /*!< Used by the driver to link queued descriptors */
+} I2C_MXFER_T;
+
 /**
  * Initializes the NSS_I2C peripheral with specified parameter.
  * @param id : I2C peripheral ID (#I2C0)
@@ -247,6 +282,25 @@ uint32_t Chip_I2C_GetClockRate(I2C_ID_T id);
  */
 I2C_STATUS_T Chip_I2C_MasterTransfer(I2C_ID_T id, I2C_XFER_T *xfer);
 
+/**
+ * Queue a master transfer, without waiting for it to complete.
+ * @param id : I2C peripheral ID (#I2C0)
+ * @param pMXfer : Descriptor of the transfer. All its segments will be marked #I2C_STATUS_BUSY.
+ * @note The transfer is started immediately when the bus is idle, else after all transfers submitted before. The
+ *  remainder is handled from #Chip_I2C_MasterStateHandler under interrupt.
+ * @note On any error, the remaining segments of the descriptor are not transferred and have their status set to the
+ *  error as well. There is no automatic retry after losing arbitration.
+ * @note This function can be called from the callback of another descriptor.
+ */
+void Chip_I2C_MasterSubmit(I2C_ID_T id, I2C_MXFER_T *pMXfer);
+
+/**
+ * Checks if all queued master transfers are completed.
+ * @param id : I2C peripheral ID (#I2C0)
+ * @return @c true when no master transfer is queued or ongoing.
+ */
+bool Chip_I2C_IsMasterIdle(I2C_ID_T id);
+
 /**
  * Transmit data to I2C slave using I2C Master mode
  * @param id : I2C peripheral ID (#I2C0)
@@ -314,6 +368,15 @@ void Chip_I2C_EventHandlerPolling(I2C_ID_T id, I2C_EVENT_T event);
  */
 void Chip_I2C_EventHandler(I2C_ID_T id, I2C_EVENT_T event);
 
+/**
+ * Event handler for interrupt based operation which puts the core in Sleep mode while waiting
+ * @param id : I2C peripheral ID (#I2C0)
+ * @param event : Event ID of the event that called the function
+ * @note Behaves as #Chip_I2C_EventHandler, but uses #Chip_PMU_PowerMode_EnterSleep instead of spinning.
+ * @warning Must not be used from an interrupt with a priority higher than or equal to the I2C interrupt.
+ */
+void Chip_I2C_EventHandlerSleep(I2C_ID_T id, I2C_EVENT_T event);
+
 /**
  * I2C Master transfer state change handler
  * @param id : I2C peripheral ID (#I2C0)
@@ -189,8 +189,11 @@ struct i2c_interface {
     CLOCK_PERIPHERAL_T clk; /* Clock used by I2C */
     I2C_EVENTHANDLER_T mEvent; /* Current active Master event handler */
     I2C_EVENTHANDLER_T sEvent; /* Slave transfer events */
-    I2C_XFER_T *mXfer; /* Current active xfer pointer */
+    I2C_XFER_T *mXfer; /* Xfer pointer a blocking master transfer waits for */
     I2C_XFER_T *sXfer; /* Pointer to store xfer when bus is busy */
+    I2C_MXFER_T *mHead; /* Ongoing master transfer, first in the queue */
+    I2C_MXFER_T *mTail; /* Last queued master transfer */
+    uint8_t mSeg; /* Index of the ongoing segment of mHead */
     uint32_t flags; /* Flags used by I2C master and slave */
 };
 
@@ -207,6 +210,9 @@ static struct i2c_interface i2c[I2C_NUM_INTERFACE] = { {NSS_I2C,
                                                         NULL,
                                                         NULL,
                                                         NULL,
+                                                        NULL,
+                                                        NULL,
+                                                        0,
                                                         0}};
 
 static struct i2c_slave_interface i2c_slave[I2C_NUM_INTERFACE][I2C_SLAVE_NUM_INTERFACE];
@@ -268,6 +274,22 @@ static inline int getCurState(NSS_I2C_T *pI2C)
     return (int)(pI2C->STAT & I2C_STAT_CODE_BITMASK);
 }
 
+/* Check if the master is in the middle of a write, ready for the next byte */
+static inline int isMasterTxReady(NSS_I2C_T *pI2C)
+{
+    int state = getCurState(pI2C);
+    return (state == 0x18) || (state == 0x28);
+}
+
+/* Start the ongoing segment of the queued master transfers */
+static void startQueuedXfer(struct i2c_interface *iic)
+{
+    /* A stop condition which is still being generated delays the new start condition by at most one SCL period. */
+    while (!isI2CBusFree(iic->ip)) {
+    }
+    startMasterXfer(iic->ip);
+}
+
 /* Check if the active state belongs to master mode*/
 static inline int isMasterState(NSS_I2C_T *pI2C)
 {
@@ -496,6 +518,30 @@ void Chip_I2C_EventHandler(I2C_ID_T id, I2C_EVENT_T event)
     }
 }
 
+/* Chip event handler interrupt based, sleeping while waiting */
+void Chip_I2C_EventHandlerSleep(I2C_ID_T id, I2C_EVENT_T event)
+{
+    struct i2c_interface *iic = &i2c[id];
+    volatile I2C_STATUS_T *stat;
+
+    /* Only WAIT event needs to be handled */
+    if (event != I2C_EVENT_WAIT) {
+        return;
+    }
+
+    stat = &iic->mXfer->status;
+    /* Interrupts are masked between checking the status and going to sleep: a transfer completing in between leaves
+     * its interrupt pending, which makes the core resume immediately instead of sleeping until an unrelated interrupt.
+     */
+    __disable_irq();
+    while (*stat == I2C_STATUS_BUSY) {
+        Chip_PMU_PowerMode_EnterSleep();
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+}
+
 /* Chip polling event handler */
 void Chip_I2C_EventHandlerPolling(I2C_ID_T id, I2C_EVENT_T event)
 {
@@ -529,6 +575,9 @@ void Chip_I2C_Init(I2C_ID_T id)
     i2c[id].mEvent = Chip_I2C_EventHandler;
     i2c[id].mXfer = NULL;
     i2c[id].sXfer = NULL;
+    i2c[id].mHead = NULL;
+    i2c[id].mTail = NULL;
+    i2c[id].mSeg = 0;
 }
 
 /* De-initializes the I2C peripheral registers to their default reset values */
@@ -560,7 +609,7 @@ uint32_t Chip_I2C_GetClockRate(I2C_ID_T id)
 int Chip_I2C_SetMasterEventHandler(I2C_ID_T id, I2C_EVENTHANDLER_T event)
 {
     struct i2c_interface *iic = &i2c[id];
-    if (!iic->mXfer) {
+    if (!iic->mXfer && !iic->mHead) {
         iic->mEvent = event;
     }
     return iic->mEvent == event;
@@ -572,19 +621,56 @@ I2C_EVENTHANDLER_T Chip_I2C_GetMasterEventHandler(I2C_ID_T id)
     return i2c[id].mEvent;
 }
 
+/* Queue a master transfer */
+void Chip_I2C_MasterSubmit(I2C_ID_T id, I2C_MXFER_T *pMXfer)
+{
+    struct i2c_interface *iic = &i2c[id];
+    uint32_t primask;
+    int n;
+
+    for (n = 0; n < pMXfer->segCount; n++) {
+        pMXfer->pXfer[n].status = I2C_STATUS_BUSY;
+    }
+    pMXfer->status = I2C_STATUS_BUSY;
+    pMXfer->pNext = NULL;
+
+    /* May be called from a completion callback, thus restore the interrupt mask instead of enabling interrupts. */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (iic->mTail) {
+        iic->mTail->pNext = pMXfer;
+        iic->mTail = pMXfer;
+    }
+    else {
+        iic->mHead = pMXfer;
+        iic->mTail = pMXfer;
+        iic->mSeg = 0;
+        /* If slave xfer not in progress */
+        if (!iic->sXfer) {
+            startQueuedXfer(iic);
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+/* Check if all queued master transfers are completed */
+bool Chip_I2C_IsMasterIdle(I2C_ID_T id)
+{
+    return i2c[id].mHead == NULL;
+}
+
 /* Transmit and Receive data in master mode */
 I2C_STATUS_T Chip_I2C_MasterTransfer(I2C_ID_T id, I2C_XFER_T *xfer)
 {
     struct i2c_interface *iic = &i2c[id];
+    I2C_MXFER_T mXfer = {0};
+
+    mXfer.pXfer = xfer;
+    mXfer.segCount = 1;
 
     iic->mEvent(id, I2C_EVENT_LOCK);
-    xfer->status = I2C_STATUS_BUSY;
     iic->mXfer = xfer;
-
-    /* If slave xfer not in progress */
-    if (!iic->sXfer) {
-        startMasterXfer(iic->ip);
-    }
+    Chip_I2C_MasterSubmit(id, &mXfer);
     iic->mEvent(id, I2C_EVENT_WAIT);
     iic->mXfer = 0;
 
@@ -592,11 +678,6 @@ I2C_STATUS_T Chip_I2C_MasterTransfer(I2C_ID_T id, I2C_XFER_T *xfer)
     while (!isI2CBusFree(iic->ip)) {
     }
 
-    /* Start slave if one is active */
-    if (SLAVE_ACTIVE(iic)) {
-        startSlaverXfer(iic->ip);
-    }
-
     iic->mEvent(id, I2C_EVENT_UNLOCK);
     return xfer->status;
 }
@@ -650,9 +731,59 @@ int Chip_I2C_IsMasterActive(I2C_ID_T id)
 /* State change handler for master transfer */
 void Chip_I2C_MasterStateHandler(I2C_ID_T id)
 {
-    if (!handleMasterXferState(i2c[id].ip, i2c[id].mXfer)) {
-        i2c[id].mEvent(id, I2C_EVENT_DONE);
+    struct i2c_interface *iic = &i2c[id];
+    I2C_MXFER_T *head = iic->mHead;
+    I2C_XFER_T *xfer;
+
+    if (!head) {
+        return;
+    }
+    xfer = &head->pXfer[iic->mSeg];
+
+    /* A write with no bytes left continues with the next segment for the same slave, on the same transaction. */
+    while (isMasterTxReady(iic->ip) && !xfer->txSz && !xfer->rxSz && (iic->mSeg + 1 < head->segCount)
+           && (xfer[1].slaveAddr == xfer->slaveAddr)) {
+        xfer->status = I2C_STATUS_DONE;
+        iic->mSeg++;
+        xfer++;
+    }
+
+    if (handleMasterXferState(iic->ip, xfer)) {
+        return;
+    }
+
+    /* The segment has ended. Any next segment starts with a new start condition. */
+    if ((xfer->status == I2C_STATUS_DONE) && (iic->mSeg + 1 < head->segCount)) {
+        iic->mSeg++;
+        startQueuedXfer(iic);
+        return;
+    }
+
+    /* The transfer is done, or has failed: the remaining segments share the outcome. */
+    head->status = xfer->status;
+    while (++iic->mSeg < head->segCount) {
+        head->pXfer[iic->mSeg].status = xfer->status;
+    }
+
+    iic->mSeg = 0;
+    iic->mHead = head->pNext;
+    if (iic->mHead) {
+        startQueuedXfer(iic);
+    }
+    else {
+        iic->mTail = NULL;
+        /* Start slave if one is active */
+        if (SLAVE_ACTIVE(iic)) {
+            while (!isI2CBusFree(iic->ip)) {
+            }
+            startSlaverXfer(iic->ip);
+        }
+    }
+
+    if (head->cb) {
+        head->cb(id, head);
     }
+    iic->mEvent(id, I2C_EVENT_DONE);
 }
 
 /* Setup slave function */
@@ -700,7 +831,7 @@ void Chip_I2C_SlaveStateHandler(I2C_ID_T id)
         }
     }
 
-    iic->sXfer->slaveAddr = (uint8_t)(iic->sXfer->slaveAddr | (iic->mXfer != 0));
+    iic->sXfer->slaveAddr = (uint8_t)(iic->sXfer->slaveAddr | (iic->mHead != 0));
     ret = handleSlaveXferState(iic->ip, iic->sXfer);
     if (ret) {
         if (iic->sXfer->status == I2C_STATUS_DONE) {
@@ -0,0 +1,194 @@
+/*
+ * alarmsim.c
+ *
+ * Checks alarm.c of app_demo against the C library of the PC, and runs a few weeks of the schedule of main.c: the IC in
+ * deep power down until the RTC wake-up counter expires for the next alarm, as sAlarmTimer and SecondsToWake do.
+ *
+ * - Alarm_Next must give the same minute as a search of every minute of the next 8 days, with gmtime for the day of
+ *   the week, for random tables at random times.
+ * - Every alarm must go off in the second its minute starts, once, and an alarm once not again after that.
+ * - The minute of the week kept in the retained word must give the same wake-up as the table itself.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -o alarmsim alarmsim.c ../../app_demo/src/alarm.c
+ *   ./alarmsim                    exit status 1 when a check fails
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "board.h"
+#include "main.h"
+#include "alarm.h"
+
+#define DAY_SECONDS         (24 * 60 * 60)
+
+/* 2024-03-30 17:42:13, a Saturday */
+#define START               1711820533u
+
+static uint8_t sEeprom[4 * EE_PAGE_SIZE];
+static int sRowWrites;
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pData, int size)
+{
+    (void)pEEPROM;
+    memcpy(pData, &sEeprom[offset], (size_t)size);
+}
+
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pData, int size)
+{
+    (void)pEEPROM;
+    memcpy(&sEeprom[offset], pData, (size_t)size);
+    sRowWrites++;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static uint32_t sRandom = 12345;
+
+static uint32_t Random(uint32_t n)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+    return (sRandom >> 8) % n;
+}
+
+static void RandomTable(void)
+{
+    ALARM_T alarm;
+    int slot;
+
+    for (slot = 0; slot < ALARM_COUNT; slot++) {
+        alarm.hour = (uint8_t)Random(24);
+        alarm.minute = (uint8_t)Random(60);
+        alarm.days = (uint8_t)Random(0x80);
+        alarm.flags = (uint8_t)((Random(3) ? ALARM_ENABLED : 0) | (Random(4) ? 0 : ALARM_ONCE));
+        Alarm_Set(slot, &alarm);
+    }
+}
+
+/* The first enabled alarm after @a after, minute by minute */
+static uint32_t Search(uint32_t after)
+{
+    uint32_t minute = (after / 60 + 1) * 60;
+    ALARM_T alarm;
+    struct tm tm;
+    time_t t;
+    int slot;
+    uint8_t days;
+
+    for (; minute < after + 8 * DAY_SECONDS; minute += 60) {
+        t = (time_t)minute;
+        gmtime_r(&t, &tm);
+        for (slot = 0; slot < ALARM_COUNT; slot++) {
+            Alarm_Get(slot, &alarm);
+            days = alarm.days ? alarm.days : ALARM_EVERY_DAY;
+            if ((alarm.flags & ALARM_ENABLED) && (days & ALARM_DAY(tm.tm_wday)) && (alarm.hour == tm.tm_hour)
+                    && (alarm.minute == tm.tm_min)) {
+                return minute;
+            }
+        }
+    }
+    return ALARM_NONE;
+}
+
+static bool CheckNext(void)
+{
+    uint32_t after;
+    uint32_t expected;
+    uint32_t next;
+    int table;
+    int n;
+
+    for (table = 0; table < 200; table++) {
+        RandomTable();
+        for (n = 0; n < 50; n++) {
+            after = START + Random(400 * DAY_SECONDS);
+            expected = Search(after);
+            next = Alarm_Next(after);
+            if (next != expected) {
+                printf("  table %d: next after %u is %u instead of %u\n", table, after, next, expected);
+                return false;
+            }
+            if ((next != ALARM_NONE) && (Alarm_SecondsTo(Alarm_MinuteOfWeek(next), after) != next - after)) {
+                printf("  table %d: retained minute %u gives another wake-up\n", table, Alarm_MinuteOfWeek(next));
+                return false;
+            }
+        }
+    }
+    printf("%-32s %d tables, as gmtime\n", "next alarm", table);
+    return true;
+}
+
+/* Weeks of deep power down between the alarms, as main.c schedules them */
+static bool CheckSchedule(void)
+{
+    static const ALARM_T alarms[] = {
+        {7, 0, ALARM_DAY(1) | ALARM_DAY(2) | ALARM_DAY(3) | ALARM_DAY(4) | ALARM_DAY(5), ALARM_ENABLED},
+        {9, 30, ALARM_DAY(0) | ALARM_DAY(6), ALARM_ENABLED},
+        {17, 45, 0, ALARM_ENABLED | ALARM_ONCE},
+        {23, 59, ALARM_DAY(3), ALARM_ENABLED},
+    };
+    uint32_t now = START;
+    uint32_t next;
+    uint32_t wake;
+    uint16_t retained;
+    int fired[4] = {0, 0, 0, 0};
+    int wakes = 0;
+    int slot;
+    ALARM_T alarm;
+    struct tm tm;
+    time_t t;
+
+    memset(sEeprom, 0xFF, sizeof(sEeprom));
+    Alarm_Load();
+    for (slot = 0; slot < 4; slot++) {
+        Alarm_Set(slot, &alarms[slot]);
+    }
+    sRowWrites = 0;
+    next = Alarm_Next(now - ALARM_LATE_SECONDS - 1);
+    for (;;) {
+        /* Deep power down: only the minute of the week is retained, the wake-up counter was set from it */
+        retained = Alarm_MinuteOfWeek(next);
+        wake = now + Alarm_SecondsTo(retained, now);
+        if (wake >= START + 28 * DAY_SECONDS) {
+            break;
+        }
+        if (wake != next) {
+            printf("  woke up at %u instead of %u\n", wake, next);
+            return false;
+        }
+        now = wake;
+        wakes++;
+        if (Alarm_SecondsTo(retained, now) != 0) {
+            printf("  the alarm of %u is not due at its wake-up\n", next);
+            return false;
+        }
+        t = (time_t)now;
+        gmtime_r(&t, &tm);
+        for (slot = 0; slot < 4; slot++) {
+            if ((alarms[slot].hour == tm.tm_hour) && (alarms[slot].minute == tm.tm_min)) {
+                fired[slot]++;
+            }
+        }
+        /* The full wake reads the table again */
+        Alarm_Load();
+        next = Alarm_Fired(now);
+        now += 10;
+    }
+    Alarm_Get(2, &alarm);
+    if ((fired[0] != 20) || (fired[1] != 8) || (fired[2] != 1) || (fired[3] != 4) || (alarm.flags & ALARM_ENABLED)) {
+        printf("  went off %d, %d, %d, %d times\n", fired[0], fired[1], fired[2], fired[3]);
+        return false;
+    }
+    printf("%-32s %d wake-ups in 4 weeks, all at the second, %d row writes\n", "schedule", wakes, sRowWrites);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    ok &= CheckNext();
+    ok &= CheckSchedule();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,23 @@
+/*
+ * Host stand-in for the board and chip headers, so drift.c of app_demo builds and runs on a PC. driftsim.c
+ * implements what is declared here.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NSS_RTC     NULL
+#define NSS_EEPROM  NULL
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pData, int size);
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pData, int size);
+int Chip_RTC_GetCalibration(void *pRTC);
+void Chip_RTC_SetCalibration(void *pRTC, int calibration);
+void Chip_PMU_SetRetainedData(uint32_t *pData, int offset, int size);
+void Chip_PMU_GetRetainedData(uint32_t *pData, int offset, int size);
+
+#endif
@@ -0,0 +1,216 @@
+/*
+ * driftsim.c
+ *
+ * Runs drift.c of app_demo against a model of the TFRO over two years: its rate a linear function of the
+ * temperature, which follows the seasons and the day. The RTC counts RTCCAL pulses per tick, so the clock runs at
+ * f(T) / RTCCAL ticks per second. The sample wakes of the logger call Drift_Apply every LOGGER_BATCH-th wake, and the
+ * phone sets the time every few days to three weeks, calling Drift_Sync first.
+ *
+ * The same two years are run without Drift_Apply, RTCCAL left at its factory value. Reported is the error of the RTC
+ * just before each tap of the phone in the second year, once the fit has its history.
+ *
+ * The model is not a measurement: the rates below are made up to be of the size of the TFRO, and the temperature is
+ * a smooth curve. What it checks is the arithmetic - the fit finds the rate and the coefficient back from the errors
+ * and the log, and the dithering of RTCCAL keeps the mean exact - not how good the linear model is for the chip.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -o driftsim driftsim.c ../../app_demo/src/drift.c -lm
+ *   ./driftsim                    exit status 1 when a check fails
+ */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "board.h"
+#include "main.h"
+#include "logger.h"
+#include "drift.h"
+
+#define PI                  3.14159265358979
+#define DAY_SECONDS         (24 * 60 * 60)
+#define YEAR_SECONDS        (365 * DAY_SECONDS)
+#define FACTORY_CAL         32768
+
+/* The TFRO: ppb at 25 C, and ppb per degree */
+#define MODEL_PPB           35000.0
+#define MODEL_PPB_PER_DEGREE (-600.0)
+
+/* 2024-01-01 */
+#define START               1704067200u
+
+#define MAX_SAMPLES         (2 * YEAR_SECONDS / LOGGER_INTERVAL_SECONDS + 10)
+
+static uint8_t sEeprom[5 * EE_PAGE_SIZE];
+static uint32_t sRetained[5];
+static int sCal;
+static int16_t sLog[MAX_SAMPLES];
+static int sLogCount;
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pData, int size)
+{
+    (void)pEEPROM;
+    memcpy(pData, &sEeprom[offset], (size_t)size);
+}
+
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pData, int size)
+{
+    (void)pEEPROM;
+    memcpy(&sEeprom[offset], pData, (size_t)size);
+}
+
+int Chip_RTC_GetCalibration(void *pRTC)
+{
+    (void)pRTC;
+    return sCal;
+}
+
+void Chip_RTC_SetCalibration(void *pRTC, int calibration)
+{
+    (void)pRTC;
+    sCal = calibration;
+}
+
+void Chip_PMU_SetRetainedData(uint32_t *pData, int offset, int size)
+{
+    memcpy(&sRetained[offset], pData, (size_t)size * sizeof(uint32_t));
+}
+
+void Chip_PMU_GetRetainedData(uint32_t *pData, int offset, int size)
+{
+    memcpy(pData, &sRetained[offset], (size_t)size * sizeof(uint32_t));
+}
+
+/* Stands in for the storage mod: the log of the run */
+bool Logger_GetMean(uint32_t seconds, int *mean)
+{
+    int count = (int)(seconds / LOGGER_INTERVAL_SECONDS);
+    int32_t sum = 0;
+    int n;
+
+    if (count > sLogCount) {
+        count = sLogCount;
+    }
+    if (count <= 0) {
+        return false;
+    }
+    for (n = sLogCount - count; n < sLogCount; n++) {
+        sum += sLog[n];
+    }
+    *mean = (int)(sum / count);
+    return true;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static uint32_t sRandom;
+
+static uint32_t Random(uint32_t n)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+    return (sRandom >> 8) % n;
+}
+
+/* In Celsius: 18 C, 8 C of seasons and 4 C of day and night */
+static double Temperature(double time)
+{
+    return 18.0 + 8.0 * sin(2 * PI * time / YEAR_SECONDS) + 4.0 * sin(2 * PI * time / DAY_SECONDS);
+}
+
+/* Pulses of the TFRO per second */
+static double Frequency(double temperature)
+{
+    return 32768.0 * (1.0 + (MODEL_PPB + MODEL_PPB_PER_DEGREE * (temperature - 25.0)) * 1e-9);
+}
+
+typedef struct RESULT_S {
+    double worst;                   /* Seconds */
+    double mean;                    /* Seconds */
+    double days;                    /* Mean interval between taps */
+} RESULT_T;
+
+/* Two years; with @a correct false RTCCAL stays at the factory value */
+static RESULT_T Run(bool correct)
+{
+    RESULT_T result = {0, 0, 0};
+    DRIFT_RECORD_T record;
+    double time = 0;                /* True seconds since START */
+    double rtcFraction = 0;         /* Part of a tick counted since the last tick */
+    uint32_t rtc = START;
+    uint32_t reference;
+    double nextTap = 3 * DAY_SECONDS;
+    double lastTap = 0;
+    double error;
+    double seconds;
+    uint32_t wake;
+    int wakes = 0;
+    int taps = 0;
+    int temperature;
+
+    memset(sEeprom, 0xFF, sizeof(sEeprom));
+    memset(sRetained, 0, sizeof(sRetained));
+    sRetained[3] = RETAINED_STATUS_HEADER;
+    sCal = FACTORY_CAL;
+    sLogCount = 0;
+    sRandom = 4321;
+
+    while (time < 2 * YEAR_SECONDS) {
+        /* Deep power down until the next sample; the temperature hardly changes in that time */
+        wake = LOGGER_INTERVAL_SECONDS - rtc % LOGGER_INTERVAL_SECONDS;
+        seconds = ((double)wake - rtcFraction) * sCal / Frequency(Temperature(time));
+        if (time + seconds >= nextTap) {
+            /* The phone taps first: the RTC as far as it got, the true time in whole seconds */
+            seconds = nextTap - time;
+            rtcFraction += seconds * Frequency(Temperature(time)) / sCal;
+            rtc += (uint32_t)rtcFraction;
+            rtcFraction -= floor(rtcFraction);
+            time = nextTap;
+            reference = START + (uint32_t)time;
+            error = (double)rtc + rtcFraction - (START + time);
+            if (time >= YEAR_SECONDS) {
+                result.worst = fmax(result.worst, fabs(error));
+                result.mean += fabs(error);
+                result.days += (time - lastTap) / DAY_SECONDS;
+                taps++;
+            }
+            temperature = (int)lround(Temperature(time) * 10);
+            if (correct) {
+                Drift_Sync(rtc, reference, temperature);
+            }
+            rtc = reference;
+            rtcFraction = 0;
+            if (correct) {
+                Drift_Apply(temperature, LOGGER_SECONDS_TO_COMMIT(LOGGER_INTERVAL_SECONDS - rtc % LOGGER_INTERVAL_SECONDS));
+            }
+            lastTap = time;
+            nextTap = time + (double)(4 * DAY_SECONDS + Random(17 * DAY_SECONDS));
+            continue;
+        }
+        time += seconds;
+        rtc += wake;
+        rtcFraction = 0;
+        temperature = (int)lround(Temperature(time) * 10);
+        sLog[sLogCount++] = (int16_t)temperature;
+        if (correct && (++wakes % LOGGER_BATCH == 0)) {
+            Drift_Apply(temperature, LOGGER_SECONDS_TO_COMMIT(LOGGER_INTERVAL_SECONDS));
+        }
+    }
+    result.mean /= taps;
+    result.days /= taps;
+
+    if (correct) {
+        Chip_EEPROM_Read(NSS_EEPROM, EE_OFFSET_DRIFT, &record, sizeof(record));
+        printf("%-32s %.1f ppm at 25 C, %.2f ppm per degree; the model %.1f ppm, %.2f ppm per degree\n", "fit",
+               record.rate / 1000.0, record.coefficient / 1000.0, MODEL_PPB / 1000, MODEL_PPB_PER_DEGREE / 1000);
+    }
+    return result;
+}
+
+int main(void)
+{
+    RESULT_T off = Run(false);
+    RESULT_T on = Run(true);
+
+    printf("%-32s a tap every %.1f days on average, the error just before it:\n", "second year", on.days);
+    printf("%-32s %6.2f s at most, %6.2f s on average\n", "  RTCCAL left as it is", off.worst, off.mean);
+    printf("%-32s %6.2f s at most, %6.2f s on average\n", "  corrected", on.worst, on.mean);
+    return ((on.worst < 1.5) && (on.worst * 10 < off.worst)) ? 0 : 1;
+}
@@ -0,0 +1,17 @@
+/*
+ * Host stand-in for the board and chip headers, so event.c of app_demo builds and runs on a PC. eventsim.c
+ * implements what is declared here.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+void Chip_PMU_PowerMode_EnterSleep(void);
+void __disable_irq(void);
+void __enable_irq(void);
+
+#endif
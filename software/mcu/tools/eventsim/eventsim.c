@@ -0,0 +1,209 @@
+/*
+ * eventsim.c
+ *
+ * Replays a trace of interrupts through the event queue of app_demo, on a simulated clock, and reports what
+ * Event_GetStats would report on the target: per event type the latency from the interrupt to its handler and the
+ * time spent in the handler, and how much of the time the core could sleep.
+ *
+ * A trace has one interrupt per line, in order of time:
+ *   <time in us> <type> <data> <handler cost in us>
+ * with type one of TICK, TEMPERATURE, NFC_FIELD, NFC_MESSAGE. '#' starts a comment. Without a file, a built-in
+ * trace is used: a 10 s wake-up with a phone writing a command halfway.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -o eventsim eventsim.c ../../app_demo/src/event.c
+ *   ./eventsim [trace]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "board.h"
+#include "timer.h"
+#include "event.h"
+#include "clock.h"
+#include "profile.h"
+
+/* Ticks of Timer_GetFreeRunning per us */
+#define TICKS_PER_US    (TIMER_TICK_HZ / 1000000)
+#define MAX_TRACE       4096
+
+typedef struct {
+    uint32_t time;      // us
+    EVENT_TYPE_T type;
+    int32_t data;
+    uint32_t cost;      // us
+    bool dropped;
+} TRACE_T;
+
+static const char * const sNames[EVENT_TYPE_COUNT] = {"TICK", "TEMPERATURE", "NFC_FIELD", "NFC_MESSAGE"};
+
+static TRACE_T sTrace[MAX_TRACE];
+static int sCount;
+static int sPosted;         // Next entry to raise
+static int sHandled;        // Next entry to handle
+static uint32_t sNow;       // In ticks
+static jmp_buf sEnd;
+
+/* -------------------------------------------------------------------------------- */
+
+uint32_t Timer_GetFreeRunning(void)
+{
+    return sNow;
+}
+
+void __disable_irq(void)
+{
+}
+
+void Clock_Request(CLOCK_LEVEL_T level)
+{
+    (void)level;
+}
+
+void Clock_Release(CLOCK_LEVEL_T level)
+{
+    (void)level;
+}
+
+void Profile_Add(PROFILE_REGION_T region, uint32_t ticks)
+{
+    (void)region;
+    (void)ticks;
+}
+
+void __enable_irq(void)
+{
+}
+
+/* Raises all interrupts up to @a until, each at its own time */
+static void Raise(uint32_t until)
+{
+    while ((sPosted < sCount) && (sTrace[sPosted].time * TICKS_PER_US <= until)) {
+        sNow = sTrace[sPosted].time * TICKS_PER_US;
+        sTrace[sPosted].dropped = !Event_Post(sTrace[sPosted].type, sTrace[sPosted].data);
+        sPosted++;
+    }
+    sNow = until;
+}
+
+/* Sleeps until the next interrupt; the trace ends when none is left */
+void Chip_PMU_PowerMode_EnterSleep(void)
+{
+    if (sPosted >= sCount) {
+        longjmp(sEnd, 1);
+    }
+    Raise(sTrace[sPosted].time * TICKS_PER_US);
+}
+
+/* Every handler runs for the cost of its entry, meanwhile interrupts keep coming */
+static void Handler(const EVENT_T *event)
+{
+    while (sTrace[sHandled].dropped) {
+        sHandled++;
+    }
+    if (sTrace[sHandled].type != event->type) {
+        fprintf(stderr, "event %d out of order\n", sHandled);
+        exit(1);
+    }
+    Raise(sNow + sTrace[sHandled].cost * TICKS_PER_US);
+    sHandled++;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static void Add(uint32_t time, EVENT_TYPE_T type, int32_t data, uint32_t cost)
+{
+    if (sCount < MAX_TRACE) {
+        sTrace[sCount++] = (TRACE_T){time, type, data, cost, false};
+    }
+}
+
+/*
+ * Ten seconds awake. Each second: the RTC tick starts a measurement, the temperature arrives 1.5 ms later and its
+ * handler updates the display. At 4 s a phone comes close and writes a command; its handler includes the busy delay
+ * before the buzzer stops.
+ */
+static void DefaultTrace(void)
+{
+    uint32_t s;
+
+    for (s = 0; s < 10; s++) {
+        Add(s * 1000000, EVENT_TICK, 0, 120);
+        Add(s * 1000000 + 1500, EVENT_TEMPERATURE, 215, (s == 0) ? 45000 : 4000);
+        if (s == 4) {
+            Add(s * 1000000 + 300000, EVENT_NFC_FIELD, 1, 30);
+            Add(s * 1000000 + 350000, EVENT_NFC_MESSAGE, 0, 170000);
+            Add(s * 1000000 + 400000, EVENT_NFC_FIELD, 0, 30);
+        }
+    }
+}
+
+static bool Load(const char *path)
+{
+    char line[256];
+    char name[32];
+    unsigned long time;
+    long data;
+    unsigned long cost;
+    int type;
+    FILE *f = fopen(path, "r");
+
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "#")] = '\0';
+        if (sscanf(line, "%lu %31s %ld %lu", &time, name, &data, &cost) != 4) {
+            continue;
+        }
+        for (type = 0; (type < EVENT_TYPE_COUNT) && strcmp(name, sNames[type]); type++) {
+        }
+        if (type == EVENT_TYPE_COUNT) {
+            fprintf(stderr, "%s: unknown type %s\n", path, name);
+            fclose(f);
+            return false;
+        }
+        Add((uint32_t)time, (EVENT_TYPE_T)type, (int32_t)data, (uint32_t)cost);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    static const EVENT_HANDLER_T handlers[EVENT_TYPE_COUNT] = {Handler, Handler, Handler, Handler};
+    EVENT_STATS_T stats;
+    int type;
+    uint32_t total;
+
+    if (argc > 1) {
+        if (!Load(argv[1])) {
+            return 1;
+        }
+    }
+    else {
+        DefaultTrace();
+    }
+
+    Event_Init();
+    if (!setjmp(sEnd)) {
+        for (;;) {
+            Event_Dispatch(handlers);
+        }
+    }
+    Event_GetStats(&stats, false);
+
+    printf("%-12s %6s %14s %14s %14s\n", "event", "count", "max lat [us]", "max dur [us]", "avg dur [us]");
+    for (type = 0; type < EVENT_TYPE_COUNT; type++) {
+        EVENT_TYPE_STATS_T *t = &stats.type[type];
+        printf("%-12s %6u %14u %14u %14u\n", sNames[type], t->count, t->maxLatency / TICKS_PER_US,
+               t->maxDuration / TICKS_PER_US, t->count ? t->totalDuration / t->count / TICKS_PER_US : 0);
+    }
+    total = stats.asleep + stats.awake;
+    printf("asleep %u us, awake %u us: %.2f%% of the time awake (the busy loop: 100%%)\n",
+           stats.asleep / TICKS_PER_US, stats.awake / TICKS_PER_US, total ? 100.0 * stats.awake / total : 0.0);
+    printf("dropped %u\n", stats.dropped);
+    return 0;
+}
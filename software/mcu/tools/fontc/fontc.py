@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""
+Font compiler for the OLED clock face.
+
+Reads the complete glyph and icon tables from fonts_src.c, keeps only the glyphs the firmware draws, compresses each
+glyph and icon separately and writes app_demo/src/fonts.c. The tables are stored in the panel's page layout, so the
+firmware can decode a glyph byte by byte straight into the display output without a scratch buffer.
+
+Each glyph is a stream of tokens (see FONT_RLE_* in fonts.h):
+    0nnnnnnn    n+1 literal bytes follow
+    10nnnnnn    the next byte is repeated n+2 times
+    11nnnnnn    n+1 zero bytes
+
+For proportional text each glyph also gets its metrics: the first column with ink, and the advance - the inked
+columns plus one column of spacing. Digits all get the advance of the widest digit, centred, so numbers keep their
+width as they change. A space advances half the glyph width.
+
+Afterwards the flash reclaimed compared to the former uncompressed tables is reported, together with the number of
+extra samples the storage module can keep in it: the sample region starts at the first flash page after the image.
+
+STORAGE_BITSIZE is read from app_demo/mods/app_sel.h, or is 8 - the default of storage_dft.h - when not set there.
+
+Usage: fontc.py [--chars Font8x16=" -.0123456789F"] [--storage-bitsize 11] [-o ../../app_demo/src/fonts.c]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_SRC = os.path.join(HERE, 'fonts_src.c')
+DEFAULT_OUT = os.path.join(HERE, '..', '..', 'app_demo', 'src', 'fonts.c')
+APP_SEL = os.path.join(HERE, '..', '..', 'app_demo', 'mods', 'app_sel.h')
+
+FLASH_PAGE_SIZE = 64        # chip.h
+FIRST_CHAR = 0x20           # both fonts start at the space
+
+# name in fonts.c, table in fonts_src.c, width in columns, height in pages, characters used by the firmware
+FONTS = [
+    # Temperature, date and graph labels: "-%d.%d" with Bmp_Degree and 'C' or 'F', "%d-%02d-%02d".
+    # Text messages from the phone: upper case and basic punctuation, lower case is drawn as upper case.
+    ('Font8x16', 'F16x16', 8, 2, ' -.0123456789F' + "!'()+,/:?ABCDEFGHIJKLMNOPQRSTUVWXYZ"),
+    # Time: "%d:%d", with a space instead of the colon on odd seconds
+    ('Font16x32', 'F32x16', 16, 4, ' 0123456789:'),
+]
+
+# name in fonts.c, table in fonts_src.c, width in columns, height in pages
+BITMAPS = [
+    ('Bmp_Degree', 'logo_degree', 4, 2),
+    ('Bmp_AlarmSet', 'logo_alarm_set', 16, 2),
+    ('Bmp_AlarmClr', 'logo_alarm_clr', 16, 2),
+    ('Bmp_BatteryFull', 'battery_full', 24, 2),
+    ('Bmp_BatteryMid', 'battery_mid', 24, 2),
+    ('Bmp_BatteryLow', 'battery_low', 24, 2),
+    ('Bmp_BatteryEmpty', 'battery_nop', 24, 2),
+]
+
+# Tables that were linked into the firmware before, uncompressed and complete
+FORMER_TABLES = ['F16x16', 'F32x16', 'logo_temp', 'logo_alarm_set', 'logo_alarm_clr', 'battery_full']
+
+# sizeof(FONT_T) and sizeof(BITMAP_T) on the Cortex-M0+
+FONT_T_SIZE = 16
+BITMAP_T_SIZE = 8
+
+
+def parse_tables(path):
+    """Returns {name: [bytes]} for every 'const uint8_t name[] = {...};' in the C source."""
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    tables = {}
+    for m in re.finditer(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', text, flags=re.S):
+        tables[m.group(1)] = [int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]+', m.group(2))]
+    return tables
+
+
+def rle(data):
+    """Compresses one glyph or icon, see the token format above."""
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i]:
+            run += 1
+        if data[i] == 0:
+            # A zero run costs one byte, even when it is a single zero inside literals
+            run = min(run, 64)
+            flush_literal()
+            out.append(0xC0 | (run - 1))
+        elif run >= 3:
+            # A run of two in the middle of literals is cheaper as literals
+            run = min(run, 65)
+            flush_literal()
+            out.extend([0x80 | (run - 2), data[i]])
+        else:
+            run = 1
+            literal.append(data[i])
+        i += run
+    flush_literal()
+    return out
+
+
+def unrle(stream, size):
+    out = []
+    i = 0
+    while len(out) < size:
+        token = stream[i]
+        i += 1
+        if token & 0x80 == 0:
+            out.extend(stream[i:i + token + 1])
+            i += token + 1
+        elif token & 0x40:
+            out.extend([0] * ((token & 0x3F) + 1))
+        else:
+            out.extend([stream[i]] * ((token & 0x3F) + 2))
+            i += 1
+    return out, i
+
+
+def c_bytes(data, indent='    ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x%02X' % b for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def c_string(chars):
+    return '"' + chars.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def ink_columns(glyph, width, pages):
+    """Returns the first and last column with any pixel set, or None for an empty glyph."""
+    inked = [col for col in range(width) if any(glyph[page * width + col] for page in range(pages))]
+    return (inked[0], inked[-1]) if inked else None
+
+
+def glyph_metrics(glyphs, chars, width, pages):
+    """Returns (left, advance) per glyph, see the module description."""
+    ink = [ink_columns(g, width, pages) for g in glyphs]
+    digit_width = max([i[1] - i[0] + 1 for c, i in zip(chars, ink) if c.isdigit() and i] or [0])
+    metrics = []
+    for c, i in zip(chars, ink):
+        if i is None:
+            metrics.append((0, width // 2))
+            continue
+        first, last = i
+        if c.isdigit():
+            left = max(0, first - (digit_width - (last - first + 1)) // 2)
+            metrics.append((left, digit_width + 1))
+        else:
+            metrics.append((first, last - first + 2))
+    return metrics
+
+
+def compile_font(tables, name, table, width, pages, chars):
+    glyph_size = width * pages
+    src = tables[table]
+    stream = []
+    offsets = []
+    glyphs = []
+    for c in chars:
+        index = ord(c) - FIRST_CHAR
+        glyph = src[index * glyph_size:(index + 1) * glyph_size]
+        if index < 0 or len(glyph) != glyph_size:
+            sys.exit('fontc: %s has no glyph for %r' % (table, c))
+        glyphs.append(glyph)
+        packed = rle(glyph)
+        assert unrle(packed, glyph_size) == (glyph, len(packed))
+        offsets.append(len(stream))
+        stream.extend(packed)
+    if len(stream) > 0xFFFF:
+        sys.exit('fontc: %s does not fit 16 bit offsets' % name)
+
+    code = []
+    code.append('/* %s: %d of %d glyphs, %d bytes instead of %d */' %
+                (name, len(chars), len(src) // glyph_size, len(stream), len(chars) * glyph_size))
+    code.append('static const uint8_t s%sData[] =\n{' % name)
+    for c, start, end in zip(chars, offsets, offsets[1:] + [len(stream)]):
+        code.append('    /* %r */' % c)
+        code.append(c_bytes(stream[start:end], indent='        '))
+    code.append('};\n')
+    code.append('static const uint16_t s%sOffset[] =\n{' % name)
+    code.append('    ' + ', '.join(str(o) for o in offsets) + ',')
+    code.append('};\n')
+    code.append('static const GLYPH_METRICS_T s%sMetrics[] =\n{' % name)
+    metrics = glyph_metrics(glyphs, chars, width, pages)
+    for i in range(0, len(metrics), 8):
+        code.append('    ' + ' '.join('{%d, %d},' % m for m in metrics[i:i + 8]))
+    code.append('};\n')
+    code.append('const FONT_T %s =\n{' % name)
+    code.append('    s%sData, s%sOffset, s%sMetrics, %s, %d, %d' % (name, name, name, c_string(chars), width, pages))
+    code.append('};\n')
+
+    size = len(stream) + 2 * len(offsets) + 2 * len(metrics) + len(chars) + 1 + FONT_T_SIZE
+    return '\n'.join(code), size
+
+
+def compile_bitmap(tables, name, table, width, pages):
+    src = tables[table]
+    if len(src) != width * pages:
+        sys.exit('fontc: %s is not %d x %d' % (table, width, pages))
+    packed = rle(src)
+    assert unrle(packed, len(src)) == (src, len(packed))
+
+    code = []
+    code.append('/* %s: %d bytes instead of %d */' % (name, len(packed), len(src)))
+    code.append('static const uint8_t s%sData[] =\n{' % name)
+    code.append(c_bytes(packed))
+    code.append('};\n')
+    code.append('const BITMAP_T %s = {s%sData, %d, %d};\n' % (name, name, width, pages))
+    return '\n'.join(code), len(packed) + BITMAP_T_SIZE
+
+
+def storage_bitsize(path):
+    """STORAGE_BITSIZE as the application selects it, else the default of the storage module"""
+    with open(path) as f:
+        m = re.search(r'^\s*#define\s+STORAGE_BITSIZE\s+(\d+)', f.read(), re.MULTILINE)
+    return int(m.group(1)) if m else 8
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('--src', default=DEFAULT_SRC, help='complete tables (default: fonts_src.c)')
+    parser.add_argument('-o', '--out', default=DEFAULT_OUT, help='generated source (default: app_demo/src/fonts.c)')
+    parser.add_argument('--chars', action='append', default=[], metavar='FONT=CHARS',
+                        help='replace the character set of one font, e.g. Font8x16=" -.0123456789F"')
+    parser.add_argument('--storage-bitsize', type=int, default=None,
+                        help='STORAGE_BITSIZE of the firmware, to report the sample capacity (default: as in '
+                             'app_demo/mods/app_sel.h)')
+    args = parser.parse_args()
+    if args.storage_bitsize is None:
+        args.storage_bitsize = storage_bitsize(APP_SEL)
+
+    fonts = [list(f) for f in FONTS]
+    for spec in args.chars:
+        name, _, chars = spec.partition('=')
+        match = [f for f in fonts if f[0] == name]
+        if not match or not chars:
+            sys.exit('fontc: bad --chars %r' % spec)
+        match[0][4] = chars
+    for f in fonts:
+        # The decoder falls back to the first glyph for a character that is not present: make that a space.
+        f[4] = ' ' + ''.join(sorted(set(f[4]) - {' '}))
+
+    tables = parse_tables(args.src)
+    parts = []
+    new_size = 0
+    for f in fonts:
+        code, size = compile_font(tables, *f)
+        parts.append(code)
+        new_size += size
+    for b in BITMAPS:
+        code, size = compile_bitmap(tables, *b)
+        parts.append(code)
+        new_size += size
+
+    old_size = sum(len(tables[t]) for t in FORMER_TABLES)
+    reclaimed = old_size - new_size
+    samples_per_page = FLASH_PAGE_SIZE * 8 // args.storage_bitsize
+    report = [
+        'Former tables:   %5d bytes' % old_size,
+        'Compressed:      %5d bytes, including indexes and all battery icons' % new_size,
+        'Reclaimed:       %5d bytes = %d to %d flash pages' % (reclaimed, reclaimed // FLASH_PAGE_SIZE,
+                                                               (reclaimed + FLASH_PAGE_SIZE - 1) // FLASH_PAGE_SIZE),
+        'Sample capacity: +%d samples of %d bits (at least)' % (reclaimed // FLASH_PAGE_SIZE * samples_per_page,
+                                                                args.storage_bitsize),
+    ]
+
+    with open(args.out, 'w', newline='\n') as f:
+        f.write('/*\n * Generated by tools/fontc/fontc.py from tools/fontc/fonts_src.c - do not edit.\n *\n')
+        for line in report:
+            f.write(' * ' + line + '\n')
+        f.write(' */\n\n#include "fonts.h"\n\n')
+        f.write('\n'.join(parts))
+
+    print('\n'.join(report))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,404 @@
+/*
+ * Complete glyph and icon tables of the OLED clock face, in the panel's page layout: each table holds one row of
+ * bytes per page, one byte per column, LSB on top.
+ *
+ * This file is not built into the firmware. fontc.py reads it, keeps only the glyphs the firmware uses, and writes
+ * the compressed result to app_demo/src/fonts.c.
+ */
+
+#include <stdint.h>
+
+// 24 * 2
+const uint8_t battery_full[] =
+{
+	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x7D,0x7D,0x7D,0x01,0x7D,0x7D,0x7D,0x7D,0x01,0x7D,0x7D,0x7D,0x7D,0x7D,0x01,0xFF,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
+};
+
+// 24 * 2
+const uint8_t battery_mid[] =
+{
+	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x01,0x01,0x01,0x01,0x7D,0x7D,0x7D,0x7D,0x01,0x7D,0x7D,0x7D,0x7D,0x7D,0x01,0xFF,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
+};
+// 24 * 2
+const uint8_t battery_low[] =
+{
+	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x7D,0x7D,0x7D,0x7D,0x7D,0x01,0xFF,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
+};
+// 24 * 2
+const uint8_t battery_nop[] =
+{
+	0x00,0x00,0x00,0x7C,0x44,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00
+};
+
+/* Degree sign, the ring of logo_temp on its own: a unit letter follows it as a normal character */
+const uint8_t logo_degree[] =
+{
+	0x06,0x09,0x09,0x06,
+	0x00,0x00,0x00,0x00/*"°",0*/
+};
+
+/* Alarm enable logo */
+const uint8_t logo_alarm_set[] =
+{
+	0x00,0xC0,0x36,0x0B,0x07,0x05,0x03,0xFA,0x03,0x05,0x07,0x0B,0x36,0xC0,0x00,0x00,
+	0x00,0x07,0x19,0x21,0x41,0x41,0x81,0x81,0x80,0x40,0x40,0x20,0x18,0x07,0x00,0x00
+};
+
+/* Alarm disable logo */
+const uint8_t logo_alarm_clr[] =
+{
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+/*************************** 16*16 Charactors Lib ***************************/
+const uint8_t F16x16[] =
+{
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*" ",0*/
+
+0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x60,0x00,0x00,0x00,/*"!",1*/
+
+0x00,0x20,0x18,0x0C,0x20,0x18,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*""",2*/
+
+0x80,0x80,0xF0,0x80,0x80,0xF0,0x80,0x00,0x08,0x7F,0x08,0x08,0x7F,0x08,0x08,0x00,/*"#",3*/
+
+0x00,0xE0,0x10,0xF8,0x10,0x60,0x00,0x00,0x00,0x30,0x41,0xFF,0x42,0x3C,0x00,0x00,/*"$",4*/
+
+0xE0,0x10,0xE0,0x00,0xC0,0x30,0x00,0x00,0x01,0x42,0x39,0x06,0x3D,0x42,0x3C,0x00,/*"%",5*/
+
+0x00,0xE0,0x10,0x10,0xE0,0x00,0x00,0x00,0x3C,0x43,0x46,0x49,0x32,0x4E,0x42,0x20,/*"&",6*/
+
+0x20,0x2C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"'",7*/
+
+0x00,0x00,0x00,0xC0,0x30,0x08,0x04,0x00,0x00,0x00,0x00,0x0F,0x30,0x40,0x80,0x00,/*"(",8*/
+
+0x00,0x04,0x08,0x30,0xC0,0x00,0x00,0x00,0x00,0x80,0x40,0x30,0x0F,0x00,0x00,0x00,/*")",9*/
+
+0x80,0x80,0x00,0xE0,0x00,0x80,0x80,0x00,0x04,0x04,0x03,0x1F,0x03,0x04,0x04,0x00,/*"*",10*/
+
+0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x3F,0x02,0x02,0x02,0x00,/*"+",11*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0x00,0x00,0x00,0x00,0x00,/*",",12*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,/*"-",13*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,/*".",14*/
+
+0x00,0x00,0x00,0x00,0x00,0xC0,0x30,0x08,0x00,0xC0,0x30,0x0C,0x03,0x00,0x00,0x00,/*"/",15*/
+
+//0x00,0xC0,0x20,0x10,0x10,0x20,0xC0,0x00,0x00,0x1F,0x20,0x40,0x40,0x20,0x1F,0x00,/*"0",16*/
+0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x0F,0x10,0x20,0x20,0x10,0x0F,0x00,
+
+0x00,0x20,0x20,0xF0,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x7F,0x40,0x40,0x00,0x00,/*"1",17*/
+
+0x00,0xE0,0x10,0x10,0x10,0x10,0xE0,0x00,0x00,0x60,0x50,0x48,0x44,0x43,0x60,0x00,/*"2",18*/
+
+0x00,0x60,0x10,0x10,0x10,0x90,0x60,0x00,0x00,0x30,0x40,0x41,0x41,0x22,0x1C,0x00,/*"3",19*/
+
+0x00,0x00,0x80,0x40,0x20,0xF0,0x00,0x00,0x00,0x0E,0x09,0x48,0x48,0x7F,0x48,0x00,/*"4",20*/
+
+0x00,0xF0,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x33,0x42,0x41,0x41,0x22,0x1C,0x00,/*"5",21*/
+
+0x00,0xC0,0x20,0x10,0x10,0x30,0x00,0x00,0x00,0x1F,0x22,0x41,0x41,0x22,0x1C,0x00,/*"6",22*/
+
+0x00,0x70,0x10,0x10,0x90,0x70,0x10,0x00,0x00,0x00,0x00,0x7E,0x01,0x00,0x00,0x00,/*"7",23*/
+
+0x00,0xE0,0x10,0x10,0x10,0x10,0xE0,0x00,0x00,0x38,0x45,0x42,0x42,0x45,0x38,0x00,/*"8",24*/
+
+0x00,0xC0,0x20,0x10,0x10,0x20,0xC0,0x00,0x00,0x01,0x62,0x44,0x44,0x22,0x1F,0x00,/*"9",25*/
+
+0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x61,0x00,0x00,0x00,/*":",26*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0x00,0x00,0x00,/*";",27*/
+
+0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x00,0x00,0x02,0x05,0x08,0x10,0x20,0x40,0x00,/*"<",28*/
+
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x00,/*"=",29*/
+
+0x00,0x10,0x20,0x40,0x80,0x00,0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x05,0x02,0x00,/*">",30*/
+
+0x00,0xE0,0x90,0x10,0x10,0x10,0xE0,0x00,0x00,0x00,0x00,0x60,0x6C,0x02,0x01,0x00,/*"?",31*/
+
+0x80,0x60,0x90,0x50,0xD0,0x20,0xC0,0x00,0x0F,0x30,0x4F,0x48,0x47,0x28,0x17,0x00,/*"@",32*/
+
+0x00,0x00,0x80,0x70,0xC0,0x00,0x00,0x00,0x40,0x78,0x47,0x04,0x05,0x4E,0x70,0x40,/*"A",33*/
+
+0x10,0xF0,0x10,0x10,0x10,0xE0,0x00,0x00,0x40,0x7F,0x41,0x41,0x41,0x22,0x1C,0x00,/*"B",34*/
+
+0x80,0x60,0x10,0x10,0x10,0x10,0x70,0x00,0x0F,0x30,0x40,0x40,0x40,0x20,0x10,0x00,/*"C",35*/
+
+0x10,0xF0,0x10,0x10,0x10,0x20,0xC0,0x00,0x40,0x7F,0x40,0x40,0x40,0x20,0x1F,0x00,/*"D",36*/
+
+0x10,0xF0,0x10,0x10,0xD0,0x10,0x20,0x00,0x40,0x7F,0x41,0x41,0x47,0x40,0x30,0x00,/*"E",37*/
+
+0x10,0xF0,0x10,0x10,0xD0,0x10,0x20,0x00,0x40,0x7F,0x41,0x01,0x07,0x00,0x00,0x00,/*"F",38*/
+
+0x80,0x60,0x10,0x10,0x10,0x70,0x00,0x00,0x0F,0x30,0x40,0x40,0x44,0x3C,0x04,0x00,/*"G",39*/
+
+0x10,0xF0,0x10,0x00,0x00,0x10,0xF0,0x10,0x40,0x7F,0x42,0x02,0x02,0x42,0x7F,0x40,/*"H",40*/
+
+0x00,0x10,0x10,0xF0,0x10,0x10,0x00,0x00,0x00,0x40,0x40,0x7F,0x40,0x40,0x00,0x00,/*"I",41*/
+
+0x00,0x00,0x10,0x10,0xF0,0x10,0x10,0x00,0x80,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,/*"J",42*/
+
+0x10,0xF0,0x10,0x80,0x50,0x30,0x10,0x00,0x40,0x7F,0x41,0x03,0x4C,0x70,0x40,0x00,/*"K",43*/
+
+0x10,0xF0,0x10,0x00,0x00,0x00,0x00,0x00,0x40,0x7F,0x40,0x40,0x40,0x40,0x60,0x00,/*"L",44*/
+
+0x10,0xF0,0xF0,0x00,0xF0,0xF0,0x10,0x00,0x40,0x7F,0x01,0x7E,0x01,0x7F,0x40,0x00,/*"M",45*/
+
+0x10,0xF0,0x60,0x80,0x00,0x10,0xF0,0x10,0x40,0x7F,0x40,0x01,0x0E,0x30,0x7F,0x00,/*"N",46*/
+
+0xC0,0x20,0x10,0x10,0x10,0x20,0xC0,0x00,0x1F,0x20,0x40,0x40,0x40,0x20,0x1F,0x00,/*"O",47*/
+
+0x10,0xF0,0x10,0x10,0x10,0x10,0xE0,0x00,0x40,0x7F,0x42,0x02,0x02,0x02,0x01,0x00,/*"P",48*/
+
+0xC0,0x20,0x10,0x10,0x10,0x20,0xC0,0x00,0x1F,0x30,0x48,0x48,0x70,0xA0,0x9F,0x00,/*"Q",49*/
+
+0x10,0xF0,0x10,0x10,0x10,0x10,0xE0,0x00,0x40,0x7F,0x41,0x01,0x07,0x19,0x60,0x40,/*"R",50*/
+
+0x00,0xE0,0x10,0x10,0x10,0x10,0x70,0x00,0x00,0x70,0x41,0x42,0x42,0x44,0x38,0x00,/*"S",51*/
+
+0x30,0x10,0x10,0xF0,0x10,0x10,0x30,0x00,0x00,0x00,0x40,0x7F,0x40,0x00,0x00,0x00,/*"T",52*/
+
+0x10,0xF0,0x10,0x00,0x00,0x10,0xF0,0x10,0x00,0x3F,0x40,0x40,0x40,0x40,0x3F,0x00,/*"U",53*/
+
+0x10,0xF0,0x10,0x00,0x00,0x90,0x70,0x10,0x00,0x00,0x0F,0x70,0x1C,0x03,0x00,0x00,/*"V",54*/
+
+0xF0,0x10,0x00,0xF0,0x00,0x10,0xF0,0x00,0x07,0x78,0x0E,0x01,0x0E,0x78,0x07,0x00,/*"W",55*/
+
+0x10,0x30,0xD0,0x00,0x00,0xD0,0x30,0x10,0x40,0x60,0x58,0x07,0x07,0x58,0x60,0x40,/*"X",56*/
+
+0x10,0x70,0x90,0x00,0x90,0x70,0x10,0x00,0x00,0x00,0x41,0x7E,0x41,0x00,0x00,0x00,/*"Y",57*/
+
+0x20,0x10,0x10,0x10,0x90,0x70,0x10,0x00,0x40,0x70,0x4C,0x42,0x41,0x40,0x30,0x00,/*"Z",58*/
+
+0x00,0x00,0x00,0xFC,0x04,0x04,0x04,0x00,0x00,0x00,0x00,0xFF,0x80,0x80,0x80,0x00,/*"[",59*/
+
+0x00,0x18,0x60,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x70,0x80,0x00,/*"\",60*/
+
+0x00,0x04,0x04,0x04,0xFC,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0xFF,0x00,0x00,0x00,/*"]",61*/
+
+0x00,0x00,0x08,0x04,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"^",62*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"_",63*/
+
+0x00,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"`",64*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x49,0x45,0x45,0x45,0x7E,0x40,/*"a",65*/
+
+0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x22,0x41,0x41,0x22,0x1C,0x00,/*"b",66*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x22,0x41,0x41,0x41,0x22,0x00,/*"c",67*/
+
+0x00,0x00,0x00,0x00,0x00,0x10,0xF0,0x00,0x00,0x1C,0x22,0x41,0x41,0x21,0x7F,0x40,/*"d",68*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x45,0x45,0x45,0x45,0x26,0x00,/*"e",69*/
+
+0x00,0x00,0x00,0xE0,0x10,0x10,0x10,0x30,0x00,0x41,0x41,0x7F,0x41,0x41,0x01,0x00,/*"f",70*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x29,0x29,0x29,0x27,0xC1,0x00,/*"g",71*/
+
+0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7F,0x42,0x01,0x01,0x41,0x7E,0x40,/*"h",72*/
+
+0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x7F,0x40,0x40,0x00,0x00,/*"i",73*/
+
+0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x80,0x00,0x01,0x01,0xFF,0x00,0x00,/*"j",74*/
+
+0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7F,0x48,0x04,0x5B,0x61,0x41,0x00,/*"k",75*/
+
+0x00,0x10,0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x7F,0x40,0x40,0x00,0x00,/*"l",76*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x7F,0x41,0x01,0x7F,0x41,0x01,0x7E,/*"m",77*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x7F,0x42,0x01,0x01,0x41,0x7E,0x40,/*"n",78*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x41,0x41,0x41,0x41,0x3E,0x00,/*"o",79*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x42,0x41,0x41,0x22,0x1C,0x00,/*"p",80*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x22,0x41,0x41,0x41,0xFF,0x00,/*"q",81*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x7F,0x42,0x41,0x01,0x03,0x00,/*"r",82*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x49,0x49,0x49,0x49,0x33,0x00,/*"s",83*/
+
+0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x3F,0x41,0x41,0x00,0x00,/*"t",84*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3F,0x40,0x40,0x40,0x21,0x7F,0x40,/*"u",85*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x1D,0x60,0x10,0x0D,0x03,0x01,/*"v",86*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x61,0x18,0x07,0x18,0x61,0x1F,0x01,/*"w",87*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x63,0x5C,0x1D,0x63,0x41,0x00,/*"x",88*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x1D,0xE0,0x30,0x0D,0x03,0x01,/*"y",89*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x61,0x59,0x45,0x43,0x61,0x00,/*"z",90*/
+
+0x00,0x00,0x00,0x00,0x00,0xF8,0x04,0x04,0x00,0x00,0x00,0x00,0x01,0x7E,0x80,0x80,/*"{",91*/
+
+0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,/*"|",92*/
+
+0x00,0x04,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x7E,0x01,0x00,0x00,0x00,/*"}",93*/
+
+0x00,0x0C,0x02,0x02,0x04,0x04,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"~",94*/
+
+};
+
+/*************************** oC ***************************/
+const uint8_t logo_temp[] =
+{
+	0x06,0x09,0x09,0xE6,0xF8,0x0C,0x04,0x02,0x02,0x02,0x02,0x02,0x04,0x1E,0x00,0x00,
+	0x00,0x00,0x00,0x07,0x1F,0x30,0x20,0x40,0x40,0x40,0x40,0x40,0x20,0x10,0x00,0x00/*"℃",0*/
+};
+
+/*************************** 32*16 Charactors Lib ***************************/
+const uint8_t F32x16[] =
+{
+		/* 0x20 [ ] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		/* 0x21 [!] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+			0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x07,0xFC,0x00,0xC0,0x07,0xFF,0xE1,0xE0,
+			0x07,0xF0,0xC1,0xE0,0x00,0x00,0x30,0xC0,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
+			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x22 ["] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x20,0x00,0x00,0x03,0xC0,0x00,0x00,
+			0x07,0xC0,0x00,0x00,0x1F,0x30,0x00,0x00,0x1E,0x0C,0x00,0x00,0x1C,0x23,0x00,0x00,
+			0x01,0xC0,0xC0,0x00,0x07,0x80,0x30,0x00,0x1F,0x00,0x0C,0x00,0x1E,0x00,0x03,0x00,
+			0x1C,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x23 [#] */
+			0xC0,0x00,0x00,0x00,0x30,0x18,0x0C,0x00,0x0C,0x18,0x0C,0x00,0x03,0x18,0x0F,0xE0,
+			0x00,0xDF,0xFC,0x00,0x03,0xF8,0x0C,0x00,0x00,0x1C,0x0C,0x00,0x00,0x1B,0x0C,0x00,
+			0x00,0x18,0xCC,0x00,0x00,0x18,0x3C,0x00,0x00,0x18,0x0F,0xE0,0x00,0x1F,0xFF,0x00,
+			0x03,0xF8,0x0C,0xC0,0x00,0x18,0x0C,0x30,0x00,0x18,0x0C,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x24 [$] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x07,0x80,0x03,0x78,0x07,0xC0,
+			0x00,0xFC,0x06,0x40,0x01,0x3E,0x00,0x20,0x03,0x0F,0x00,0x20,0x02,0x03,0x80,0x20,
+			0x0F,0xFF,0xFF,0xFC,0x02,0x01,0xF0,0x20,0x02,0x00,0xEC,0x60,0x01,0x30,0x73,0x40,
+			0x01,0xF0,0x3F,0xC0,0x00,0xF0,0x1F,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x25 [%] */
+			0xC0,0xFE,0x00,0x00,0x31,0xFF,0x00,0x00,0x0F,0x01,0x80,0x00,0x03,0x00,0x80,0x60,
+			0x03,0xC1,0x81,0xC0,0x01,0xFF,0x07,0x00,0x00,0xFE,0x18,0x00,0x00,0x03,0xE0,0x00,
+			0x00,0x03,0xFF,0x00,0x00,0x0C,0xFF,0xC0,0x00,0x71,0x8C,0x60,0x01,0xC1,0x03,0x20,
+			0x03,0x01,0x80,0xE0,0x00,0x00,0xFF,0xF0,0x00,0x00,0x3F,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x26 [&] */
+			0xC0,0x00,0x1F,0x00,0x30,0x00,0x7F,0xC0,0x0C,0xFC,0xC0,0xC0,0x03,0xFF,0x80,0x60,
+			0x03,0xC3,0xE0,0x20,0x02,0x32,0x78,0x20,0x02,0x0E,0x1E,0x20,0x03,0xFF,0x07,0x40,
+			0x01,0xF0,0xC3,0x80,0x00,0x01,0x33,0xC0,0x00,0x01,0x1C,0x60,0x00,0x01,0xE3,0x20,
+			0x00,0x01,0x00,0xE0,0x00,0x01,0x00,0x70,0x00,0x00,0x01,0x8C,0x00,0x00,0x00,0x03,
+		/* 0x27 ['] */
+			0xC0,0x00,0x00,0x00,0x30,0x20,0x00,0x00,0x1C,0x60,0x00,0x00,0x1F,0x40,0x00,0x00,
+			0x1F,0xC0,0x00,0x00,0x0F,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,
+			0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
+			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x28 [(] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+			0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x07,0xF8,0x00,
+			0x00,0x3F,0xFF,0x00,0x00,0x78,0x37,0xC0,0x01,0xC0,0x0C,0xE0,0x03,0x00,0x03,0x30,
+			0x04,0x00,0x00,0xC8,0x08,0x00,0x00,0x34,0x10,0x00,0x00,0x0E,0x00,0x00,0x00,0x03,
+		/* 0x29 [)] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x02,0x0C,0x00,0x00,0x04,0x07,0x00,0x00,0x08,
+			0x03,0xC0,0x00,0x30,0x01,0xF0,0x00,0xE0,0x00,0x7C,0x07,0xC0,0x00,0x3F,0xFF,0x00,
+			0x00,0x07,0xF8,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
+			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x2A [*] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x0C,0x18,0x00,0x03,0x0E,0x38,0x00,
+			0x00,0xCE,0x38,0x00,0x00,0x36,0x30,0x00,0x00,0x0F,0x60,0x00,0x00,0x63,0x43,0x80,
+			0x00,0xFF,0xFF,0x80,0x00,0x61,0x73,0x00,0x00,0x03,0x6C,0x00,0x00,0x06,0x33,0x00,
+			0x00,0x0E,0x38,0xC0,0x00,0x0E,0x38,0x30,0x00,0x0C,0x18,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x2B [+] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x80,0x00,0x03,0x00,0x80,0x00,
+			0x00,0xC0,0x80,0x00,0x00,0x30,0x80,0x00,0x00,0x0C,0x80,0x00,0x00,0x03,0x80,0x00,
+			0x00,0x7F,0xFF,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,0x83,0x00,
+			0x00,0x00,0x80,0xC0,0x00,0x00,0x80,0x30,0x00,0x00,0x80,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x2C [,] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x01,0x0C,0x00,0x00,0xE3,0x03,0x00,0x00,0xE2,
+			0x00,0xC0,0x00,0xFC,0x00,0x30,0x00,0x78,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,
+			0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
+			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x2D [-] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x80,0x00,0x0C,0x00,0x80,0x00,0x03,0x00,0x80,0x00,
+			0x00,0xC0,0x80,0x00,0x00,0x30,0x80,0x00,0x00,0x0C,0x80,0x00,0x00,0x03,0x80,0x00,
+			0x00,0x00,0xC0,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,0x83,0x00,
+			0x00,0x00,0x80,0xC0,0x00,0x00,0x80,0x30,0x00,0x00,0x80,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x2E [.] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x03,0x00,0x01,0xE0,
+			0x00,0xC0,0x01,0xE0,0x00,0x30,0x00,0xC0,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,0x00,
+			0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,0x00,
+			0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x2F [/] */
+			0xC0,0x00,0x00,0x00,0x30,0x00,0x00,0x0C,0x0C,0x00,0x00,0x38,0x03,0x00,0x00,0xE0,
+			0x00,0xC0,0x03,0x80,0x00,0x30,0x0E,0x00,0x00,0x0C,0x38,0x00,0x00,0x03,0xE0,0x00,
+			0x00,0x03,0xC0,0x00,0x00,0x0E,0x30,0x00,0x00,0x38,0x0C,0x00,0x00,0xE0,0x03,0x00,
+			0x03,0x80,0x00,0xC0,0x0E,0x00,0x00,0x30,0x18,0x00,0x00,0x0C,0x00,0x00,0x00,0x03,
+		/* 0x30 [0] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0xE0,0xFC,0x1E,0x03,0x01,0x00,0x00,0x00,0x01,0x03,0x0E,0xFC,0xE0,0x00,
+			0x00,0x00,0x3F,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,
+			0x00,0x00,0x00,0x01,0x03,0x06,0x0C,0x08,0x08,0x08,0x0C,0x06,0x03,0x01,0x00,0x00,/*"0",0*/
+		/* 0x31 [1] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x01,0x01,0x01,0x01,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x04,0x04,0x04,0x06,0x07,0x07,0x06,0x04,0x04,0x04,0x00,0x00,0x00,/*"1",1*/
+		/* 0x32 [2] */
+			0x00,0x00,0x00,0x00,0x80,0x40,0x40,0x40,0x40,0x40,0xC0,0x80,0x80,0x00,0x00,0x00,
+			0x00,0x00,0x1E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x7F,0x3E,0x00,0x00,
+			0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01,0x00,0x00,0xE0,0x00,0x00,
+			0x00,0x00,0x07,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x07,0x01,0x00,0x00,/*"2",2*/
+		/* 0x33 [3] */
+			0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x40,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x0F,0x0F,0x00,0x00,0x80,0x80,0x80,0xC0,0x61,0x3F,0x1E,0x00,0x00,0x00,
+			0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0xFE,0x78,0x00,0x00,
+			0x00,0x00,0x01,0x03,0x02,0x04,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,0x00,/*"3",3*/
+		/* 0x34 [4] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x80,0x60,0x30,0x0C,0x02,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
+			0x00,0x10,0x1C,0x12,0x11,0x10,0x10,0x10,0x10,0xFF,0xFF,0xFF,0x10,0x10,0x10,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x0F,0x0F,0x0F,0x08,0x08,0x08,0x00,/*"4",4*/
+		/* 0x35 [5] */
+			0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,
+			0x00,0x00,0x00,0xF8,0x87,0x40,0x20,0x20,0x20,0x20,0x60,0xC0,0x80,0x00,0x00,0x00,
+			0x00,0x00,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x7E,0x00,0x00,
+			0x00,0x00,0x01,0x02,0x04,0x04,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,0x00,/*"5",5*/
+		/* 0x36 [6] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0x40,0x40,0x40,0x40,0x80,0x00,0x00,0x00,
+			0x00,0x00,0xE0,0xFC,0x0E,0x81,0x80,0x40,0x40,0x40,0x40,0xC0,0x83,0x03,0x00,0x00,
+			0x00,0x00,0x3F,0xFF,0xC3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x7E,0x00,
+			0x00,0x00,0x00,0x00,0x01,0x03,0x06,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,/*"6",6*/
+		/* 0x37 [7] */
+			0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,
+			0x00,0x00,0x0F,0x03,0x01,0x00,0x00,0x00,0x80,0x60,0x18,0x06,0x01,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"7",7*/
+		/* 0x38 [8] */
+			0x00,0x00,0x00,0x00,0x80,0xC0,0x40,0x40,0x40,0x40,0xC0,0x80,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x1E,0x3F,0x71,0xE0,0xC0,0x80,0x80,0x80,0x80,0x61,0x3F,0x1E,0x00,0x00,
+			0x00,0xF8,0xFC,0x06,0x03,0x01,0x00,0x01,0x01,0x03,0x07,0x0E,0xFC,0xF8,0x00,0x00,
+			0x00,0x00,0x01,0x03,0x02,0x04,0x04,0x04,0x04,0x04,0x02,0x03,0x01,0x00,0x00,0x00,/*"8",8*/
+		/* 0x39 [9] */
+			0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x40,0x40,0x80,0x00,0x00,0x00,0x00,0x00,
+			0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xFE,0xF8,0x00,0x00,
+			0x00,0x00,0x81,0x83,0x06,0x04,0x04,0x04,0x04,0x02,0x83,0xF1,0x7F,0x0F,0x00,0x00,
+			0x00,0x00,0x03,0x03,0x04,0x04,0x04,0x04,0x06,0x03,0x01,0x00,0x00,0x00,0x00,0x00,/*"9",9*/
+		/* 0x3A [:] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x1E,0x1E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x78,0x78,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*":",0*/
+		/* 0x3B [;] */
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+			0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*";",0*/
+};
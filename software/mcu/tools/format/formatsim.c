@@ -0,0 +1,333 @@
+/*
+ * formatsim.c
+ *
+ * Checks format.c of app_demo against snprintf of the C library, which gives what the sprintf calls it replaced gave:
+ * every emitter, for every width up to a few beyond the longest output and both pads. Format_Uint for every value
+ * below 2^24, the values around each power of ten and random ones - the division by 10 - then Format_Int and
+ * Format_Tenths the same way, including the most negative value; Format_Time for every minute of the day, Format_Date
+ * for every day of the RTC, Format_Hex for random bytes. Each output is checked for its length and for not writing
+ * past its end, a NUL included.
+ *
+ * Last, the text record of the NDEF message, built as FormatTemperatures of main.c does, is compared with the
+ * sprintf("TEMP0%5d...TEMP5%5d\r\n") it replaced for random temperatures, and both are timed on the PC: a guide only,
+ * glibc is not Redlib. The cycles on the board are in probe PROBE_NDEF_TEXT, see tools/probe; the flash printf
+ * took is reported by mapsize.py from a map file.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -O2 -Wall -Wextra -I../../app_demo/inc -o formatsim formatsim.c ../../app_demo/src/format.c
+ *   ./formatsim                   exit status 1 when a check fails
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "format.h"
+
+#define CANARY              '#'
+#define MAX_WIDTH           (FORMAT_TENTHS_SIZE + 3)
+#define DAY_SECONDS         86400u
+#define LAST_DAY            (0xFFFFFFFFu / DAY_SECONDS)
+
+static char sOut[64];
+
+/* Fills the output with the canary, so what an emitter writes beyond its text shows */
+static char *Start(void)
+{
+    memset(sOut, CANARY, sizeof(sOut));
+    return sOut;
+}
+
+/* @a end as returned by the emitter, @a expected as given by snprintf */
+static bool Same(const char *what, const char *end, const char *expected)
+{
+    size_t length = strlen(expected);
+
+    if ((end != sOut + length) || memcmp(sOut, expected, length) || (sOut[length] != CANARY)) {
+        printf("  %s: \"%.*s\" instead of \"%s\"\n", what, (int)((end > sOut) ? end - sOut : 0), sOut, expected);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckUint(uint32_t value)
+{
+    char expected[32];
+    char what[64];
+    uint8_t width;
+
+    for (width = 0; width <= MAX_WIDTH; width++) {
+        snprintf(expected, sizeof(expected), "%*u", width, value);
+        snprintf(what, sizeof(what), "Format_Uint(%u, %u, ' ')", value, width);
+        if (!Same(what, Format_Uint(Start(), value, width, ' '), expected)) {
+            return false;
+        }
+        snprintf(expected, sizeof(expected), "%0*u", width, value);
+        snprintf(what, sizeof(what), "Format_Uint(%u, %u, '0')", value, width);
+        if (!Same(what, Format_Uint(Start(), value, width, '0'), expected)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CheckInt(int32_t value)
+{
+    char expected[32];
+    char what[64];
+    uint8_t width;
+
+    for (width = 0; width <= MAX_WIDTH; width++) {
+        snprintf(expected, sizeof(expected), "%*d", width, value);
+        snprintf(what, sizeof(what), "Format_Int(%d, %u, ' ')", value, width);
+        if (!Same(what, Format_Int(Start(), value, width, ' '), expected)) {
+            return false;
+        }
+        snprintf(expected, sizeof(expected), "%0*d", width, value);
+        snprintf(what, sizeof(what), "Format_Int(%d, %u, '0')", value, width);
+        if (!Same(what, Format_Int(Start(), value, width, '0'), expected)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* As clockface.c and graph.c did: "%s%d.%d" of the sign and the magnitude */
+static bool CheckTenths(int32_t tenths)
+{
+    uint32_t magnitude = (tenths < 0) ? 0u - (uint32_t)tenths : (uint32_t)tenths;
+    char text[32];
+    char expected[32];
+    char what[64];
+    uint8_t width;
+
+    snprintf(text, sizeof(text), "%s%u.%u", (tenths < 0) ? "-" : "", magnitude / 10, magnitude % 10);
+    for (width = 0; width <= MAX_WIDTH; width++) {
+        snprintf(expected, sizeof(expected), "%*s", width, text);
+        snprintf(what, sizeof(what), "Format_Tenths(%d, %u)", tenths, width);
+        if (!Same(what, Format_Tenths(Start(), tenths, width), expected)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t sRandom = 12345;
+
+static uint32_t Random(void)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+    return sRandom ^ (sRandom >> 16);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/* Every value below 2^24, and around each power of ten; the widths of a few */
+static bool CheckNumbers(void)
+{
+    uint32_t power;
+    uint32_t value;
+    int32_t delta;
+    char expected[16];
+    int n;
+
+    for (value = 0; value < (1u << 24); value++) {
+        snprintf(expected, sizeof(expected), "%u", value);
+        if (!Same("Format_Uint", Format_Uint(Start(), value, 0, ' '), expected)) {
+            return false;
+        }
+    }
+    for (power = 1; power; power = (power <= 0xFFFFFFFFu / 10) ? power * 10 : 0) {
+        for (delta = -11; delta <= 11; delta++) {
+            value = power + (uint32_t)delta;
+            if (!CheckUint(value) || !CheckInt((int32_t)value) || !CheckInt(-(int32_t)value)
+                    || !CheckTenths((int32_t)value) || !CheckTenths(-(int32_t)value)) {
+                return false;
+            }
+        }
+    }
+    if (!CheckUint(0xFFFFFFFFu) || !CheckInt(INT32_MAX) || !CheckInt(INT32_MIN) || !CheckTenths(INT32_MAX)
+            || !CheckTenths(INT32_MIN)) {
+        return false;
+    }
+    for (n = 0; n < 1000000; n++) {
+        value = Random();
+        if (!CheckUint(value) || !CheckInt((int32_t)value) || !CheckTenths((int32_t)value)) {
+            return false;
+        }
+    }
+    printf("%-32s every value below 2^24, around the powers of ten, %d random ones\n", "numbers", n);
+    return true;
+}
+
+/* All temperatures the sensor and the conversion to Fahrenheit can give, and more */
+static bool CheckTemperatures(void)
+{
+    int32_t tenths;
+
+    for (tenths = -10000; tenths <= 10000; tenths++) {
+        if (!CheckTenths(tenths) || !CheckInt(tenths)) {
+            return false;
+        }
+    }
+    printf("%-32s every tenth from -1000.0 up to 1000.0\n", "temperatures");
+    return true;
+}
+
+static bool CheckTimes(void)
+{
+    char expected[16];
+    uint8_t hours;
+    uint8_t minutes;
+
+    for (hours = 0; hours < 24; hours++) {
+        for (minutes = 0; minutes < 60; minutes++) {
+            snprintf(expected, sizeof(expected), "%02u:%02u", hours, minutes);
+            if (!Same("Format_Time", Format_Time(Start(), hours, minutes, ':'), expected)) {
+                return false;
+            }
+            expected[2] = ' ';
+            if (!Same("Format_Time", Format_Time(Start(), hours, minutes, ' '), expected)) {
+                return false;
+            }
+        }
+    }
+    printf("%-32s every minute of the day, with and without the colon\n", "times");
+    return true;
+}
+
+/* As clockface.c did: "%d-%02d-%02d" */
+static bool CheckDates(void)
+{
+    char expected[32];
+    time_t t;
+    struct tm tm;
+    uint32_t day;
+
+    for (day = 0; day <= LAST_DAY; day++) {
+        t = (time_t)day * DAY_SECONDS;
+        gmtime_r(&t, &tm);
+        snprintf(expected, sizeof(expected), "%d-%02d-%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
+        if (!Same("Format_Date", Format_Date(Start(), (uint32_t)tm.tm_year + 1900, (uint8_t)(tm.tm_mon + 1),
+                (uint8_t)tm.tm_mday), expected)) {
+            return false;
+        }
+    }
+    printf("%-32s every day of the RTC, 1970-01-01 up to %s\n", "dates", expected);
+    return true;
+}
+
+static bool CheckHex(void)
+{
+    uint8_t bytes[16];
+    char expected[40];
+    uint8_t count;
+    int n;
+    int i;
+
+    for (n = 0; n < 100000; n++) {
+        count = (uint8_t)(Random() % (sizeof(bytes) + 1));
+        for (i = 0; i < count; i++) {
+            bytes[i] = (uint8_t)Random();
+            snprintf(&expected[2 * i], 3, "%02X", bytes[i]);
+        }
+        expected[2 * count] = '\0';
+        if (!Same("Format_Hex", Format_Hex(Start(), bytes, count), expected)) {
+            return false;
+        }
+    }
+    printf("%-32s %d random UIDs of up to 16 bytes\n", "hex", n);
+    return true;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static uint32_t sTemperatures[6];
+
+/* FormatTemperatures of main.c */
+static int ByFormat(char *text)
+{
+    char *p = text;
+    uint8_t i;
+
+    for (i = 0; i < 6; i++) {
+        *p++ = 'T';
+        *p++ = 'E';
+        *p++ = 'M';
+        *p++ = 'P';
+        *p++ = (char)('0' + i);
+        p = Format_Int(p, (int32_t)sTemperatures[i], 5, ' ');
+    }
+    *p++ = '\r';
+    *p++ = '\n';
+    *p = '\0';
+    return (int)(p - text);
+}
+
+/* The sprintf it replaced */
+static int BySprintf(char *text)
+{
+    sprintf(text, "TEMP0%5dTEMP1%5dTEMP2%5dTEMP3%5dTEMP4%5dTEMP5%5d\r\n", (int)sTemperatures[0], (int)sTemperatures[1],
+            (int)sTemperatures[2], (int)sTemperatures[3], (int)sTemperatures[4], (int)sTemperatures[5]);
+    return (int)strlen(text);
+}
+
+static double Seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Nanoseconds per text on this PC */
+static double Time(int (*format)(char *), uint32_t calls)
+{
+    static char text[128];
+    volatile int length = 0;
+    double start = Seconds();
+    uint32_t n;
+
+    for (n = 0; n < calls; n++) {
+        sTemperatures[n % 6] = (uint32_t)((int32_t)(Random() % 1251) - 400);
+        length += format(text);
+    }
+    (void)length;
+    return (Seconds() - start) * 1e9 / calls;
+}
+
+static bool CheckRecord(void)
+{
+    char expected[128];
+    char text[128];
+    int n;
+    int i;
+
+    for (n = 0; n < 100000; n++) {
+        for (i = 0; i < 6; i++) {
+            sTemperatures[i] = (uint32_t)((int32_t)(Random() % 1251) - 400);
+        }
+        if ((ByFormat(text) != BySprintf(expected)) || strcmp(text, expected)) {
+            printf("  record: \"%s\" instead of \"%s\"\n", text, expected);
+            return false;
+        }
+    }
+    printf("%-32s %d random records\n", "NDEF text", n);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    ok &= CheckNumbers();
+    ok &= CheckTemperatures();
+    ok &= CheckTimes();
+    ok &= CheckDates();
+    ok &= CheckHex();
+    ok &= CheckRecord();
+
+    printf("%-32s %.1f ns per text, the sprintf it replaced %.1f ns\n", "time on this PC", Time(ByFormat, 10000000),
+           Time(BySprintf, 10000000));
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+Flash taken by printf, from the map file of a link (app_demo/Debug/app_demo.map).
+
+The first part of the map tells, for each archive member, which file and symbol made the linker include it. Starting
+from the members included for a function of the printf family, every member first included by one of those is
+counted: __vfprintf, the floating point of fp_display and the double helpers, malloc, the stdio buffers, the
+semihosting writes. The size of each is what the memory map shows linked of it, unused sections being left out by
+--gc-sections. A member may also be used by the application itself once printf is gone - the map only names the
+first reference - so the total is an upper bound; the members are listed for that reason.
+
+Prints the members, their flash and RAM, and the totals; with --baseline, a map of an earlier firmware, the flash
+and RAM of both images.
+
+Usage: mapsize.py [--baseline MAP] [MAP]           MAP is app_demo/Debug/app_demo.map when not given
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOTS = {'printf', 'sprintf', 'snprintf', 'vprintf', 'vsprintf', 'vsnprintf', 'fprintf', 'vfprintf', 'puts', 'putchar'}
+
+FLASH_END = 0x8000                      # Flash30 on the LPC8N04, and the storage region after _etext
+RAM_START = 0x10000000
+
+# Sections that take memory; the debug information and the comments do not
+ALLOCATED = ('.text', '.rodata', '.data', '.bss', '.noinit', '.ARM.exidx', '.ARM.extab', 'COMMON')
+
+MEMBER = re.compile(r'^(\S.*\((\S+\.o)\))$')
+REFERENCE = re.compile(r'^\s+(\S.*?)\s+\((\S+)\)$')
+SECTION = re.compile(r'^ (\.\S+|COMMON)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+NAME = re.compile(r'^ (\.\S+|COMMON)$')
+OUTPUT = re.compile(r'^(\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)')
+
+
+def read(path):
+    with open(path, errors='replace') as f:
+        return f.read().splitlines()
+
+
+def member_name(path):
+    """libcr_c.a(printf.o) of a full archive path"""
+    return re.sub(r'^.*[\\/]', '', path)
+
+
+def inclusions(lines):
+    """Member -> (referring file, symbol), from the first part of the map"""
+    result = {}
+    member = None
+    for line in lines:
+        if line.startswith('Discarded input sections') or line.startswith('Memory Configuration'):
+            break
+        m = MEMBER.match(line)
+        if m:
+            member = member_name(m.group(1))
+            continue
+        m = REFERENCE.match(line)
+        if m and member:
+            result[member] = (member_name(m.group(1)), m.group(2))
+            member = None
+    return result
+
+
+def sections(lines):
+    """(section, address, size, file) of each input section linked, from the memory map"""
+    result = []
+    start = next((n for n, line in enumerate(lines) if line.startswith('Linker script and memory map')), len(lines))
+    name = None
+    for line in lines[start:]:
+        m = NAME.match(line)
+        if m:
+            name = m.group(1)
+            continue
+        m = SECTION.match(line)
+        if m and (m.group(1) or name):
+            size = int(m.group(3), 16)
+            if size and not m.group(4).startswith('0x'):
+                result.append((m.group(1) or name, int(m.group(2), 16), size, member_name(m.group(4))))
+        name = None
+    return result
+
+
+def usage(section, address):
+    """(flash, ram) bytes of a section: initialized data takes both"""
+    if not section.startswith(ALLOCATED):
+        return 0, 0
+    if address < FLASH_END:
+        return 1, 0
+    if address >= RAM_START:
+        if section.startswith('.data'):
+            return 1, 1
+        return 0, 1
+    return 0, 0
+
+
+def totals(linked, only=None):
+    """file -> [flash, ram]"""
+    result = {}
+    for section, address, size, name in linked:
+        if only is not None and name not in only:
+            continue
+        flash, ram = usage(section, address)
+        entry = result.setdefault(name, [0, 0])
+        entry[0] += flash * size
+        entry[1] += ram * size
+    return result
+
+
+def printf_members(included):
+    members = {m for m, (_, symbol) in included.items() if symbol in ROOTS}
+    grown = True
+    while grown:
+        grown = False
+        for member, (referrer, _) in included.items():
+            if member not in members and referrer in members:
+                members.add(member)
+                grown = True
+    return members
+
+
+def image(lines):
+    """(flash, ram) bytes of the output sections, the padding between the input sections included"""
+    flash = ram = 0
+    for line in lines:
+        m = OUTPUT.match(line)
+        if m:
+            f, r = usage(m.group(1), int(m.group(2), 16))
+            flash += f * int(m.group(3), 16)
+            ram += r * int(m.group(3), 16)
+    return flash, ram
+
+
+def main():
+    default = os.path.join(os.path.dirname(__file__), '..', '..', 'app_demo', 'Debug', 'app_demo.map')
+    parser = argparse.ArgumentParser(description='Flash taken by printf, from a map file')
+    parser.add_argument('map', nargs='?', default=default)
+    parser.add_argument('--baseline', help='map of an earlier firmware, to compare the images')
+    args = parser.parse_args()
+
+    lines = read(args.map)
+    included = inclusions(lines)
+    linked = sections(lines)
+    members = printf_members(included)
+    sizes = totals(linked, members)
+
+    if not members:
+        print('printf is not linked')
+    else:
+        print('%-34s %-46s %7s %7s' % ('member', 'included for', 'flash', 'ram'))
+        for member in sorted(members, key=lambda m: -sizes.get(m, [0, 0])[0]):
+            referrer, symbol = included[member]
+            flash, ram = sizes.get(member, [0, 0])
+            print('%-34s %-46s %7d %7d' % (member, '%s (%s)' % (symbol, referrer), flash, ram))
+        print('%-34s %-46s %7d %7d' % ('total, at most', '', sum(s[0] for s in sizes.values()),
+                                       sum(s[1] for s in sizes.values())))
+
+    flash, ram = image(lines)
+    print('%-34s %-46s %7d %7d' % ('image', os.path.normpath(args.map), flash, ram))
+    if args.baseline:
+        base_flash, base_ram = image(read(args.baseline))
+        print('%-34s %-46s %7d %7d' % ('baseline', args.baseline, base_flash, base_ram))
+        print('%-34s %-46s %+7d %+7d' % ('difference', '', flash - base_flash, ram - base_ram))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
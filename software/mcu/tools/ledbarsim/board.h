@@ -0,0 +1,10 @@
+/*
+ * Host stand-in for the board header: the chip of chip.h, nothing more.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include "chip.h"
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Host stand-in for the chip headers, so timer.c and ledbar.c of app_demo build and run on a PC. ledbarsim.c
+ * implements the 32-bit timer and the GPIO port declared here; the RTC, the start logic and the sleep do nothing.
+ */
+
+#ifndef __CHIP_H_
+#define __CHIP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct NSS_GPIO_S {
+    volatile uint32_t DATA[4096];           /* Written at the index of a mask, as the masked access of the IC */
+} NSS_GPIO_T;
+
+extern NSS_GPIO_T g_SimGpio;
+
+#define NSS_GPIO                            (&g_SimGpio)
+#define NSS_TIMER32_0                       NULL
+#define NSS_RTC                             NULL
+
+typedef int RTC_INT_T;
+#define RTC_INT_NONE                        0
+#define RTC_INT_WAKEUP                      1
+#define RTC_WAKEUPCTRL_DISABLE              0
+#define RTC_WAKEUPCTRL_ENABLE               1
+#define RTC_WAKEUPCTRL_AUTO                 2
+#define SYSCON_STARTSOURCE_RTC              0
+
+typedef enum IRQn {
+    RTC_IRQn,
+    CT32B0_IRQn
+} IRQn_Type;
+
+#define Chip_RTC_Init(p)                    ((void)(p))
+#define Chip_RTC_Int_GetRawStatus(p)        ((void)(p), RTC_INT_NONE)
+#define Chip_RTC_Int_ClearRawStatus(p, s)   ((void)(p), (void)(s))
+#define Chip_RTC_Int_SetEnabledMask(p, m)   ((void)(p), (void)(m))
+#define Chip_RTC_Wakeup_GetReload(p)        ((void)(p), 0)
+#define Chip_RTC_Wakeup_SetControl(p, c)    ((void)(p), (void)(c))
+#define Chip_RTC_Wakeup_SetReload(p, s)     ((void)(p), (void)(s))
+#define Chip_SysCon_StartLogic_ClearStatus(s)       ((void)(s))
+#define Chip_SysCon_StartLogic_SetEnabledMask(s)    ((void)(s))
+#define Chip_PMU_PowerMode_EnterSleep()     ((void)0)
+#define __disable_irq()                     ((void)0)
+#define __enable_irq()                      ((void)0)
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+uint32_t Chip_Clock_System_GetClockFreq(void);
+
+void Chip_TIMER32_0_Init(void);
+void Chip_TIMER32_0_DeInit(void);
+void Chip_TIMER_Enable(void *pTMR);
+void Chip_TIMER_Disable(void *pTMR);
+void Chip_TIMER_Reset(void *pTMR);
+void Chip_TIMER_PrescaleSet(void *pTMR, uint32_t prescale);
+uint32_t Chip_TIMER_ReadCount(void *pTMR);
+void Chip_TIMER_SetMatch(void *pTMR, int8_t matchnum, uint32_t matchval);
+void Chip_TIMER_ClearMatch(void *pTMR, int8_t matchnum);
+bool Chip_TIMER_MatchPending(void *pTMR, int8_t matchnum);
+void Chip_TIMER_MatchEnableInt(void *pTMR, int8_t matchnum);
+void Chip_TIMER_MatchDisableInt(void *pTMR, int8_t matchnum);
+
+#endif
@@ -0,0 +1,402 @@
+/*
+ * ledbarsim.c
+ *
+ * Runs ledbar.c and timer.c of app_demo against an emulated 32-bit timer and GPIO port.
+ *
+ * - Levels: the thresholds set as SetLedThresholds of main.c does, for every base and step of the settings and both
+ *   units, against led_light_calc it replaced, for every temperature in tenths from -50.0 up to 150.0 Celsius. Below
+ *   zero the old compare was unsigned and lit all six LEDs; the bar now shows LED0 only, and those are counted apart.
+ * - Masks: each level lights exactly its first LEDs, in one write of DATA[LEDBAR_PINS], and no other pin of the port.
+ * - PWM: every level and duty for a few seconds, the interrupt served up to LATENCY ticks late. The time the pins
+ *   were lit must be the duty within one period, with the number of periods exact - the deadlines are counted from
+ *   the previous one, not from the late interrupt - and two interrupts per period, none at full or no duty. The LED
+ *   time added to the profile must be what the pins were lit. The count of the timer starts just before its wrap.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -O2 -Wall -Wextra -I. -I../../app_demo/inc -o ledbarsim ledbarsim.c ../../app_demo/src/ledbar.c \
+ *       ../../app_demo/src/timer.c
+ *   ./ledbarsim                   exit status 1 when a check fails
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "board.h"
+#include "timer.h"
+#include "event.h"
+#include "profile.h"
+#include "ledbar.h"
+
+#define SECONDS             3
+#define LATENCY             200
+#define MATCHES             4
+
+NSS_GPIO_T g_SimGpio;
+
+static uint32_t sCount;
+static bool sClocked;
+static uint32_t sMatch[MATCHES];
+static uint8_t sEnabled;                // Interrupt enable of each match register
+static uint8_t sPending;
+static bool sIrq;
+static uint32_t sInterrupts;
+static uint64_t sLedTicks;              // Summed by Profile_AddLed
+
+void CT32B0_IRQHandler(void);
+
+/* -------------------------------------------------------------------------------- */
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if (irq == CT32B0_IRQn) {
+        sIrq = true;
+    }
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    if (irq == CT32B0_IRQn) {
+        sIrq = false;
+    }
+}
+
+uint32_t Chip_Clock_System_GetClockFreq(void)
+{
+    return 2000000;
+}
+
+void Chip_TIMER32_0_Init(void) { sClocked = true; }
+void Chip_TIMER32_0_DeInit(void) { sClocked = false; }
+void Chip_TIMER_Enable(void *pTMR) { (void)pTMR; }
+void Chip_TIMER_Disable(void *pTMR) { (void)pTMR; }
+void Chip_TIMER_PrescaleSet(void *pTMR, uint32_t prescale) { (void)pTMR; (void)prescale; }
+
+/* Keeps the count: each run starts it just before the wrap */
+void Chip_TIMER_Reset(void *pTMR) { (void)pTMR; }
+
+uint32_t Chip_TIMER_ReadCount(void *pTMR)
+{
+    (void)pTMR;
+    return sCount;
+}
+
+void Chip_TIMER_SetMatch(void *pTMR, int8_t matchnum, uint32_t matchval)
+{
+    (void)pTMR;
+    sMatch[matchnum] = matchval;
+}
+
+void Chip_TIMER_ClearMatch(void *pTMR, int8_t matchnum)
+{
+    (void)pTMR;
+    sPending &= (uint8_t)~(1u << matchnum);
+}
+
+bool Chip_TIMER_MatchPending(void *pTMR, int8_t matchnum)
+{
+    (void)pTMR;
+    return (sPending >> matchnum) & 1;
+}
+
+void Chip_TIMER_MatchEnableInt(void *pTMR, int8_t matchnum)
+{
+    (void)pTMR;
+    sEnabled |= (uint8_t)(1u << matchnum);
+}
+
+void Chip_TIMER_MatchDisableInt(void *pTMR, int8_t matchnum)
+{
+    (void)pTMR;
+    sEnabled &= (uint8_t)~(1u << matchnum);
+}
+
+bool Event_Post(EVENT_TYPE_T type, int32_t data)
+{
+    (void)type;
+    (void)data;
+    return true;
+}
+
+void Profile_AddLed(uint32_t ticks)
+{
+    sLedTicks += ticks;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static uint32_t sRandom = 12345;
+
+static uint32_t Random(void)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+    return sRandom ^ (sRandom >> 16);
+}
+
+/* The pins lit, as the port drives them */
+static uint32_t Port(void)
+{
+    return g_SimGpio.DATA[LEDBAR_PINS] & LEDBAR_PINS;
+}
+
+/* Every other index of the port must be untouched */
+static bool OnlyMaskedWrites(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < 4096; n++) {
+        if ((n != LEDBAR_PINS) && g_SimGpio.DATA[n]) {
+            printf("  DATA[0x%03X] was written\n", n);
+            return false;
+        }
+    }
+    if (g_SimGpio.DATA[LEDBAR_PINS] & ~(uint32_t)LEDBAR_PINS) {
+        printf("  pins outside LEDBAR_PINS were written: 0x%03X\n", g_SimGpio.DATA[LEDBAR_PINS]);
+        return false;
+    }
+    return true;
+}
+
+static int Lit(uint32_t port)
+{
+    int n = 0;
+
+    for (; port; port &= port - 1) {
+        n++;
+    }
+    return n;
+}
+
+static uint64_t sLit;                   // Ticks times LEDs lit
+static uint32_t sRises;
+
+/* Lets the count run @a ticks, with the pins as they are */
+static void Run(uint32_t ticks)
+{
+    sLit += (uint64_t)ticks * (uint64_t)Lit(Port());
+    sCount += ticks;
+}
+
+/* Lets the count run up to @a end, serving the interrupts of the match registers up to LATENCY ticks late */
+static void RunUntil(uint32_t end)
+{
+    uint32_t next;
+    uint32_t ticks;
+    uint32_t before;
+    int n;
+
+    for (;;) {
+        next = end - sCount;
+        for (n = 0; n < MATCHES; n++) {
+            ticks = sMatch[n] - sCount;
+            if (sIrq && sClocked && ((sEnabled >> n) & 1) && ticks && (ticks <= next)) {
+                next = ticks;
+            }
+        }
+        if (next == end - sCount) {
+            Run(next);
+            return;
+        }
+        Run(next);
+        for (n = 0; n < MATCHES; n++) {
+            if (((sEnabled >> n) & 1) && (sMatch[n] == sCount)) {
+                sPending |= (uint8_t)(1u << n);
+            }
+        }
+        Run(Random() % (LATENCY + 1));
+        before = Port();
+        CT32B0_IRQHandler();
+        sRises += (!before && Port());
+        sInterrupts++;
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/* led_light_calc of main.c before the bar: the level it lit, with its unsigned compares */
+static uint8_t OldLevel(uint32_t value, uint32_t settings, uint8_t unit)
+{
+    uint32_t step;
+    uint32_t base;
+    uint32_t t;
+
+    if (unit == 0) {
+        t = value;
+        base = (((settings >> 16) & 0x00FF) + 20) * 10;
+        step = (((settings >> 8) & 0x00FF) + 1) * 5;
+    }
+    else {
+        t = (value * 18 + 3200) / 10;
+        base = (((settings >> 16) & 0x00FF) + 68) * 10;
+        step = (((settings >> 8) & 0x00FF) + 1) * 10;
+    }
+    if (t <= base - 2 * step) return 1;
+    if (t <= base - 1 * step) return 2;
+    if (t <= base) return 3;
+    if (t <= base + 1 * step) return 4;
+    if (t <= base + 2 * step) return 5;
+    return 6;
+}
+
+/* SetLedThresholds of main.c */
+static void SetThresholds(uint32_t settings, uint8_t unit)
+{
+    int16_t thresholds[LEDBAR_COUNT - 1];
+    int base;
+    int step;
+    int n;
+
+    if (unit == 0) {
+        base = (int)(((settings >> 16) & 0x00FF) + 20) * 10;
+        step = (int)(((settings >> 8) & 0x00FF) + 1) * 5;
+    }
+    else {
+        base = (int)(((settings >> 16) & 0x00FF) + 68) * 10;
+        step = (int)(((settings >> 8) & 0x00FF) + 1) * 10;
+    }
+    for (n = 0; n < LEDBAR_COUNT - 1; n++) {
+        thresholds[n] = (int16_t)(base + (n - 2) * step);
+    }
+    LedBar_SetThresholds(thresholds);
+}
+
+static bool CheckLevels(void)
+{
+    uint32_t settings;
+    uint32_t base;
+    uint32_t step;
+    uint8_t unit;
+    int value;
+    int shown;
+    int fixed = 0;
+    int n = 0;
+    uint8_t expected;
+    uint8_t level;
+
+    for (unit = 0; unit <= 1; unit++) {
+        for (base = 0; base <= 9; base++) {
+            for (step = 0; step <= 3; step++) {
+                settings = 0x5A000000 | (base << 16) | (step << 8);
+                SetThresholds(settings, unit);
+                for (value = -500; value <= 1500; value++) {
+                    shown = (unit == 0) ? value : (value * 18 + 3200) / 10;
+                    level = LedBar_Level(shown);
+                    expected = OldLevel((uint32_t)value, settings, unit);
+                    if (value < 0) {
+                        /* All thresholds are above zero Celsius */
+                        fixed += (expected != 1);
+                        expected = 1;
+                    }
+                    if (level != expected) {
+                        printf("  %d.%d %s, base %u step %u: level %u instead of %u\n", value / 10, abs(value % 10),
+                               unit ? "F" : "C", base, step, level, expected);
+                        return false;
+                    }
+                    n++;
+                }
+            }
+        }
+    }
+    printf("%-24s %d temperatures and settings, %d below zero no longer lit in full\n", "levels", n, fixed);
+    return true;
+}
+
+static bool CheckMasks(void)
+{
+    static const uint32_t pins[LEDBAR_COUNT] = {1 << 0, 1 << 1, 1 << 2, 1 << 6, 1 << 8, 1 << 9};
+    uint32_t expected = 0;
+    uint8_t level;
+
+    memset(&g_SimGpio, 0, sizeof(g_SimGpio));
+    Timer_StartFreeRunning();
+    for (level = 0; level <= LEDBAR_COUNT; level++) {
+        if (level) {
+            expected |= pins[level - 1];
+        }
+        LedBar_Show(level, LEDBAR_DUTY_FULL);
+        if ((Port() != expected) || (LedBar_GetLevel() != level) || !OnlyMaskedWrites()) {
+            printf("  level %u lights 0x%03X instead of 0x%03X\n", level, Port(), expected);
+            return false;
+        }
+    }
+    LedBar_Off();
+    Timer_StopFreeRunning();
+    if (Port() != 0) {
+        printf("  the bar is not off\n");
+        return false;
+    }
+    printf("%-24s every level in one masked write\n", "masks");
+    return true;
+}
+
+static bool CheckPwm(uint8_t level, uint8_t duty)
+{
+    const uint32_t duration = SECONDS * TIMER_TICK_HZ;
+    const uint32_t periods = duration / LEDBAR_PERIOD_US;
+    uint64_t expected = (uint64_t)duration * duty * level / LEDBAR_DUTY_FULL;
+    uint64_t tolerance = (uint64_t)LEDBAR_PERIOD_US * level;
+    uint32_t interrupts;
+    bool partial = (duty != 0) && (duty != LEDBAR_DUTY_FULL);
+
+    memset(&g_SimGpio, 0, sizeof(g_SimGpio));
+    sCount = 0u - duration / 2;
+    sLit = 0;
+    sLedTicks = 0;
+    sInterrupts = 0;
+    sRises = 0;
+    Timer_StartFreeRunning();
+    LedBar_Show(level, duty);
+    RunUntil(sCount + duration);
+    LedBar_Off();
+    interrupts = sInterrupts;
+    RunUntil(sCount + 10 * LEDBAR_PERIOD_US);
+    Timer_StopFreeRunning();
+
+    if ((sLit + tolerance < expected) || (sLit > expected + tolerance)) {
+        printf("  level %u duty %u: lit %llu instead of %llu tick LEDs\n", level, duty, (unsigned long long)sLit,
+               (unsigned long long)expected);
+        return false;
+    }
+    if ((sLedTicks + tolerance < sLit) || (sLedTicks > sLit + tolerance)) {
+        printf("  level %u duty %u: %llu tick LEDs in the profile, %llu lit\n", level, duty,
+               (unsigned long long)sLedTicks, (unsigned long long)sLit);
+        return false;
+    }
+    if (partial ? ((sRises + 1 < periods) || (sRises > periods)) : (sRises != 0)) {
+        printf("  level %u duty %u: %u periods instead of %u\n", level, duty, sRises, periods);
+        return false;
+    }
+    if (partial ? ((interrupts + 2 < 2 * periods) || (interrupts > 2 * periods)) : (interrupts != 0)) {
+        printf("  level %u duty %u: %u interrupts\n", level, duty, interrupts);
+        return false;
+    }
+    if ((sInterrupts != interrupts) || (Port() != 0) || !OnlyMaskedWrites()) {
+        printf("  level %u duty %u: the PWM runs on after LedBar_Off\n", level, duty);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckPwms(void)
+{
+    uint8_t level;
+    uint8_t duty;
+
+    for (level = 1; level <= LEDBAR_COUNT; level++) {
+        for (duty = 0; duty <= LEDBAR_DUTY_FULL; duty++) {
+            if (!CheckPwm(level, duty)) {
+                return false;
+            }
+        }
+    }
+    printf("%-24s every level and duty, %d s each, interrupts up to %d us late\n", "PWM", SECONDS, LATENCY);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    ok &= CheckLevels();
+    ok &= CheckMasks();
+    ok &= CheckPwms();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+/*
+ * Host stand-in for the board and chip headers, so logger.c of app_demo builds and runs on a PC. loggersim.c
+ * implements what is declared here.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NSS_RTC     NULL
+#define NSS_EEPROM  NULL
+
+#define PMU_STATUS_BROWNOUT 0x1
+
+int Chip_RTC_Time_GetValue(void *pRTC);
+void Chip_PMU_SetBODEnabled(bool enable);
+uint32_t Chip_PMU_GetStatus(void);
+void Chip_PMU_SetRetainedData(uint32_t *pData, int offset, int size);
+void Chip_PMU_GetRetainedData(uint32_t *pData, int offset, int size);
+void Chip_PMU_PowerMode_EnterSleep(void);
+void Chip_PMU_PowerMode_EnterDeepPowerDown(bool enableSwitching);
+void Chip_EEPROM_Init(void *pEEPROM);
+void Chip_EEPROM_DeInit(void *pEEPROM);
+
+#define __disable_irq()
+#define __enable_irq()
+
+#endif
@@ -0,0 +1,305 @@
+/*
+ * loggersim.c
+ *
+ * Runs the fast path of logger.c of app_demo for a simulated day of sample wakes, against a model of the time the
+ * chip takes, and counts the EEPROM row programs. The same day is run twice: with the samples staged in the retained
+ * register, and with a brown-out on every wake, which writes each sample on its own as before staging existed.
+ * Every sample must end up in the storage mod, in order, also across a brown-out and the flush of the full wake path.
+ * Logger_GetMean must give the mean of the last samples of the day, Logger_GetLast the last samples themselves.
+ *
+ * The times below are the model, not measurements: the PMU access time is the worst case of pmu_nss.h, the EEPROM
+ * program time and the conversion time are assumptions. Logger_GetLastWake gives the real figures on the board.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -include ../../app_demo/mods/app_sel.h -o loggersim \
+ *       loggersim.c ../../app_demo/src/logger.c
+ *   ./loggersim                   exit status 1 when a check fails
+ */
+#include <stdio.h>
+#include <setjmp.h>
+#include "board.h"
+#include "tmeas/tmeas.h"
+#include "storage/storage.h"
+#include "timer.h"
+#include "logger.h"
+#include "drift.h"
+
+#define WAKES               (24 * 60 * 60 / LOGGER_INTERVAL_SECONDS)
+
+#define PMU_ACCESS_US       100     // Synchronized register access, worst case
+#define CONVERSION_US       2000    // TSEN, 10 bits
+#define EEPROM_OPEN_US      300     // Chip_EEPROM_Init and Storage_Init, no recovery
+#define EEPROM_PROGRAM_US   2500    // One row
+
+static uint32_t sRetained[5];
+static uint32_t sUs;                // Simulated time since the wake-up
+static uint32_t sFreeRunningStart;
+static bool sBrownout;
+static bool sPending;               // A row program is due at Storage_DeInit
+static uint32_t sPrograms;
+static STORAGE_TYPE sStored[WAKES + 1];
+static int sStoredCount;
+static jmp_buf sDeepPowerDown;
+
+/* -------------------------------------------------------------------------------- */
+
+int Chip_RTC_Time_GetValue(void *pRTC)
+{
+    (void)pRTC;
+    return 0;
+}
+
+void Chip_PMU_SetBODEnabled(bool enable)
+{
+    (void)enable;
+    sUs += PMU_ACCESS_US;
+}
+
+uint32_t Chip_PMU_GetStatus(void)
+{
+    sUs += PMU_ACCESS_US;
+    return sBrownout ? PMU_STATUS_BROWNOUT : 0;
+}
+
+void Chip_PMU_SetRetainedData(uint32_t *pData, int offset, int size)
+{
+    int i;
+
+    for (i = 0; i < size; i++) {
+        sRetained[offset + i] = pData[i];
+        sUs += PMU_ACCESS_US;
+    }
+}
+
+void Chip_PMU_GetRetainedData(uint32_t *pData, int offset, int size)
+{
+    int i;
+
+    for (i = 0; i < size; i++) {
+        pData[i] = sRetained[offset + i];
+        sUs += PMU_ACCESS_US;
+    }
+}
+
+void Chip_PMU_PowerMode_EnterSleep(void)
+{
+}
+
+void Chip_PMU_PowerMode_EnterDeepPowerDown(bool enableSwitching)
+{
+    (void)enableSwitching;
+    longjmp(sDeepPowerDown, 1);
+}
+
+void Chip_EEPROM_Init(void *pEEPROM)
+{
+    (void)pEEPROM;
+    sUs += EEPROM_OPEN_US;
+}
+
+void Chip_EEPROM_DeInit(void *pEEPROM)
+{
+    (void)pEEPROM;
+}
+
+void Storage_Init(void)
+{
+}
+
+void Storage_DeInit(void)
+{
+    if (sPending) {
+        sUs += EEPROM_PROGRAM_US;
+        sPrograms++;
+        sPending = false;
+    }
+}
+
+int Storage_Write(STORAGE_TYPE *pSamples, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        sStored[sStoredCount++] = pSamples[i];
+    }
+    /* A handful of 11 bit samples always fits in one row */
+    sPending = true;
+    return n;
+}
+
+int Storage_GetCount(void)
+{
+    return sStoredCount;
+}
+
+static int sReadAt = -1;
+
+bool Storage_Seek(int n)
+{
+    sReadAt = ((n >= 0) && (n < sStoredCount)) ? n : -1;
+    return sReadAt >= 0;
+}
+
+int Storage_Read(STORAGE_TYPE *pSamples, int n)
+{
+    int i;
+
+    for (i = 0; (i < n) && (sReadAt >= 0) && (sReadAt < sStoredCount); i++) {
+        pSamples[i] = sStored[sReadAt++];
+    }
+    return i;
+}
+
+/* Reads the EEPROM row, the retained word and writes both RTCCAL and the retained word */
+void Drift_Apply(int temperature, uint32_t seconds)
+{
+    (void)temperature;
+    (void)seconds;
+    sUs += 3 * PMU_ACCESS_US;
+}
+
+static int sTemperature;
+
+int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool synchronous, uint32_t context)
+{
+    (void)resolution;
+    (void)format;
+    (void)synchronous;
+    (void)context;
+    sUs += CONVERSION_US;
+    /* As TSEN_IRQHandler, while the core sleeps */
+    Logger_TmeasCb(sTemperature);
+    return 0;
+}
+
+void TMeas_Wait(void)
+{
+}
+
+void Timer_StartFreeRunning(void)
+{
+    sFreeRunningStart = sUs;
+}
+
+void Timer_StopFreeRunning(void)
+{
+}
+
+uint32_t Timer_GetFreeRunning(void)
+{
+    return (sUs - sFreeRunningStart) * (TIMER_TICK_HZ / 1000000);
+}
+
+void Timer_StartMeasurementTimeout(int seconds)
+{
+    (void)seconds;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/* Deci-Celsius over the day: below zero at night, to check the sign of the staged samples */
+static int Temperature(int wake)
+{
+    return -80 + ((wake * 7) % 400);
+}
+
+static bool Run(const char *name, bool brownoutAlways, int brownoutAt)
+{
+    uint32_t total = 0;
+    uint32_t longest = 0;
+    uint32_t wakeUs;
+    bool overBudget;
+    bool ok = true;
+    int wake;
+
+    sStoredCount = 0;
+    sPrograms = 0;
+    Logger_Clear();
+    for (wake = 0; wake < WAKES; wake++) {
+        sUs = 0;
+        sTemperature = Temperature(wake);
+        sBrownout = brownoutAlways || (wake == brownoutAt);
+        if (!setjmp(sDeepPowerDown)) {
+            Logger_SampleAndSleep(LOGGER_INTERVAL_SECONDS);
+        }
+        wakeUs = Logger_GetLastWake(&overBudget, NULL, false);
+        total += wakeUs;
+        if (wakeUs > longest) {
+            longest = wakeUs;
+        }
+    }
+    /* A phone: the full wake path writes what is staged */
+    Storage_Init();
+    Logger_Flush();
+    Storage_DeInit();
+
+    if (sStoredCount != WAKES) {
+        printf("  %d samples stored instead of %d\n", sStoredCount, WAKES);
+        ok = false;
+    }
+    for (wake = 0; ok && (wake < WAKES); wake++) {
+        if (sStored[wake] != Temperature(wake)) {
+            printf("  sample %d is %d instead of %d\n", wake, sStored[wake], Temperature(wake));
+            ok = false;
+        }
+    }
+    if (overBudget) {
+        printf("  a sample wake took longer than %d us\n", LOGGER_BUDGET_US);
+        ok = false;
+    }
+    printf("%-32s %3u row programs/day, wake %5u us on average, %5u us at most\n", name, sPrograms,
+           total / WAKES, longest);
+    return ok;
+}
+
+/* The mean of the last 6 hours of the day just run */
+static bool CheckMean(void)
+{
+    int32_t sum = 0;
+    int count = 6 * 60 * 60 / LOGGER_INTERVAL_SECONDS;
+    int mean;
+    int n;
+
+    for (n = sStoredCount - count; n < sStoredCount; n++) {
+        sum += sStored[n];
+    }
+    if (!Logger_GetMean(6 * 60 * 60, &mean) || (mean != (int)(sum / count))) {
+        printf("  the mean of the last 6 hours is wrong\n");
+        return false;
+    }
+    printf("%-32s %d.%d C over the last 6 hours\n", "mean", mean / 10, mean % 10);
+    return true;
+}
+
+/* The samples of the history graph: the last 7 of the day just run, oldest first */
+static bool CheckLast(void)
+{
+    int samples[7];
+    int n;
+
+    if (Logger_GetLast(samples, 7) != 7) {
+        printf("  the last samples are missing\n");
+        return false;
+    }
+    for (n = 0; n < 7; n++) {
+        if (samples[n] != sStored[sStoredCount - 7 + n]) {
+            printf("  last sample %d is wrong\n", n);
+            return false;
+        }
+    }
+    printf("%-32s %d.%d C to %d.%d C\n", "last 7 samples", samples[0] / 10, samples[0] % 10, samples[6] / 10,
+           samples[6] % 10);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    ok &= Run("each sample written", true, -1);
+    ok &= Run("staged, 1 write per 3 wakes", false, -1);
+    ok &= Run("staged, brown-out at wake 40", false, 40);
+    ok &= CheckMean();
+    ok &= CheckLast();
+    return ok ? 0 : 1;
+}
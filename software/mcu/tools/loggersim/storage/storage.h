@@ -0,0 +1,15 @@
+/*
+ * Host stand-in for mods/storage/storage.h, see ../board.h.
+ */
+
+#ifndef __STORAGE_H_
+#define __STORAGE_H_
+
+void Storage_Init(void);
+void Storage_DeInit(void);
+int Storage_GetCount(void);
+int Storage_Write(STORAGE_TYPE * pSamples, int n);
+bool Storage_Seek(int n);
+int Storage_Read(STORAGE_TYPE * pSamples, int n);
+
+#endif
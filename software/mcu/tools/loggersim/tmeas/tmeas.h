@@ -0,0 +1,16 @@
+/*
+ * Host stand-in for mods/tmeas/tmeas.h, see ../board.h.
+ */
+
+#ifndef __TMEAS_H_
+#define __TMEAS_H_
+
+#define TMEAS_ERROR (-1)
+
+typedef enum TSEN_RESOLUTION { TSEN_10BITS = 5 } TSEN_RESOLUTION_T;
+typedef enum TMEAS_FORMAT { TMEAS_FORMAT_CELSIUS } TMEAS_FORMAT_T;
+
+int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool synchronous, uint32_t context);
+void TMeas_Wait(void);
+
+#endif
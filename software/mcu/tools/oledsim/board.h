@@ -0,0 +1,46 @@
+/*
+ * Host stand-in for the board and chip headers, so the display sources of app_demo build and run on a PC against
+ * the emulated panel of ssd1306_emu.c. Only what those sources use is declared; chip_host.c implements it.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+
+/* The real driver types, so descriptors are laid out as on the target */
+#include "i2c_nss.h"
+
+#define NSS_GPIO        NULL
+#define NSS_IOCON       NULL
+#define NSS_EEPROM      NULL
+
+#define IOCON_FUNC_0            0
+#define IOCON_FUNC_1            1
+#define IOCON_RMODE_PULLUP      0
+#define IOCON_RMODE_INACT       0
+
+#define SYSCON_PERIPHERAL_RESET_I2C0    0
+#define I2C0_IRQn                       0
+
+void Chip_GPIO_SetPinState(void *pGPIO, uint8_t port, uint8_t pin, bool setting);
+bool Chip_GPIO_GetPinState(void *pGPIO, uint8_t port, uint8_t pin);
+void Chip_GPIO_SetPinDIROutput(void *pGPIO, uint8_t port, uint8_t pin);
+void Chip_IOCON_SetPinConfig(void *pIOCON, int pin, uint32_t config);
+void Chip_SysCon_Peripheral_DeassertReset(int reset);
+void NVIC_EnableIRQ(int irq);
+void Chip_PMU_PowerMode_EnterSleep(void);
+void __disable_irq(void);
+void __enable_irq(void);
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pBuf, int size);
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pBuf, int size);
+void Chip_EEPROM_Flush(void *pEEPROM, bool wait);
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * chip_host.c
+ *
+ * Host implementation of the chip functions the display sources call. I2C transfers complete immediately, in the
+ * caller's context: a queued transfer calls its callback before Chip_I2C_MasterSubmit returns, and a transfer
+ * submitted from that callback is handled once the callback has returned, just as the interrupt driven driver
+ * would chain them.
+ */
+#include <string.h>
+#include "board.h"
+#include "timer.h"
+#include "clock.h"
+#include "profile.h"
+#include "ssd1306_emu.h"
+
+#define OLED_PWR_PIN    7
+
+static I2C_MXFER_T *sHead;
+static I2C_MXFER_T *sTail;
+static bool sRunning;
+static uint8_t sEeprom[64 * 64];
+
+static I2C_STATUS_T Run(I2C_MXFER_T *pMXfer)
+{
+    uint8_t buf[1024];
+    int len = 0;
+    int seg;
+    I2C_XFER_T *xfer;
+
+    for (seg = 0; seg < pMXfer->segCount; seg++) {
+        xfer = &pMXfer->pXfer[seg];
+        if ((xfer->rxSz != 0) || (len + xfer->txSz > (int)sizeof(buf))) {
+            return I2C_STATUS_BUSERR;
+        }
+        memcpy(&buf[len], xfer->txBuff, (size_t)xfer->txSz);
+        len += xfer->txSz;
+        /* Chained like Chip_I2C_MasterStateHandler: a tx-only segment for the same slave continues the transaction */
+        if ((seg + 1 == pMXfer->segCount) || (pMXfer->pXfer[seg + 1].slaveAddr != xfer->slaveAddr)) {
+            if (!Emu_Transaction(xfer->slaveAddr, buf, len)) {
+                return I2C_STATUS_NAK;
+            }
+            len = 0;
+        }
+    }
+    return I2C_STATUS_DONE;
+}
+
+void Chip_I2C_MasterSubmit(I2C_ID_T id, I2C_MXFER_T *pMXfer)
+{
+    I2C_MXFER_T *pDone;
+
+    pMXfer->status = I2C_STATUS_BUSY;
+    pMXfer->pNext = NULL;
+    if (sTail) {
+        sTail->pNext = pMXfer;
+    }
+    else {
+        sHead = pMXfer;
+    }
+    sTail = pMXfer;
+
+    if (sRunning) {
+        return;
+    }
+    sRunning = true;
+    while (sHead) {
+        pDone = sHead;
+        pDone->status = Run(pDone);
+        sHead = pDone->pNext;
+        if (!sHead) {
+            sTail = NULL;
+        }
+        if (pDone->cb) {
+            pDone->cb(id, pDone);
+        }
+    }
+    sRunning = false;
+}
+
+int Chip_I2C_MasterSend(I2C_ID_T id, uint8_t slaveAddr, const uint8_t *buff, int len)
+{
+    I2C_XFER_T xfer = {slaveAddr, buff, len, NULL, 0, I2C_STATUS_BUSY};
+    I2C_MXFER_T mxfer = {&xfer, 1, I2C_STATUS_BUSY, NULL, NULL, NULL};
+
+    Chip_I2C_MasterSubmit(id, &mxfer);
+    return (mxfer.status == I2C_STATUS_DONE) ? len : 0;
+}
+
+bool Chip_I2C_IsMasterIdle(I2C_ID_T id)
+{
+    (void)id;
+    return !sRunning;
+}
+
+void Chip_I2C_Init(I2C_ID_T id)
+{
+    (void)id;
+}
+
+void Clock_SetI2CRate(uint32_t rate)
+{
+    (void)rate;
+}
+
+void Profile_Enter(PROFILE_REGION_T region)
+{
+    (void)region;
+}
+
+void Profile_Exit(PROFILE_REGION_T region)
+{
+    (void)region;
+}
+
+int Chip_I2C_SetMasterEventHandler(I2C_ID_T id, I2C_EVENTHANDLER_T event)
+{
+    (void)id;
+    (void)event;
+    return 1;
+}
+
+void Chip_I2C_EventHandlerSleep(I2C_ID_T id, I2C_EVENT_T event)
+{
+    (void)id;
+    (void)event;
+}
+
+void Chip_I2C_MasterStateHandler(I2C_ID_T id)
+{
+    (void)id;
+}
+
+void Chip_GPIO_SetPinState(void *pGPIO, uint8_t port, uint8_t pin, bool setting)
+{
+    (void)pGPIO;
+    if ((port == 0) && (pin == OLED_PWR_PIN)) {
+        Emu_Power(setting);
+    }
+}
+
+bool Chip_GPIO_GetPinState(void *pGPIO, uint8_t port, uint8_t pin)
+{
+    (void)pGPIO;
+    (void)port;
+    (void)pin;
+    return false;
+}
+
+void Chip_GPIO_SetPinDIROutput(void *pGPIO, uint8_t port, uint8_t pin)
+{
+    (void)pGPIO;
+    (void)port;
+    (void)pin;
+}
+
+void Chip_IOCON_SetPinConfig(void *pIOCON, int pin, uint32_t config)
+{
+    (void)pIOCON;
+    (void)pin;
+    (void)config;
+}
+
+void Chip_SysCon_Peripheral_DeassertReset(int reset)
+{
+    (void)reset;
+}
+
+void NVIC_EnableIRQ(int irq)
+{
+    (void)irq;
+}
+
+void Chip_PMU_PowerMode_EnterSleep(void)
+{
+}
+
+void Timer_Delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+void __disable_irq(void)
+{
+}
+
+void __enable_irq(void)
+{
+}
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pBuf, int size)
+{
+    (void)pEEPROM;
+    memcpy(pBuf, &sEeprom[offset], (size_t)size);
+}
+
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pBuf, int size)
+{
+    (void)pEEPROM;
+    memcpy(&sEeprom[offset], pBuf, (size_t)size);
+}
+
+void Chip_EEPROM_Flush(void *pEEPROM, bool wait)
+{
+    (void)pEEPROM;
+    (void)wait;
+}
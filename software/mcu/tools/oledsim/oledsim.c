@@ -0,0 +1,193 @@
+/*
+ * oledsim.c
+ *
+ * Runs the display code of app_demo against the emulated panel, frame by frame, and reports the bus traffic each
+ * frame costs. Every frame is written as a PGM image, and can be compared against golden images of a previous run:
+ * a regression benchmark for changes to the display path. The golden images of the current tree are in golden/; a
+ * change that alters a frame on purpose writes them again with ./oledsim -o golden, and commits them with it.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -I../../lib_chip_nss/inc -o oledsim *.c \
+ *       ../../app_demo/src/ssd1306.c ../../app_demo/src/fonts.c ../../app_demo/src/clockface.c \
+ *       ../../app_demo/src/graph.c ../../app_demo/src/textscroll.c ../../app_demo/src/brightness.c \
+ *       ../../app_demo/src/layout.c ../../app_demo/src/format.c
+ *   mkdir -p out
+ *   ./oledsim -o out -g golden          write out/NN_name.pgm, compare against golden/, exit status 1 on a difference
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "board.h"
+#include "ssd1306.h"
+#include "clockface.h"
+#include "graph.h"
+#include "textscroll.h"
+#include "brightness.h"
+#include "ssd1306_emu.h"
+
+static const char *sOutDir;
+static const char *sGoldenDir;
+static int sFrame;
+static int sMismatches;
+
+static bool SameAsGolden(const char *name)
+{
+    char path[512];
+    uint8_t expected[EMU_WIDTH * EMU_HEIGHT];
+    uint8_t actual[EMU_WIDTH * EMU_HEIGHT];
+    int w;
+    int h;
+    int max;
+    FILE *f;
+    bool same;
+
+    snprintf(path, sizeof(path), "%s/%s", sGoldenDir, name);
+    f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    same = (fscanf(f, "P5 %d %d %d", &w, &h, &max) == 3) && (w == EMU_WIDTH) && (h == EMU_HEIGHT)
+            && (fgetc(f) != EOF) && (fread(expected, 1, sizeof(expected), f) == sizeof(expected));
+    fclose(f);
+    Emu_Render(actual);
+    return same && (memcmp(expected, actual, sizeof(actual)) == 0);
+}
+
+/* Waits for the frame to be sent, then reports and dumps it */
+static void EndFrame(const char *title)
+{
+    char name[128];
+    char path[512];
+    EMU_STATS_T stats;
+    const char *golden = "";
+    FILE *f;
+
+    OLED_WaitFlush();
+    Emu_GetStats(&stats, true);
+    snprintf(name, sizeof(name), "%02d_%s.pgm", sFrame++, title);
+
+    if (sOutDir) {
+        snprintf(path, sizeof(path), "%s/%s", sOutDir, name);
+        f = fopen(path, "wb");
+        if (!f) {
+            perror(path);
+            exit(2);
+        }
+        Emu_WritePgm(f);
+        fclose(f);
+    }
+    if (sGoldenDir) {
+        if (SameAsGolden(name)) {
+            golden = "  ok";
+        }
+        else {
+            golden = "  DIFFERS";
+            sMismatches++;
+        }
+    }
+    printf("%-24s %6u %6u %10.0f %10.0f %4u %4u %6.0f%s\n", name, stats.transactions, stats.bytes,
+            Emu_BusTimeUs(&stats, 250000), Emu_BusTimeUs(&stats, 400000), stats.errors, stats.scrollWrites,
+            Emu_CurrentUa(), golden);
+}
+
+static void Face(CLOCKFACE_T *face, uint8_t hours, uint8_t minutes, bool colon, int temperature)
+{
+    face->hours = hours;
+    face->minutes = minutes;
+    face->colon = colon;
+    face->temperature = temperature;
+    ClockFace_Update(face);
+}
+
+int main(int argc, char *argv[])
+{
+    static const char message[] = "Hello from the phone, longer than one screen";
+    static const int history[] = {215, 221, 230, 228, 219, 235};
+    CLOCKFACE_T face = {12, 34, true, 2018, 3, 13, true, 235, false, 0, true};
+    int i;
+
+    for (i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-o") == 0) {
+            sOutDir = argv[++i];
+        }
+        else if (strcmp(argv[i], "-g") == 0) {
+            sGoldenDir = argv[++i];
+        }
+    }
+
+    printf("%-24s %6s %6s %10s %10s %4s %4s %6s\n", "frame", "trans", "bytes", "us@250k", "us@400k", "err", "scrl",
+            "uA");
+
+    /* Cold start as on the first wake-up: power cycle, configuration, complete first frame */
+    ssd1306_init();
+    EndFrame("cold_init");
+    ClockFace_Invalidate();
+    Face(&face, 12, 34, true, 235);
+    EndFrame("clock_first");
+
+    /* A normal second: only the colon */
+    Face(&face, 12, 34, false, 235);
+    EndFrame("second");
+    Face(&face, 12, 34, true, 235);
+    EndFrame("second_colon");
+
+    /* Minute and temperature changes */
+    Face(&face, 12, 35, false, 235);
+    EndFrame("minute");
+    Face(&face, 12, 59, true, 235);
+    Face(&face, 13, 0, false, 236);
+    EndFrame("hour_and_temperature");
+    face.fahrenheit = true;
+    Face(&face, 13, 0, true, 945);
+    EndFrame("fahrenheit");
+    face.fahrenheit = false;
+
+    /* Temperature history */
+    Graph_Show(history, sizeof(history) / sizeof(history[0]));
+    EndFrame("graph");
+    Graph_Show(history, sizeof(history) / sizeof(history[0]));
+    EndFrame("graph_unchanged");
+    Graph_Hide();
+    ClockFace_Invalidate();
+    Face(&face, 13, 0, false, 236);
+    EndFrame("graph_to_clock");
+
+    /* Text message instead of the date */
+    TextScroll_Set((const uint8_t *)message, TEXTSCROLL_MAX_LENGTH);
+    TextScroll_Start();
+    face.showDate = false;
+    Face(&face, 13, 0, true, 236);
+    EndFrame("text_start");
+    Face(&face, 13, 0, false, 236);
+    EndFrame("text_second");
+    for (i = 0; i < 4; i++) {
+        TextScroll_Tick();
+    }
+    EndFrame("text_next_screen");
+    TextScroll_Stop();
+    face.showDate = true;
+    Face(&face, 13, 0, true, 236);
+    EndFrame("text_stop");
+
+    /* Brightness profiles on the same clock face, then the fade before the display goes off */
+    Brightness_Apply(12, true, 60);
+    EndFrame("saver");
+    Brightness_Apply(23, false, 60);
+    EndFrame("night");
+    for (i = BRIGHTNESS_FADE_SECONDS - 1; i >= 0; i--) {
+        Brightness_Apply(12, false, (uint32_t)i);
+        EndFrame("fade");
+    }
+    Brightness_Apply(12, false, 60);
+    EndFrame("day");
+
+    /* Supply cut before deep power down; the next wake-up starts again from the cold init */
+    oled_lpw_enter();
+    EndFrame("off");
+
+    if (sMismatches) {
+        printf("%d frame(s) differ from %s\n", sMismatches, sGoldenDir);
+        return 1;
+    }
+    return 0;
+}
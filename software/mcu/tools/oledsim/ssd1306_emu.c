@@ -0,0 +1,248 @@
+/*
+ * ssd1306_emu.c
+ *
+ * Implements the part of the SSD1306 command set the clock uses, plus the remaining fundamental, addressing,
+ * scrolling and hardware configuration commands so that any unexpected byte is reported instead of silently dropped.
+ */
+#include <string.h>
+#include "ssd1306_emu.h"
+
+static EMU_STATE_T sState;
+static EMU_STATS_T sStats;
+
+/* A command waiting for its argument bytes */
+static uint8_t sCmd;
+static uint8_t sArgs[7];
+static int sArgCount;
+static int sArgsNeeded;
+
+static void Reset(void)
+{
+    memset(&sState, 0, sizeof(sState));
+    sState.powered = true;
+    sState.contrast = 0x7F;
+    sState.mode = 2;
+    sState.colEnd = EMU_WIDTH - 1;
+    sState.pageEnd = EMU_PAGES - 1;
+    sArgsNeeded = 0;
+    /* GDDRAM content after power-up is undefined: make that visible */
+    memset(sState.ram, 0xA5, sizeof(sState.ram));
+}
+
+void Emu_Power(bool on)
+{
+    if (on && !sState.powered) {
+        Reset();
+    }
+    sState.powered = on;
+}
+
+static int ArgsOf(uint8_t cmd)
+{
+    switch (cmd) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+static void Execute(uint8_t cmd, const uint8_t *args)
+{
+    if (cmd <= 0x0F) {
+        sState.col = (uint8_t)((sState.col & 0xF0) | cmd);
+    }
+    else if (cmd <= 0x1F) {
+        sState.col = (uint8_t)(((cmd & 0x07) << 4) | (sState.col & 0x0F));
+    }
+    else if ((cmd >= 0x40) && (cmd <= 0x7F)) {
+        ; /* Display start line: not modelled, the clock keeps it at 0 */
+    }
+    else if ((cmd >= 0xB0) && (cmd <= 0xB7)) {
+        sState.page = cmd & 0x07;
+    }
+    else {
+        switch (cmd) {
+            case 0x20: sState.mode = args[0] & 0x03; break;
+            case 0x21: sState.colStart = sState.col = args[0] & 0x7F; sState.colEnd = args[1] & 0x7F; break;
+            case 0x22: sState.pageStart = sState.page = args[0] & 0x07; sState.pageEnd = args[1] & 0x07; break;
+            case 0x26: case 0x27:
+                sState.scrollFirst = args[1] & 0x07;
+                sState.scrollLast = args[3] & 0x07;
+                break;
+            case 0x29: case 0x2A: case 0xA3: break;
+            case 0x2E: sState.scrolling = false; break;
+            case 0x2F: sState.scrolling = true; break;
+            case 0x81: sState.contrast = args[0]; break;
+            case 0x8D: sState.chargePump = (args[0] & 0x04) != 0; break;
+            case 0xA0: case 0xA1: sState.segRemap = cmd & 1; break;
+            case 0xA4: case 0xA5: sState.entireOn = cmd & 1; break;
+            case 0xA6: case 0xA7: sState.inverse = cmd & 1; break;
+            case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB: case 0xE3: break;
+            case 0xAE: case 0xAF: sState.displayOn = cmd & 1; break;
+            case 0xC0: case 0xC8: sState.comRemap = (cmd & 0x08) != 0; break;
+            default: sStats.errors++; break;
+        }
+    }
+}
+
+static void Command(uint8_t byte)
+{
+    sStats.commands++;
+    if (sArgsNeeded > 0) {
+        sArgs[sArgCount++] = byte;
+        if (sArgCount == sArgsNeeded) {
+            sArgsNeeded = 0;
+            Execute(sCmd, sArgs);
+        }
+        return;
+    }
+    sCmd = byte;
+    sArgCount = 0;
+    sArgsNeeded = ArgsOf(byte);
+    if (sArgsNeeded == 0) {
+        Execute(byte, sArgs);
+    }
+}
+
+static void Data(uint8_t byte)
+{
+    sStats.dataBytes++;
+    if (sState.scrolling && (sState.page >= sState.scrollFirst) && (sState.page <= sState.scrollLast)) {
+        sStats.scrollWrites++;
+    }
+    sState.ram[sState.page][sState.col] = byte;
+    switch (sState.mode) {
+        case 2:
+            /* Page addressing: the column wraps within the page */
+            sState.col = (uint8_t)((sState.col + 1) & (EMU_WIDTH - 1));
+            break;
+        case 0:
+            if (sState.col++ >= sState.colEnd) {
+                sState.col = sState.colStart;
+                sState.page = (sState.page >= sState.pageEnd) ? sState.pageStart : (uint8_t)(sState.page + 1);
+            }
+            break;
+        default:
+            if (sState.page++ >= sState.pageEnd) {
+                sState.page = sState.pageStart;
+                sState.col = (sState.col >= sState.colEnd) ? sState.colStart : (uint8_t)(sState.col + 1);
+            }
+            break;
+    }
+}
+
+bool Emu_Transaction(uint8_t addr, const uint8_t *buf, int len)
+{
+    int i = 0;
+    uint8_t control;
+
+    if (addr != EMU_ADDR) {
+        return false;
+    }
+    sStats.transactions++;
+    sStats.bytes += (uint32_t)len + 1;
+    if (!sState.powered) {
+        sStats.errors++;
+        return false;
+    }
+    while (i < len) {
+        control = buf[i++];
+        if (control & 0x80) {
+            /* Co set: a single byte, then another control byte */
+            if (i < len) {
+                if (control & 0x40) {
+                    Data(buf[i++]);
+                }
+                else {
+                    Command(buf[i++]);
+                }
+            }
+        }
+        else {
+            /* Co clear: the rest of the transaction is a stream */
+            while (i < len) {
+                if (control & 0x40) {
+                    Data(buf[i++]);
+                }
+                else {
+                    Command(buf[i++]);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+const EMU_STATE_T *Emu_GetState(void)
+{
+    return &sState;
+}
+
+void Emu_GetStats(EMU_STATS_T *stats, bool reset)
+{
+    *stats = sStats;
+    if (reset) {
+        memset(&sStats, 0, sizeof(sStats));
+    }
+}
+
+double Emu_BusTimeUs(const EMU_STATS_T *stats, uint32_t hz)
+{
+    return (9.0 * stats->bytes + 2.0 * stats->transactions) * 1e6 / hz;
+}
+
+void Emu_Render(uint8_t *pixels)
+{
+    bool lit = sState.powered && sState.displayOn && sState.chargePump;
+    int x;
+    int y;
+    int col;
+    int row;
+    bool on;
+
+    for (y = 0; y < EMU_HEIGHT; y++) {
+        for (x = 0; x < EMU_WIDTH; x++) {
+            /* The glass is mounted rotated on the module: segment and COM remap give the upright image */
+            col = sState.segRemap ? x : (EMU_WIDTH - 1 - x);
+            row = sState.comRemap ? y : (EMU_HEIGHT - 1 - y);
+            on = sState.entireOn || ((sState.ram[row >> 3][col] >> (row & 7)) & 1);
+            on = on != sState.inverse;
+            pixels[y * EMU_WIDTH + x] = (lit && on) ? 255 : 0;
+        }
+    }
+}
+
+void Emu_WritePgm(FILE *f)
+{
+    uint8_t pixels[EMU_WIDTH * EMU_HEIGHT];
+
+    Emu_Render(pixels);
+    fprintf(f, "P5\n%d %d\n255\n", EMU_WIDTH, EMU_HEIGHT);
+    fwrite(pixels, 1, sizeof(pixels), f);
+}
+
+double Emu_CurrentUa(void)
+{
+    uint8_t pixels[EMU_WIDTH * EMU_HEIGHT];
+    uint32_t lit = 0;
+    uint32_t i;
+
+    if (!sState.powered) {
+        return 0;
+    }
+    if (!sState.displayOn || !sState.chargePump) {
+        return 1;
+    }
+    Emu_Render(pixels);
+    for (i = 0; i < sizeof(pixels); i++) {
+        lit += (pixels[i] != 0);
+    }
+    return 400 + 2.5 * 100 * (sState.contrast + 1) / 256 * lit / EMU_HEIGHT;
+}
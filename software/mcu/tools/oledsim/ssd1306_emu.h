@@ -0,0 +1,73 @@
+/*
+ * ssd1306_emu.h
+ *
+ * Bus level model of the SSD1306 controller on the clock's panel: it parses the I2C transactions sent to it, keeps
+ * the 128x64 GDDRAM and the display state, and counts the traffic.
+ */
+
+#ifndef SSD1306_EMU_H_
+#define SSD1306_EMU_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define EMU_ADDR        0x3C
+#define EMU_WIDTH       128
+#define EMU_HEIGHT      64
+#define EMU_PAGES       (EMU_HEIGHT / 8)
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;             /* Including the address byte of each transaction */
+    uint32_t commands;
+    uint32_t dataBytes;
+    uint32_t errors;            /* Unknown commands, data or commands to a powered down panel */
+    uint32_t scrollWrites;      /* GDDRAM writes to pages being scrolled: their position is undefined */
+} EMU_STATS_T;
+
+typedef struct {
+    bool powered;
+    bool displayOn;
+    bool chargePump;
+    bool inverse;
+    bool entireOn;
+    bool segRemap;
+    bool comRemap;
+    uint8_t contrast;
+    uint8_t mode;               /* 0: horizontal, 1: vertical, 2: page addressing */
+    uint8_t page;
+    uint8_t col;
+    uint8_t colStart, colEnd;
+    uint8_t pageStart, pageEnd;
+    bool scrolling;
+    uint8_t scrollFirst, scrollLast;
+    uint8_t ram[EMU_PAGES][EMU_WIDTH];
+} EMU_STATE_T;
+
+/** Panel supply switched on or off; switching on resets the controller and leaves GDDRAM undefined. */
+void Emu_Power(bool on);
+
+/** Feeds one complete I2C write transaction. @return false if the address is not the panel's, i.e. a NAK. */
+bool Emu_Transaction(uint8_t addr, const uint8_t *buf, int len);
+
+const EMU_STATE_T *Emu_GetState(void);
+void Emu_GetStats(EMU_STATS_T *stats, bool reset);
+
+/** Bus time of @a stats at @a hz: 9 clocks per byte plus a start and a stop condition per transaction. */
+double Emu_BusTimeUs(const EMU_STATS_T *stats, uint32_t hz);
+
+/**
+ * Estimates the panel supply current for what it shows now, in uA. Each lit pixel of the row being scanned draws
+ * the segment current, 100 uA at contrast 0xFF and proportional below; the charge pump draws about 2.5 times its
+ * output from the battery. The controller itself takes about 400 uA with display and charge pump on, 1 uA in sleep.
+ */
+double Emu_CurrentUa(void);
+
+/** Renders what the panel shows, in its physical orientation, as a binary 8 bit PGM. */
+void Emu_WritePgm(FILE *f);
+
+/** Renders what the panel shows into @a pixels, EMU_WIDTH x EMU_HEIGHT bytes of 0 or 255. */
+void Emu_Render(uint8_t *pixels);
+
+#endif /* SSD1306_EMU_H_ */
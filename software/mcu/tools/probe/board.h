@@ -0,0 +1,13 @@
+/*
+ * Host stand-in for the board and chip headers, so probe.c of app_demo builds and runs on a PC. probesim.c implements
+ * what is declared here.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#endif
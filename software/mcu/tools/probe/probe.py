@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Report of the cycle probes of the clock, from an APP_MSG_ID_GETPROFILE response.
+
+The response is given as hex bytes, as shown by the phone or a reader: with or without the two header bytes of the
+msg mod, spaces and colons allowed. After the phone wrote "PRB", the NDEF message of the clock carries it as a MIME
+record; tools/probe/probesim.c prints one. Prints one line per probe, the most expensive in total first (see
+app_demo/inc/probe.h for what each probe covers). With --baseline, the response of an earlier firmware is compared:
+a probe whose average grew by more than --threshold percent is flagged, and the exit status is 1.
+
+Usage: probe.py [--baseline HEX] [--threshold 10] [--mhz 2] [HEX]      HEX is read from stdin when not given
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+APP_MSG_ID_GETPROFILE = 0x51
+
+# PROBE_ID_T
+NAMES = [
+    'Storage_Write',
+    'Storage_Seek',
+    'Storage_Read',
+    'MoveSamplesFromEepromToFlash',
+    'NDEFT2T_CommitMessage',
+    'Msg_HandleCommand',
+    'RTC_Ticks2Date',
+    'FormatTemperatures',
+]
+
+HEADER = struct.Struct('<IB3x')         # APP_MSG_RESPONSE_GETPROFILE_T
+PROBE = struct.Struct('<IIII')          # APP_MSG_PROBE_T
+
+
+def parse(text):
+    """Probe name -> (count, min, max, total)"""
+    data = bytes.fromhex(re.sub(r'[\s:,]|0x', '', text))
+    if data[:1] == bytes([APP_MSG_ID_GETPROFILE]) and (len(data) - 2 - HEADER.size) % PROBE.size == 0:
+        data = data[2:]
+    if len(data) < HEADER.size:
+        raise ValueError('response too short: %d bytes' % len(data))
+    result, count = HEADER.unpack_from(data)
+    if result != 0:
+        raise ValueError('command failed: result 0x%X' % result)
+    if len(data) != HEADER.size + count * PROBE.size:
+        raise ValueError('%d bytes do not hold %d probes' % (len(data), count))
+    probes = {}
+    for n in range(count):
+        name = NAMES[n] if n < len(NAMES) else 'probe %d' % n
+        probes[name] = PROBE.unpack_from(data, HEADER.size + n * PROBE.size)
+    return probes
+
+
+def average(stats):
+    count, _, _, total = stats
+    return total / count if count else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('response', nargs='?', help='hex bytes of the response; read from stdin when not given')
+    parser.add_argument('--baseline', help='hex bytes of a response of an earlier firmware')
+    parser.add_argument('--threshold', type=float, default=10.0, help='percent of growth flagged (default 10)')
+    parser.add_argument('--mhz', type=float, default=2.0, help='clock to express the average in us (default 2)')
+    args = parser.parse_args()
+
+    try:
+        probes = parse(args.response if args.response else sys.stdin.read())
+        baseline = parse(args.baseline) if args.baseline else {}
+    except ValueError as e:
+        sys.exit(str(e))
+    if not probes:
+        sys.exit('firmware built without probes')
+
+    regressions = 0
+    print('%-30s %8s %10s %10s %10s %12s %9s %8s' % ('probe', 'calls', 'min', 'avg', 'max', 'total', 'avg us',
+                                                     'vs base'))
+    for name, stats in sorted(probes.items(), key=lambda item: -item[1][3]):
+        count, low, high, total = stats
+        change = ''
+        if name in baseline and baseline[name][0] and count:
+            growth = 100.0 * (average(stats) / average(baseline[name]) - 1.0)
+            change = '%+.1f%%' % growth
+            if growth > args.threshold:
+                change += ' !'
+                regressions += 1
+        if not count:
+            print('%-30s %8d %10s %10s %10s %12s %9s %8s' % (name, 0, '-', '-', '-', '-', '-', change))
+            continue
+        print('%-30s %8d %10d %10.0f %10d %12d %9.1f %8s' % (name, count, low, average(stats), high, total,
+                                                            average(stats) / args.mhz, change))
+    if regressions:
+        print('%d probe(s) more than %.0f%% slower than the baseline' % (regressions, args.threshold))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
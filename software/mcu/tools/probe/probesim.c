@@ -0,0 +1,89 @@
+/*
+ * probesim.c
+ *
+ * Feeds known call times into probe.c of app_demo, at each clock level, and checks the statistics kept and the
+ * response to APP_MSG_ID_GETPROFILE written from them - the bytes the NDEF message carries after the phone wrote
+ * "PRB". The response is printed as hex, with the msg header, as a phone shows the record: tools/probe/probe.py
+ * decodes it.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -I../../app_demo/mods -DPROBE=1 -o probesim probesim.c \
+ *       ../../app_demo/src/probe.c
+ *   ./probesim | python3 probe.py        exit status 1 when a check fails
+ */
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "clock.h"
+#include "probe.h"
+#include "msghandler_protocol.h"
+
+static CLOCK_LEVEL_T sLevel;
+static int sFailures;
+
+CLOCK_LEVEL_T Clock_GetLevel(void)
+{
+    return sLevel;
+}
+
+static void Check(bool ok, const char *what)
+{
+    if (!ok) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        sFailures++;
+    }
+}
+
+static uint32_t Get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+int main(void)
+{
+    uint8_t record[2 + PROBE_RESPONSE_SIZE];
+    const uint8_t *probe;
+    int length;
+    int n;
+
+    /* Storage_Read: 100 us and 300 us at 4 MHz; RTC_Ticks2Date: 50 us at 2 MHz; FormatTemperatures: 40 us at 1 MHz */
+    sLevel = CLOCK_LEVEL_FAST;
+    Probe_Record(PROBE_STORAGE_READ, 100);
+    Probe_Record(PROBE_STORAGE_READ, 300);
+    sLevel = CLOCK_LEVEL_NORMAL;
+    Probe_Record(PROBE_RTC_DATE, 50);
+    sLevel = CLOCK_LEVEL_IDLE;
+    Probe_Record(PROBE_NDEF_TEXT, 40);
+
+    /* As main adds the record to the NDEF message */
+    record[0] = APP_MSG_ID_GETPROFILE;
+    record[1] = 1;
+    length = 2 + Probe_GetResponse(&record[2], false);
+    Check(length == (int)sizeof(record), "the response holds all probes");
+    Check(Get32(&record[2]) == MSG_OK, "result");
+    Check(record[6] == PROBE_COUNT, "count");
+
+    probe = &record[2 + sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + PROBE_STORAGE_READ * sizeof(APP_MSG_PROBE_T)];
+    Check(Get32(&probe[0]) == 2, "Storage_Read calls");
+    Check(Get32(&probe[4]) == 400, "Storage_Read min, in cycles at 4 MHz");
+    Check(Get32(&probe[8]) == 1200, "Storage_Read max");
+    Check(Get32(&probe[12]) == 1600, "Storage_Read total");
+    probe = &record[2 + sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + PROBE_RTC_DATE * sizeof(APP_MSG_PROBE_T)];
+    Check(Get32(&probe[12]) == 100, "RTC_Ticks2Date total, in cycles at 2 MHz");
+    probe = &record[2 + sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + PROBE_NDEF_TEXT * sizeof(APP_MSG_PROBE_T)];
+    Check(Get32(&probe[12]) == 40, "FormatTemperatures total, in cycles at 1 MHz");
+    probe = &record[2 + sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + PROBE_MSG_COMMAND * sizeof(APP_MSG_PROBE_T)];
+    Check((Get32(&probe[0]) == 0) && (Get32(&probe[4]) == 0xFFFFFFFF), "a probe never called");
+
+    for (n = 0; n < length; n++) {
+        printf("%02X%s", record[n], (n + 1 < length) ? " " : "\n");
+    }
+
+    /* "PRBR": the statistics restart */
+    (void)Probe_GetResponse(&record[2], true);
+    (void)Probe_GetResponse(&record[2], false);
+    probe = &record[2 + sizeof(APP_MSG_RESPONSE_GETPROFILE_T) + PROBE_STORAGE_READ * sizeof(APP_MSG_PROBE_T)];
+    Check(Get32(&probe[0]) == 0, "no calls after a reset");
+
+    return sFailures ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Charge per day of each subsystem, from the energy profile of the clock.
+
+Reads the line the firmware adds to its NDEF message after the phone wrote "PRF" (see app_demo/inc/profile.h):
+    PROF<seconds> L<us> A<total>/<count> S<total>/<count> D.. E.. N.. T.. B<led>
+with the totals in units of 64 us, and multiplies the time of each region with an assumed current. B is the LED time
+of the temperature bar: the time each LED was lit, weighted by its PWM duty (see app_demo/inc/ledbar.h). The LEDs draw
+on top of everything else; their charge is also given per full wake, the display interval of the bar. The currents below
+are assumptions, not measurements: measure them on the board, then pass them with --current.
+
+The regions overlap. The core is busy during E and N and sleeps during S; the rest of A is other work of the core.
+The I2C transfers of D and the conversions of T run on their own while the core sleeps or works, so their current is
+counted on top. Two things are not in the table and are added here: the sample wakes of the logger, one per
+LOGGER_INTERVAL_SECONDS at the duration of the last one (L), and the row program of the table itself, once per full
+wake.
+
+Usage: profile.py [--current sleep=120] [line]          the line is read from stdin when not given
+"""
+
+import argparse
+import re
+import sys
+
+UNIT_US = 64                    # PROFILE_UNIT_US
+LOGGER_INTERVAL_SECONDS = 15 * 60
+ROW_PROGRAM_US = 2500           # One EEPROM row, as assumed by tools/loggersim
+
+# Assumed current in uA, per kind of time
+CURRENTS = {
+    'active': 250,              # Core running at 2 MHz, see logger.h
+    'sleep': 120,               # Core sleeping, clock and peripherals running
+    'display': 300,             # On top: I2C0 and the panel receiving
+    'eeprom': 600,              # Core waiting for an EEPROM row program
+    'tsen': 100,                # On top: TSEN converting
+    'led': 2000,                # On top: one LED of the bar lit, see ledbar.h
+    'dpd': 0.2,                 # Deep power down, RTC running
+}
+
+REGIONS = 'ASDENT'
+
+
+def parse(line):
+    m = re.search(r'PROF(\d+) L(\d+)((?: [A-Z]\d+/\d+)+)(?: B(\d+))?', line)
+    if not m:
+        raise ValueError('no profile found in: %r' % line)
+    seconds, last = int(m.group(1)), int(m.group(2))
+    led = int(m.group(4) or 0) * UNIT_US * 1e-6
+    regions = {}
+    for letter, total, count in re.findall(r' ([A-Z])(\d+)/(\d+)', m.group(3)):
+        regions[letter] = (int(total) * UNIT_US * 1e-6, int(count))
+    for letter in REGIONS:
+        regions.setdefault(letter, (0.0, 0))
+    return seconds, last * 1e-6, regions, led
+
+
+def charges(seconds, last, regions, led, currents):
+    """Seconds and uAs per subsystem"""
+    t = {letter: regions[letter][0] for letter in REGIONS}
+    wakes = regions['A'][1]
+    samples = seconds / LOGGER_INTERVAL_SECONDS
+    other = max(0.0, t['A'] - t['S'] - t['E'] - t['N'])
+    table_writes = wakes * ROW_PROGRAM_US * 1e-6
+    dpd = max(0.0, seconds - t['A'] - samples * last - table_writes)
+    rows = [
+        ('display flushes (D)', t['D'], t['D'] * currents['display']),
+        ('EEPROM writes (E)', t['E'], t['E'] * currents['eeprom']),
+        ('NDEF commits (N)', t['N'], t['N'] * currents['active']),
+        ('temperature conversions (T)', t['T'], t['T'] * currents['tsen']),
+        ('LED bar (B)', led, led * currents['led']),
+        ('sleep in the event loop (S)', t['S'], t['S'] * currents['sleep']),
+        ('other work of the core', other, other * currents['active']),
+        ('sample wakes of the logger', samples * last, samples * last * currents['active']),
+        ('row program of the profile', table_writes, table_writes * currents['eeprom']),
+        ('deep power down', dpd, dpd * currents['dpd']),
+    ]
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('line', nargs='?', help='the PROF line; read from stdin when not given')
+    parser.add_argument('--current', action='append', default=[], metavar='KIND=UA',
+                        help='override an assumed current: ' + ', '.join(sorted(CURRENTS)))
+    args = parser.parse_args()
+
+    currents = dict(CURRENTS)
+    for setting in args.current:
+        kind, _, value = setting.partition('=')
+        if kind not in currents:
+            parser.error('unknown kind of current: %s' % kind)
+        currents[kind] = float(value)
+
+    try:
+        seconds, last, regions, led = parse(args.line if args.line else sys.stdin.read())
+    except ValueError as e:
+        sys.exit(str(e))
+    if seconds == 0:
+        sys.exit('the profile covers no time yet')
+
+    rows = charges(seconds, last, regions, led, currents)
+    per_day = 86400.0 / seconds / 3600.0      # uAs over the profile -> uAh per day
+    total = sum(charge for _, _, charge in rows)
+    print('%.1f days profiled, %d full wakes, last sample wake %d us' % (seconds / 86400.0, regions['A'][1],
+                                                                        last * 1e6))
+    print('%-30s %12s %10s %6s' % ('subsystem', 's/day', 'uAh/day', '%'))
+    for name, time, charge in sorted(rows, key=lambda row: -row[2]):
+        print('%-30s %12.3f %10.3f %5.1f%%' % (name, time * 86400.0 / seconds, charge * per_day,
+                                              100.0 * charge / total if total else 0.0))
+    print('%-30s %12s %10.3f' % ('total', '', total * per_day))
+    if regions['A'][1]:
+        wakes = regions['A'][1]
+        print('LED bar per full wake: %.3f s of one LED, %.1f uAs; %.2f LEDs lit on average while awake'
+              % (led / wakes, led * currents['led'] / wakes, led / regions['A'][0] if regions['A'][0] else 0.0))
+
+
+if __name__ == '__main__':
+    main()
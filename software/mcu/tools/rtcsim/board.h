@@ -0,0 +1,19 @@
+/*
+ * Host stand-in for the board and chip headers, so rtc.c of app_demo builds and runs on a PC. rtcsim.c implements
+ * what is declared here. probe.h comes in through app_sel.h on the board.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "probe.h"
+
+#define __IO        volatile
+#define NSS_RTC     NULL
+
+int Chip_RTC_Time_GetValue(void *pRTC);
+
+#endif
@@ -0,0 +1,254 @@
+/*
+ * rtcsim.c
+ *
+ * Checks RTC_Convert2Date of app_demo for every day the 32-bit RTC can hold, 1970-01-01 up to 2106-02-07, against
+ * gmtime of the C library and against the loop it replaced, which is kept below as OldConvert2Date. Then every second
+ * of the first and the last day, a run of days one by one - the cache of the next day - and random jumps - the
+ * division. Last, both are timed on the PC, per call: a guide only, the cycles on the board are in probe
+ * PROBE_RTC_DATE, see tools/probe.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -O2 -Wall -Wextra -I. -I../../app_demo/inc -o rtcsim rtcsim.c ../../app_demo/src/rtc.c
+ *   ./rtcsim                      exit status 1 when a check fails
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <time.h>
+#include "board.h"
+#include "rtc.h"
+
+#define DAY_SECONDS         86400u
+#define LAST_DAY            (0xFFFFFFFFu / DAY_SECONDS)
+
+extern const uint8_t table_month[12];
+extern uint8_t LEAP_Year_Calculate(uint32_t year);
+
+static uint32_t sTicks;
+
+int Chip_RTC_Time_GetValue(void *pRTC)
+{
+    (void)pRTC;
+    return (int)sTicks;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/* RTC_Convert2Date before the closed form, as it was */
+static void OldConvert2Date(RTC_VALUE_T *rtc)
+{
+    uint32_t temp, temp1;
+    uint32_t ticks;
+
+    ticks = (uint32_t)Chip_RTC_Time_GetValue(NSS_RTC);
+
+    temp = ticks / 86400;
+
+    temp1   = 1970;
+    while(temp >= 365) {
+        if(LEAP_Year_Calculate(temp1)) {
+            if(temp >= 366) {
+                temp = temp - 366;
+            }
+            else {
+                temp1++;
+                break;
+            }
+        }
+        else {
+            temp = temp - 365;
+        }
+        temp1++;
+    }
+    rtc->YEARS = temp1;
+
+    temp1 = 0;
+    while(temp >= 28) {
+        if( (LEAP_Year_Calculate(rtc->YEARS)) && (temp1 == 1) ) {
+            if(temp >= 29) {
+                temp = temp - 29;
+            }
+            else {
+                break;
+            }
+        }
+        else {
+            if(temp > table_month[temp1]) {
+                temp = temp - table_month[temp1];
+            }
+            else {
+                break;
+            }
+        }
+        temp1++;
+    }
+    rtc->MONTHS = (uint8_t)(temp1 + 1);
+    rtc->DAYS   = (uint8_t)(temp  + 1);
+
+    temp = ticks % 86400;
+
+    rtc->SECONDS = (uint8_t)((temp%3600)%60);
+    rtc->MINUTES = (uint8_t)((temp%3600)/60%60);
+    rtc->HOURS   = (uint8_t)((temp/3600));
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static bool SameDate(const RTC_VALUE_T *a, const RTC_VALUE_T *b)
+{
+    return (a->YEARS == b->YEARS) && (a->MONTHS == b->MONTHS) && (a->DAYS == b->DAYS);
+}
+
+static bool SameTime(const RTC_VALUE_T *a, const RTC_VALUE_T *b)
+{
+    return (a->HOURS == b->HOURS) && (a->MINUTES == b->MINUTES) && (a->SECONDS == b->SECONDS);
+}
+
+/* The date and time of sTicks, and the day of the week in WEEKS, by the C library */
+static void Expected(RTC_VALUE_T *rtc)
+{
+    time_t t = (time_t)sTicks;
+    struct tm tm;
+
+    gmtime_r(&t, &tm);
+    rtc->YEARS = (uint32_t)tm.tm_year + 1900;
+    rtc->MONTHS = (uint8_t)(tm.tm_mon + 1);
+    rtc->DAYS = (uint8_t)tm.tm_mday;
+    rtc->WEEKS = (uint8_t)tm.tm_wday;
+    rtc->HOURS = (uint8_t)tm.tm_hour;
+    rtc->MINUTES = (uint8_t)tm.tm_min;
+    rtc->SECONDS = (uint8_t)tm.tm_sec;
+}
+
+static bool Check(const char *what)
+{
+    RTC_VALUE_T expected;
+    RTC_VALUE_T rtc;
+
+    Expected(&expected);
+    RTC_Convert2Date(&rtc);
+    if (!SameDate(&rtc, &expected) || !SameTime(&rtc, &expected) || (rtc.WEEKS != expected.WEEKS)) {
+        printf("  %s: %u gives %04u-%02u-%02u %02u:%02u:%02u day %u instead of %04u-%02u-%02u %02u:%02u:%02u day %u\n",
+               what, sTicks, rtc.YEARS, rtc.MONTHS, rtc.DAYS, rtc.HOURS, rtc.MINUTES, rtc.SECONDS, rtc.WEEKS,
+               expected.YEARS, expected.MONTHS, expected.DAYS, expected.HOURS, expected.MINUTES, expected.SECONDS,
+               expected.WEEKS);
+        return false;
+    }
+    return true;
+}
+
+/* Every day, one by one, at a different second of each */
+static bool CheckDays(void)
+{
+    RTC_VALUE_T expected;
+    RTC_VALUE_T old;
+    uint32_t day;
+    uint32_t oldWrong = 0;
+    uint32_t oldFirst = 0;
+
+    for (day = 0; day <= LAST_DAY; day++) {
+        sTicks = day * DAY_SECONDS + (day * 7919u) % DAY_SECONDS;
+        if (sTicks < day * DAY_SECONDS) {
+            sTicks = 0xFFFFFFFF;        // the last day is not complete
+        }
+        if (!Check("day")) {
+            return false;
+        }
+        Expected(&expected);
+        OldConvert2Date(&old);
+        if (!SameDate(&old, &expected) || !SameTime(&old, &expected)) {
+            if (!oldWrong) {
+                oldFirst = sTicks;
+            }
+            oldWrong++;
+        }
+    }
+    printf("%-32s %u days as gmtime\n", "every day", day);
+    if (oldWrong) {
+        sTicks = oldFirst;
+        Expected(&expected);
+        OldConvert2Date(&old);
+        printf("%-32s %u days wrong, the first %04u-%02u-%02u given as %04u-%02u-%02u\n",
+               "  the loop it replaced", oldWrong, expected.YEARS, expected.MONTHS, expected.DAYS, old.YEARS,
+               old.MONTHS, old.DAYS);
+    }
+    return true;
+}
+
+/* Every second of the first and the last day: the time of the day */
+static bool CheckSeconds(void)
+{
+    uint32_t second;
+
+    for (second = 0; second < DAY_SECONDS; second++) {
+        sTicks = second;
+        if (!Check("second")) {
+            return false;
+        }
+    }
+    for (sTicks = LAST_DAY * DAY_SECONDS; sTicks != 0; sTicks++) {
+        if (!Check("second")) {
+            return false;
+        }
+    }
+    printf("%-32s first and last day\n", "every second");
+    return true;
+}
+
+static uint32_t sRandom = 12345;
+
+static uint32_t Random(void)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+    return sRandom;
+}
+
+/* Back and forth: each call a new day, by the division */
+static bool CheckJumps(void)
+{
+    int n;
+
+    for (n = 0; n < 1000000; n++) {
+        sTicks = Random();
+        if (!Check("jump")) {
+            return false;
+        }
+    }
+    printf("%-32s %d random times\n", "jumps", n);
+    return true;
+}
+
+static double Seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Nanoseconds per call on this PC, for the display: a new second each call, a new day once a day */
+static double Time(void (*convert)(RTC_VALUE_T *), uint32_t from, uint32_t calls)
+{
+    RTC_VALUE_T rtc;
+    double start = Seconds();
+    uint32_t n;
+
+    for (n = 0; n < calls; n++) {
+        sTicks = from + n;
+        convert(&rtc);
+    }
+    return (Seconds() - start) * 1e9 / calls;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    ok &= CheckDays();
+    ok &= CheckSeconds();
+    ok &= CheckJumps();
+
+    /* 2040: the loop counts 70 years */
+    printf("%-32s %.1f ns per call, the loop it replaced %.1f ns\n", "time on this PC",
+           Time(RTC_Convert2Date, 2208988800u, 10 * DAY_SECONDS), Time(OldConvert2Date, 2208988800u, 10 * DAY_SECONDS));
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,17 @@
+/*
+ * Host stand-in for the board and chip headers, so swtimer.c of app_demo builds and runs on a PC. swtimersim.c
+ * implements what is declared here.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NSS_RTC     NULL
+
+int Chip_RTC_Time_GetValue(void *pRTC);
+
+#endif
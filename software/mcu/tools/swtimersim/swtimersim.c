@@ -0,0 +1,159 @@
+/*
+ * swtimersim.c
+ *
+ * Runs swtimer.c of app_demo for a simulated day against an emulated RTC wake-up counter, and counts the wake-ups.
+ * Each scenario is a set of timers; every callback must run exactly at its deadline, and the IC must wake exactly
+ * once for each second in which a deadline falls, instead of the 86,400 times of a one second tick.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -Wall -Wextra -I. -I../../app_demo/inc -o swtimersim swtimersim.c ../../app_demo/src/swtimer.c
+ *   ./swtimersim                  exit status 1 when a check fails
+ */
+#include <stdio.h>
+#include "board.h"
+#include "timer.h"
+#include "swtimer.h"
+
+#define DAY         (24 * 60 * 60)
+#define MAX_TIMERS  4
+
+typedef struct {
+    uint32_t first;     // Seconds after midnight
+    uint32_t period;    // 0: one-shot
+} SPEC_T;
+
+typedef struct {
+    const char *name;
+    int count;
+    SPEC_T timers[MAX_TIMERS];
+} SCENARIO_T;
+
+static const SCENARIO_T sScenarios[] = {
+    {"idle, alarm at 07:30", 1, {{7 * 3600 + 30 * 60, DAY}}},
+    {"history every 5 min, alarm at 07:30", 2, {{300, 300}, {7 * 3600 + 30 * 60, DAY}}},
+    {"history every 1 min, alarm at 07:31:10", 2, {{60, 60}, {7 * 3600 + 31 * 60 + 10, DAY}}},
+    {"display window, host polls, alarm", 3, {{180, 0}, {30, 1}, {7 * 3600, DAY}}},
+    {"display lit all day", 1, {{1, 1}}},
+};
+
+static uint32_t sNow;           // The RTC, in seconds
+static uint32_t sWake;          // When the wake-up counter expires next
+static bool sCounting;
+static uint32_t sExpected[MAX_TIMERS];
+static uint32_t sPeriod[MAX_TIMERS];
+static SWTIMER_T sTimers[MAX_TIMERS];
+static int sErrors;
+
+/* -------------------------------------------------------------------------------- */
+
+int Chip_RTC_Time_GetValue(void *pRTC)
+{
+    (void)pRTC;
+    return (int)sNow;
+}
+
+void Timer_StartMeasurementTimeout(int seconds)
+{
+    sWake = sNow + (uint32_t)seconds;
+    sCounting = true;
+}
+
+void Timer_StopMeasurementTimeout(void)
+{
+    sCounting = false;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static void Hit(int n)
+{
+    if (sNow != sExpected[n]) {
+        printf("  timer %d ran at %u instead of %u\n", n, sNow, sExpected[n]);
+        sErrors++;
+    }
+    sExpected[n] = sPeriod[n] ? sExpected[n] + sPeriod[n] : 0xFFFFFFFF;
+}
+
+static void Cb0(void) { Hit(0); }
+static void Cb1(void) { Hit(1); }
+static void Cb2(void) { Hit(2); }
+static void Cb3(void) { Hit(3); }
+static const SWTIMER_CB_T sCbs[MAX_TIMERS] = {Cb0, Cb1, Cb2, Cb3};
+
+/* The host poll of the third scenario stops itself after 10 s, as PollHostCommand does */
+static void StopPoll(void)
+{
+    Hit(1);
+    if (sNow >= 40) {
+        SwTimer_Stop(&sTimers[1]);
+    }
+}
+
+/* Seconds of the day in which at least one deadline falls */
+static uint32_t Deadlines(const SCENARIO_T *scenario, bool stopPoll)
+{
+    uint32_t t;
+    uint32_t n = 0;
+    int i;
+
+    for (t = 0; t < DAY; t++) {
+        for (i = 0; i < scenario->count; i++) {
+            const SPEC_T *spec = &scenario->timers[i];
+            uint32_t last = (stopPoll && (i == 1)) ? 40 : DAY;
+            if ((t >= spec->first) && (t <= last)
+                    && ((spec->period == 0) ? (t == spec->first) : ((t - spec->first) % spec->period == 0))) {
+                n++;
+                break;
+            }
+        }
+    }
+    return n;
+}
+
+static bool Run(const SCENARIO_T *scenario)
+{
+    bool stopPoll = (scenario->count == 3);
+    uint32_t wakes = 0;
+    uint32_t expected = Deadlines(scenario, stopPoll);
+    int errors = sErrors;
+    int i;
+
+    /* Midnight; the counter was left running by a previous wake-up */
+    sNow = 0;
+    sWake = 1;
+    sCounting = true;
+    for (i = 0; i < scenario->count; i++) {
+        sExpected[i] = scenario->timers[i].first;
+        sPeriod[i] = scenario->timers[i].period;
+        SwTimer_Start(&sTimers[i], scenario->timers[i].first, scenario->timers[i].period,
+                      (stopPoll && (i == 1)) ? StopPoll : sCbs[i]);
+    }
+
+    while (sCounting && (sWake < DAY)) {
+        sNow = sWake;
+        /* As RTC_IRQHandler: a short reload, overruled by SwTimer_Run */
+        sWake = sNow + 1;
+        wakes++;
+        SwTimer_Run();
+    }
+    for (i = 0; i < scenario->count; i++) {
+        SwTimer_Stop(&sTimers[i]);
+    }
+
+    printf("%-40s %6u wakes, %6u deadlines, 1 s tick: %u\n", scenario->name, wakes, expected, DAY);
+    if (wakes != expected) {
+        printf("  wake-ups without work, or work without a wake-up\n");
+        sErrors++;
+    }
+    return sErrors == errors;
+}
+
+int main(void)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(sScenarios) / sizeof(sScenarios[0]); i++) {
+        Run(&sScenarios[i]);
+    }
+    return sErrors ? 1 : 0;
+}
@@ -0,0 +1,18 @@
+/*
+ * Host stand-in for the board and chip headers, so zone.c of app_demo builds and runs on a PC. zonesim.c implements
+ * what is declared here.
+ */
+
+#ifndef __BOARD_H_
+#define __BOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NSS_EEPROM  NULL
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pData, int size);
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pData, int size);
+
+#endif
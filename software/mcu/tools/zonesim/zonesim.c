@@ -0,0 +1,217 @@
+/*
+ * zonesim.c
+ *
+ * Checks zone.c of app_demo against localtime of the C library, which reads the same rules from the POSIX TZ string,
+ * for several zones: north and south of the equator, half and quarter hours, a change at 24:00, none at all.
+ *
+ * - Zone_ToLocal: every 15 minutes from 1970 up to the end of the RTC in 2106, in order as the clock runs, and every
+ *   transition to the second - the second before and the second it happens. Then random times, each one outside the
+ *   span of the one before.
+ * - Zone_ToUtc: back from every local time of the above; twice the same local time gives the first UTC time, and a
+ *   local time the clock skips is standard time.
+ *
+ * Build and run from this directory:
+ *   gcc -std=c99 -O2 -Wall -Wextra -I. -I../../app_demo/inc -o zonesim zonesim.c ../../app_demo/src/zone.c
+ *   ./zonesim                     exit status 1 when a check fails
+ */
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "board.h"
+#include "main.h"
+#include "zone.h"
+
+#define STEP                (15 * 60)
+#define LAST_TICK           0xFFFFFFFFu
+
+typedef struct CASE_S {
+    const char *name;
+    const char *tz;
+    ZONE_T zone;
+} CASE_T;
+
+static const CASE_T sCases[] = {
+    {"UTC", "UTC0", {0, 0, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}}},
+    {"India", "IST-5:30", {330, 0, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}}},
+    {"Europe/Brussels", "CET-1CEST,M3.5.0,M10.5.0/3", {60, 60, {3, 5, 0, 0, 120}, {10, 5, 0, 0, 180}}},
+    {"Europe/London", "GMT0BST,M3.5.0/1,M10.5.0", {0, 60, {3, 5, 0, 0, 60}, {10, 5, 0, 0, 120}}},
+    {"America/New_York", "EST5EDT,M3.2.0,M11.1.0", {-300, 60, {3, 2, 0, 0, 120}, {11, 1, 0, 0, 120}}},
+    {"Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3", {600, 60, {10, 1, 0, 0, 120}, {4, 1, 0, 0, 180}}},
+    {"Australia/Lord_Howe", "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", {630, 30, {10, 1, 0, 0, 120}, {4, 1, 0, 0, 120}}},
+    {"Pacific/Chatham", "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45",
+            {765, 60, {9, 5, 0, 0, 165}, {4, 1, 0, 0, 225}}},
+    {"America/Santiago", "<-04>4<-03>,M9.1.6/24,M4.1.6/24", {-240, 60, {9, 1, 6, 0, 1440}, {4, 1, 6, 0, 1440}}},
+    {"Atlantic/Azores", "<-01>1<+00>,M3.5.0/0,M10.5.0/1", {-60, 60, {3, 5, 0, 0, 0}, {10, 5, 0, 0, 60}}},
+};
+
+static uint8_t sEeprom[6 * EE_PAGE_SIZE];
+
+void Chip_EEPROM_Read(void *pEEPROM, int offset, void *pData, int size)
+{
+    (void)pEEPROM;
+    memcpy(pData, &sEeprom[offset], (size_t)size);
+}
+
+void Chip_EEPROM_Write(void *pEEPROM, int offset, void *pData, int size)
+{
+    (void)pEEPROM;
+    memcpy(&sEeprom[offset], pData, (size_t)size);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/* The local time of @a utc by the C library */
+static uint32_t Expected(uint32_t utc)
+{
+    time_t t = (time_t)utc;
+    struct tm tm;
+
+    localtime_r(&t, &tm);
+    return utc + (uint32_t)tm.tm_gmtoff;
+}
+
+static int32_t Offset(uint32_t utc)
+{
+    return (int32_t)(Expected(utc) - utc);
+}
+
+static bool Check(const char *name, uint32_t utc)
+{
+    uint32_t local = Zone_ToLocal(utc);
+
+    if (local != Expected(utc)) {
+        printf("  %s: %u gives an offset of %d s instead of %d s\n", name, utc, (int32_t)(local - utc), Offset(utc));
+        return false;
+    }
+    return true;
+}
+
+/* Back from the local time of @a utc, see the top */
+static bool CheckBack(const char *name, const ZONE_T *zone, uint32_t utc)
+{
+    uint32_t local = Expected(utc);
+    uint32_t back = Zone_ToUtc(local);
+    uint32_t save = (uint32_t)zone->save * 60;
+    uint32_t expected = utc;
+
+    if (save && (utc >= save) && (Expected(utc - save) == local)) {
+        expected = utc - save;                          // the second time this local time occurs
+    }
+    if (back != expected) {
+        printf("  %s: local %u gives %u instead of %u\n", name, local, back, expected);
+        return false;
+    }
+    return true;
+}
+
+static uint32_t sRandom = 12345;
+
+static uint32_t Random(void)
+{
+    sRandom = sRandom * 1103515245u + 12345u;
+    return sRandom ^ (sRandom >> 16);
+}
+
+static bool Run(const CASE_T *c)
+{
+    uint64_t t;
+    uint32_t utc;
+    uint32_t low;
+    uint32_t high;
+    uint32_t mid;
+    uint32_t gap;
+    uint32_t skipped;
+    int transitions = 0;
+    int n;
+
+    setenv("TZ", c->tz, 1);
+    tzset();
+    memset(sEeprom, 0xFF, sizeof(sEeprom));
+    Zone_Load();
+    if (!Zone_Set(&c->zone)) {
+        printf("  %s: the zone is refused\n", c->name);
+        return false;
+    }
+
+    for (t = 0; t <= LAST_TICK; t += STEP) {
+        utc = (uint32_t)t;
+        if (!Check(c->name, utc) || !CheckBack(c->name, &c->zone, utc)) {
+            return false;
+        }
+        /* A transition since the previous step: find its second, and check both sides */
+        if ((t >= STEP) && (Offset(utc) != Offset(utc - STEP))) {
+            low = utc - STEP;
+            high = utc;
+            while (high - low > 1) {
+                mid = low + (high - low) / 2;
+                if (Offset(mid) == Offset(low)) {
+                    low = mid;
+                }
+                else {
+                    high = mid;
+                }
+            }
+            if (!Check(c->name, low) || !Check(c->name, high) || !CheckBack(c->name, &c->zone, low)
+                    || !CheckBack(c->name, &c->zone, high)) {
+                return false;
+            }
+            /* Spring forward: the local times in between do not occur, and are taken for standard time */
+            if (Offset(high) > Offset(low)) {
+                gap = (uint32_t)(Offset(high) - Offset(low));
+                skipped = Expected(low) + 1 + gap / 2;
+                if (Zone_ToUtc(skipped) != skipped - (uint32_t)(c->zone.offset * 60)) {
+                    printf("  %s: the skipped local time %u gives %u\n", c->name, skipped, Zone_ToUtc(skipped));
+                    return false;
+                }
+            }
+            transitions++;
+        }
+    }
+    for (n = 0; n < 1000000; n++) {
+        utc = Random();
+        if (!Check(c->name, utc) || !CheckBack(c->name, &c->zone, utc)) {
+            return false;
+        }
+    }
+    printf("%-24s %-48s %4d transitions\n", c->name, c->tz, transitions);
+    return true;
+}
+
+/* Out of bounds zones are refused, and leave the zone as it was */
+static bool CheckRefused(void)
+{
+    static const ZONE_T bad[] = {
+        {15 * 60, 0, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+        {60, 60, {13, 5, 0, 0, 120}, {10, 5, 0, 0, 180}},
+        {60, 60, {3, 6, 0, 0, 120}, {10, 5, 0, 0, 180}},
+        {60, 60, {3, 5, 7, 0, 120}, {10, 5, 0, 0, 180}},
+        {60, 180, {3, 5, 0, 0, 120}, {10, 5, 0, 0, 180}},
+    };
+    ZONE_T zone;
+    size_t n;
+
+    Zone_Set(&sCases[2].zone);
+    for (n = 0; n < sizeof(bad) / sizeof(bad[0]); n++) {
+        Zone_Get(&zone);
+        if (Zone_Set(&bad[n]) || memcmp(&zone, &sCases[2].zone, sizeof(zone))) {
+            printf("  zone %u is not refused\n", (unsigned)n);
+            return false;
+        }
+    }
+    printf("%-24s %u zones out of bounds\n", "refused", (unsigned)n);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+    size_t n;
+
+    for (n = 0; n < sizeof(sCases) / sizeof(sCases[0]); n++) {
+        ok &= Run(&sCases[n]);
+    }
+    ok &= CheckRefused();
+    return ok ? 0 : 1;
+}